@@ -3,12 +3,15 @@
  * SPDX-License-Identifier: Apache-2.0 */
 
 #include <cstdio>
+#include <fstream>
+#include <iostream>
 
 #include "device/device.h"
 #include "scene/camera.h"
 #include "scene/integrator.h"
 #include "scene/scene.h"
 #include "session/buffers.h"
+#include "session/merge.h"
 #include "session/session.h"
 
 #include "util/args.h"
@@ -48,6 +51,13 @@ struct Options {
   bool show_help, interactive, pause;
   string output_filepath;
   string output_pass;
+  /* Distribute the samples of a frame across render nodes, each rendering a disjoint subset. */
+  int node_index, node_count;
+  /* Merge previously rendered images instead of rendering. */
+  vector<string> merge_filepaths;
+  string merge_output_filepath;
+  /* Render a sequence of jobs in one process. */
+  string jobs_filepath;
 } options;
 
 static void session_print(const string &str)
@@ -139,8 +149,12 @@ static void session_init()
 #endif
 
   if (!options.output_filepath.empty()) {
-    options.session->set_output_driver(make_unique<OIIOOutputDriver>(
-        options.output_filepath, options.output_pass, session_print));
+    unique_ptr<OIIOOutputDriver> output_driver = make_unique<OIIOOutputDriver>(
+        options.output_filepath, options.output_pass, session_print);
+    if (options.session_params.use_sample_subset) {
+      output_driver->set_num_samples(options.session_params.sample_subset_length);
+    }
+    options.session->set_output_driver(std::move(output_driver));
   }
 
   if (options.session_params.background && !options.quiet) {
@@ -164,6 +178,106 @@ static void session_init()
   options.session->start();
 }
 
+/* Parse a job line of the form "scene_file [output_file]". */
+static bool job_parse(const string &line, string &filepath, string &output_filepath)
+{
+  vector<string> tokens;
+  string_split(tokens, line);
+
+  if (tokens.empty() || tokens.size() > 2 || string_startswith(tokens[0], "#")) {
+    return false;
+  }
+
+  filepath = tokens[0];
+  output_filepath = (tokens.size() == 2) ? tokens[1] : "";
+  return true;
+}
+
+/* Render every job of the jobs file. When reading from the standard input jobs are rendered as
+ * they arrive, so the process can stay alive between frames of a render farm.
+ *
+ * Every job gets a new session, so that no state of the previous scene can leak into the next
+ * one. Compiled kernels are still reused through the kernel cache, and the process startup is
+ * only paid once. */
+static bool jobs_run()
+{
+  std::ifstream file;
+  const bool use_stdin = (options.jobs_filepath == "-");
+  if (!use_stdin) {
+    file.open(options.jobs_filepath);
+    if (!file.is_open()) {
+      fprintf(stderr, "Failed to open jobs file: %s\n", options.jobs_filepath.c_str());
+      return false;
+    }
+  }
+  std::istream &stream = (use_stdin) ? std::cin : file;
+
+  const int width = options.width;
+  const int height = options.height;
+  bool success = true;
+
+  string line;
+  while (std::getline(stream, line)) {
+    if (!job_parse(line, options.filepath, options.output_filepath)) {
+      continue;
+    }
+
+    /* Resolution from the command line applies to every job, otherwise use the scene's. */
+    options.width = width;
+    options.height = height;
+
+    session_init();
+    options.session->wait();
+
+    if (options.session->progress.get_error()) {
+      fprintf(stderr,
+              "\nFailed to render %s: %s\n",
+              options.filepath.c_str(),
+              options.session->progress.get_error_message().c_str());
+      success = false;
+      break;
+    }
+    else if (!options.quiet) {
+      session_print("Finished " + options.filepath);
+      printf("\n");
+    }
+
+    /* Make sure the output of this job is written before reading the next one. */
+    options.session.reset();
+  }
+
+  session_exit();
+  return success;
+}
+
+static void session_split_samples()
+{
+  /* Give every node a contiguous range of samples, spreading the remainder over the first
+   * nodes. Since the sample pattern only depends on the sample index, merging the images of all
+   * nodes gives the same result as rendering all samples on a single node. */
+  SessionParams &params = options.session_params;
+  const int base = params.samples / options.node_count;
+  const int remainder = params.samples % options.node_count;
+
+  params.use_sample_subset = true;
+  params.sample_subset_offset = options.node_index * base + min(options.node_index, remainder);
+  params.sample_subset_length = base + ((options.node_index < remainder) ? 1 : 0);
+}
+
+static bool images_merge()
+{
+  ImageMerger merger;
+  merger.input = options.merge_filepaths;
+  merger.output = options.merge_output_filepath;
+
+  if (!merger.run()) {
+    fprintf(stderr, "Failed to merge images: %s\n", merger.error.c_str());
+    return false;
+  }
+
+  return true;
+}
+
 static void session_exit()
 {
   if (options.session) {
@@ -410,7 +524,10 @@ static void options_parse(const int argc, const char **argv)
   int verbosity = 1;
 
   ap.usage("cycles [options] file.xml");
-  ap.arg("filename").hidden().action([&](auto argv) { options.filepath = argv[0]; });
+  ap.arg("filename").hidden().action([&](auto argv) {
+    options.filepath = argv[0];
+    options.merge_filepaths.push_back(argv[0]);
+  });
   ap.arg("--device %s:DEVICE").help("Devices to use: " + device_names).action([&](auto argv) {
     parse_string(argv, &devicename);
   });
@@ -440,6 +557,19 @@ static void options_parse(const int argc, const char **argv)
   ap.arg("--tile-size %d:TILE_SIZE").help("Tile size in pixels").action([&](auto argv) {
     parse_int(argv, &options.session_params.tile_size);
   });
+  ap.arg("--node-index %d:INDEX")
+      .help("Index of this node when distributing the samples of a frame across nodes")
+      .action([&](auto argv) { parse_int(argv, &options.node_index); });
+  ap.arg("--node-count %d:COUNT")
+      .help("Number of nodes the samples of a frame are distributed across")
+      .action([&](auto argv) { parse_int(argv, &options.node_count); });
+  ap.arg("--merge %s:OUTPUT")
+      .help("Merge the input images rendered by multiple nodes into OUTPUT, without rendering")
+      .action([&](auto argv) { parse_string(argv, &options.merge_output_filepath); });
+  ap.arg("--jobs %s:FILE")
+      .help("Render the jobs listed in FILE, one \"scene_file [output_file]\" per line, in one "
+            "process. Use - to read jobs from the standard input as they arrive")
+      .action([&](auto argv) { parse_string(argv, &options.jobs_filepath); });
   ap.arg("--list-devices", &list).help("List information about all available devices");
   ap.arg("--profile", &profile).help("Enable profile logging");
 #ifdef WITH_CYCLES_LOGGING
@@ -479,10 +609,13 @@ static void options_parse(const int argc, const char **argv)
     printf("%s\n", CYCLES_VERSION_STRING);
     exit(EXIT_SUCCESS);
   }
-  else if (help || options.filepath.empty()) {
+  else if (help || (options.filepath.empty() && options.jobs_filepath.empty())) {
     ap.print_help();
     exit(EXIT_SUCCESS);
   }
+  else if (!options.merge_output_filepath.empty()) {
+    return;
+  }
 
   options.session_params.use_profiling = profile;
 
@@ -495,6 +628,10 @@ static void options_parse(const int argc, const char **argv)
 
 #ifndef WITH_CYCLES_STANDALONE_GUI
   options.session_params.background = true;
+#else
+  if (!options.jobs_filepath.empty()) {
+    options.session_params.background = true;
+  }
 #endif
 
   if (options.session_params.tile_size > 0) {
@@ -532,10 +669,23 @@ static void options_parse(const int argc, const char **argv)
     fprintf(stderr, "Invalid number of samples: %d\n", options.session_params.samples);
     exit(EXIT_FAILURE);
   }
-  else if (options.filepath.empty()) {
+  else if (options.filepath.empty() && options.jobs_filepath.empty()) {
     fprintf(stderr, "No file path specified\n");
     exit(EXIT_FAILURE);
   }
+  else if (options.node_count < 0 || options.node_index < 0 ||
+           (options.node_count > 0 && options.node_index >= options.node_count))
+  {
+    fprintf(stderr,
+            "Invalid node index %d for node count %d\n",
+            options.node_index,
+            options.node_count);
+    exit(EXIT_FAILURE);
+  }
+
+  if (options.node_count > 1) {
+    session_split_samples();
+  }
 }
 
 CCL_NAMESPACE_END
@@ -548,6 +698,22 @@ int main(const int argc, const char **argv)
   path_init();
   options_parse(argc, argv);
 
+  if (!options.merge_output_filepath.empty()) {
+    return images_merge() ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  if (options.session_params.use_sample_subset &&
+      options.session_params.sample_subset_length == 0)
+  {
+    /* There are more nodes than samples, leave the image of this node out of the merge. */
+    printf("No samples to render for node %d of %d\n", options.node_index, options.node_count);
+    return EXIT_SUCCESS;
+  }
+
+  if (!options.jobs_filepath.empty()) {
+    return jobs_run() ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
 #ifdef WITH_CYCLES_STANDALONE_GUI
   if (options.session_params.background) {
 #endif
@@ -23,13 +23,51 @@ OIIOOutputDriver::OIIOOutputDriver(const string_view filepath,
 
 OIIOOutputDriver::~OIIOOutputDriver() = default;
 
+void OIIOOutputDriver::set_num_samples(const int num_samples)
+{
+  num_samples_ = num_samples;
+}
+
 void OIIOOutputDriver::write_render_tile(const Tile &tile)
 {
-  /* Only write the full buffer, no intermediate tiles. */
-  if (!(tile.size == tile.full_size)) {
+  const int width = tile.full_size.x;
+  const int height = tile.full_size.y;
+
+  /* The full frame may be delivered in parts, when it is processed from the tile file in bands.
+   * Gather them and only write the image once it is complete. */
+  if (pixels_.empty()) {
+    pixels_.resize(size_t(width) * height * 4);
+    num_pixels_written_ = 0;
+  }
+
+  if (tile.size == tile.full_size) {
+    if (!tile.get_pass_pixels(pass_, 4, pixels_.data())) {
+      log_("Failed to read render pass pixels");
+      pixels_.clear();
+      return;
+    }
+  }
+  else {
+    vector<float> tile_pixels(size_t(tile.size.x) * tile.size.y * 4);
+    if (!tile.get_pass_pixels(pass_, 4, tile_pixels.data())) {
+      log_("Failed to read render pass pixels");
+      return;
+    }
+    for (int y = 0; y < tile.size.y; y++) {
+      memcpy(pixels_.data() + (size_t(tile.offset.y + y) * width + tile.offset.x) * 4,
+             tile_pixels.data() + size_t(y) * tile.size.x * 4,
+             sizeof(float) * tile.size.x * 4);
+    }
+  }
+
+  num_pixels_written_ += int64_t(tile.size.x) * tile.size.y;
+  if (num_pixels_written_ < int64_t(width) * height) {
     return;
   }
 
+  vector<float> pixels;
+  pixels.swap(pixels_);
+
   log_(string_printf("Writing image %s", filepath_.c_str()));
 
   unique_ptr<ImageOutput> image_output(ImageOutput::create(filepath_));
@@ -38,21 +76,17 @@ void OIIOOutputDriver::write_render_tile(const Tile &tile)
     return;
   }
 
-  const int width = tile.size.x;
-  const int height = tile.size.y;
-
-  const ImageSpec spec(width, height, 4, TypeDesc::FLOAT);
+  ImageSpec spec(width, height, 4, TypeDesc::FLOAT);
+  if (num_samples_ > 0) {
+    /* Same metadata as Blender writes for multi-layer files, used by ImageMerger. */
+    const string layer = tile.layer.empty() ? "RenderLayer" : tile.layer;
+    spec.attribute("cycles." + layer + ".samples", TypeDesc::STRING, to_string(num_samples_));
+  }
   if (!image_output->open(filepath_, spec)) {
     log_("Failed to create image file");
     return;
   }
 
-  vector<float> pixels(width * height * 4);
-  if (!tile.get_pass_pixels(pass_, 4, pixels.data())) {
-    log_("Failed to read render pass pixels");
-    return;
-  }
-
   /* Manipulate offset and stride to convert from bottom-up to top-down convention. */
   OIIO::ImageBuf image_buffer(spec,
                               pixels.data() + (height - 1) * width * 4,
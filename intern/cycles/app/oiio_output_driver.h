@@ -7,6 +7,7 @@
 #include "session/output_driver.h"
 
 #include "util/string.h"
+#include "util/vector.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -19,10 +20,19 @@ class OIIOOutputDriver : public OutputDriver {
 
   void write_render_tile(const Tile &tile) override;
 
+  /* Number of samples written to the image metadata, so that images rendered from disjoint
+   * sample subsets can be merged with the correct weights. Zero disables the metadata. */
+  void set_num_samples(const int num_samples);
+
  protected:
   string filepath_;
   string pass_;
   LogFunction log_;
+  int num_samples_ = 0;
+
+  /* Full frame pixels gathered from tiles until the image is complete. */
+  vector<float> pixels_;
+  int64_t num_pixels_written_ = 0;
 };
 
 CCL_NAMESPACE_END
@@ -105,6 +105,7 @@ class AddPresetPerformance(AddPresetBase, Operator):
         "cycles.debug_use_spatial_splits",
         "cycles.debug_use_compact_bvh",
         "cycles.debug_use_hair_bvh",
+        "cycles.debug_use_bvh_cache",
         "cycles.debug_bvh_time_steps",
         "cycles.use_auto_tile",
         "cycles.tile_size",
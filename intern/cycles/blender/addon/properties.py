@@ -588,6 +588,13 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         default=0,
     )
 
+    use_viewport_warm_start: BoolProperty(
+        name="Warm Start",
+        description="After moving the viewport camera, start rendering from the previous result "
+        "reprojected to the new view, which blends out as new samples accumulate",
+        default=False,
+    )
+
     use_preview_adaptive_sampling: BoolProperty(
         name="Use Adaptive Sampling",
         description="Automatically reduce the number of samples per pixel based on estimated noise level, for viewport renders",
@@ -718,6 +725,15 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         default=128,
     )
 
+    guiding_field_filepath: StringProperty(
+        name="Training Cache",
+        description="File to store the trained guiding field in after rendering, and to continue "
+        "training from when rendering the next frame. Speeds up training for consecutive frames "
+        "of mostly static scenes",
+        subtype='FILE_PATH',
+        default="",
+    )
+
     volume_guiding_probability: FloatProperty(
         name="Volume Guiding Probability",
         description="The probability of guiding a direction inside a volume",
@@ -932,6 +948,12 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         description="Use compact BVH structure (uses less ram but renders slower)",
         default=False,
     )
+    debug_use_bvh_cache: BoolProperty(
+        name="Use BVH Disk Cache",
+        description="Store the BVH of unchanged geometry in the user cache directory and reuse it in "
+        "later renders, skipping the build (only used when Cycles is built without Embree or on GPU)",
+        default=False,
+    )
     debug_bvh_time_steps: IntProperty(
         name="BVH Time Steps",
         description="Split BVH primitives by this number of time steps to speed up render time in cost of memory",
@@ -1020,6 +1042,22 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         items=enum_texture_limit
     )
 
+    texture_memory_limit: IntProperty(
+        name="Viewport Texture Memory Limit",
+        description="Maximum device memory in megabytes used by image textures in viewport rendering, "
+        "textures are scaled down to fit when exceeded (0 for no limit)",
+        min=0,
+        default=0,
+    )
+
+    texture_memory_limit_render: IntProperty(
+        name="Render Texture Memory Limit",
+        description="Maximum device memory in megabytes used by image textures in final rendering, "
+        "textures are scaled down to fit when exceeded (0 for no limit)",
+        min=0,
+        default=0,
+    )
+
     use_fast_gi: BoolProperty(
         name="Fast GI Approximation",
         description="Approximate diffuse indirect light with background tinted ambient occlusion. "
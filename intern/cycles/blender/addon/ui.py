@@ -242,6 +242,8 @@ class CYCLES_RENDER_PT_sampling_viewport(CyclesButtonsPanel, Panel):
         else:
             layout.prop(cscene, "preview_samples", text="Samples")
 
+        layout.prop(cscene, "use_viewport_warm_start")
+
 
 class CYCLES_RENDER_PT_sampling_viewport_denoise(CyclesButtonsPanel, Panel):
     bl_label = "Denoise"
@@ -380,6 +382,7 @@ class CYCLES_RENDER_PT_sampling_path_guiding(CyclesButtonsPanel, Panel):
         layout.active = cscene.use_guiding
 
         layout.prop(cscene, "guiding_training_samples")
+        layout.prop(cscene, "guiding_field_filepath")
 
         col = layout.column(align=True)
         col.prop(cscene, "use_surface_guiding", text="Surface")
@@ -897,6 +900,7 @@ class CYCLES_RENDER_PT_performance_acceleration_structure(CyclesButtonsPanel, Pa
                 sub.prop(cscene, "debug_bvh_time_steps")
 
                 col.prop(cscene, "debug_use_hair_bvh")
+                col.prop(cscene, "debug_use_bvh_cache")
 
                 sub = col.column(align=True)
                 sub.label(text="Cycles built without Embree support")
@@ -908,6 +912,7 @@ class CYCLES_RENDER_PT_performance_acceleration_structure(CyclesButtonsPanel, Pa
             sub.prop(cscene, "debug_bvh_time_steps")
 
             col.prop(cscene, "debug_use_hair_bvh")
+            col.prop(cscene, "debug_use_bvh_cache")
 
             # CPU is used in addition to a GPU
             if use_multi_device(context) and use_embree:
@@ -2281,6 +2286,7 @@ class CYCLES_RENDER_PT_simplify_viewport(CyclesButtonsPanel, Panel):
         col.prop(rd, "simplify_subdivision", text="Max Subdivision")
         col.prop(rd, "simplify_child_particles", text="Child Particles")
         col.prop(cscene, "texture_limit", text="Texture Limit")
+        col.prop(cscene, "texture_memory_limit", text="Texture Memory (MB)")
         col.prop(rd, "simplify_volumes", text="Volume Resolution")
         col.prop(rd, "use_simplify_normals", text="Normals")
 
@@ -2307,6 +2313,7 @@ class CYCLES_RENDER_PT_simplify_render(CyclesButtonsPanel, Panel):
         col.prop(rd, "simplify_subdivision_render", text="Max Subdivision")
         col.prop(rd, "simplify_child_particles_render", text="Child Particles")
         col.prop(cscene, "texture_limit_render", text="Texture Limit")
+        col.prop(cscene, "texture_memory_limit_render", text="Texture Memory (MB)")
 
 
 class CYCLES_RENDER_PT_simplify_culling(CyclesButtonsPanel, Panel):
@@ -13,6 +13,9 @@
 #include "blender/sync.h"
 #include "blender/util.h"
 
+#include "util/log.h"
+#include "util/map.h"
+#include "util/md5.h"
 #include "util/task.h"
 
 CCL_NAMESPACE_BEGIN
@@ -207,6 +210,83 @@ Geometry *BlenderSync::sync_geometry(BObjectInfo &b_ob_info,
   return geom;
 }
 
+static string geometry_content_hash(Geometry *geom)
+{
+  MD5Hash md5;
+
+  /* Sockets include the used shaders, so geometry with different materials stays unique. */
+  geom->hash(md5);
+
+  for (const Attribute &attr : geom->attributes.attributes) {
+    md5.append(attr.name.string());
+    md5.append((const uint8_t *)&attr.std, sizeof(attr.std));
+    md5.append((const uint8_t *)&attr.element, sizeof(attr.element));
+    md5.append(attr.type.c_str());
+    if (!attr.buffer.empty()) {
+      md5.append((const uint8_t *)attr.buffer.data(), attr.buffer.size());
+    }
+  }
+
+  return md5.get_hex();
+}
+
+void BlenderSync::sync_geometry_deduplicate()
+{
+  /* Objects with modifiers or realized geometry nodes instances get their own geometry even when
+   * the evaluated result is identical. Let all objects share the same geometry in that case, so
+   * it is stored and its BVH built only once.
+   *
+   * Only done when geometry is synced a single time: re-syncing after edits would need to undo
+   * the sharing, and motion is synced per object into the geometry. With multiple views the
+   * data is synced again for every view, which would point objects back at the emptied
+   * duplicates. Subdivision surfaces are left alone since their tessellation depends on the
+   * object. */
+  const bool is_persistent_data = b_engine.render() && b_engine.render().use_persistent_data();
+  if (preview || is_persistent_data || b_bake_target || b_scene.render().use_multiview() ||
+      scene->need_motion() != Scene::MOTION_NONE)
+  {
+    return;
+  }
+
+  unordered_map<string, Geometry *> unique_geometry;
+  unordered_map<Geometry *, Geometry *> duplicate_geometry;
+
+  for (const auto &[key, geom] : geometry_map.key_to_scene_data()) {
+    if (!geom->is_mesh() || geometry_synced.find(geom) == geometry_synced.end()) {
+      continue;
+    }
+
+    const Mesh *mesh = static_cast<const Mesh *>(geom);
+    if (mesh->get_subdivision_type() != Mesh::SUBDIVISION_NONE || mesh->num_triangles() == 0) {
+      continue;
+    }
+
+    const auto [it, inserted] = unique_geometry.emplace(geometry_content_hash(geom), geom);
+    if (!inserted) {
+      duplicate_geometry[geom] = it->second;
+    }
+  }
+
+  if (duplicate_geometry.empty()) {
+    return;
+  }
+
+  for (const auto &[key, object] : object_map.key_to_scene_data()) {
+    auto it = duplicate_geometry.find(object->get_geometry());
+    if (it != duplicate_geometry.end()) {
+      object->set_geometry(it->second);
+    }
+  }
+
+  /* Free the data of the duplicates. They are kept in the map so they are not deleted while
+   * still being the geometry of some object key at the next sync. */
+  for (const auto &[duplicate, geom] : duplicate_geometry) {
+    duplicate->clear(true);
+  }
+
+  VLOG_INFO << "Shared " << duplicate_geometry.size() << " geometries with identical content.";
+}
+
 void BlenderSync::sync_geometry_motion(BObjectInfo &b_ob_info,
                                        Object *object,
                                        const float motion_time,
@@ -624,6 +624,8 @@ void BlenderSync::sync_objects(BL::Depsgraph &b_depsgraph,
   progress.set_sync_status("");
 
   if (!cancel && !motion) {
+    sync_geometry_deduplicate();
+
     /* After object for world_use_portal. */
     sync_background_light(b_v3d);
 
@@ -200,8 +200,12 @@ void BlenderSession::reset_session(BL::BlendData &b_data, BL::Depsgraph &b_depsg
   const SceneParams scene_params = BlenderSync::get_scene_params(
       b_scene, background, use_developer_ui);
 
+  /* Baking several objects from the same depsgraph reuses the engine, keep the synced scene
+   * around for those the same way as for persistent data. */
+  const bool is_bake_reuse = !is_new_session && scene->bake_manager->get_baking();
+
   if (scene->params.modified(scene_params) || session->params.modified(session_params) ||
-      !this->b_render.use_persistent_data())
+      (!this->b_render.use_persistent_data() && !is_bake_reuse))
   {
     /* if scene or session parameters changed, it's easier to simply re-create
      * them rather than trying to distinguish which settings need to be updated
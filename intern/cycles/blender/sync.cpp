@@ -89,6 +89,17 @@ void BlenderSync::tag_update()
 
 void BlenderSync::set_bake_target(BL::Object &b_object)
 {
+  /* When the engine is reused to bake several objects from the same depsgraph, the scene is
+   * already synced and only the bake target flag of the objects has to follow the new target. */
+  if (b_bake_target && b_bake_target != b_object) {
+    for (const auto &[key, object] : object_map.key_to_scene_data()) {
+      object->set_is_bake_target(key.ob == b_object.ptr.data);
+      if (object->is_modified()) {
+        object->tag_update(scene);
+      }
+    }
+  }
+
   b_bake_target = b_object;
 }
 
@@ -481,6 +492,8 @@ void BlenderSync::sync_integrator(BL::ViewLayer &b_view_layer,
   integrator->set_use_surface_guiding(get_boolean(cscene, "use_surface_guiding"));
   integrator->set_use_volume_guiding(get_boolean(cscene, "use_volume_guiding"));
   integrator->set_guiding_training_samples(get_int(cscene, "guiding_training_samples"));
+  integrator->set_guiding_field_filepath(ustring(
+      blender_absolute_path(b_data, b_scene, get_string(cscene, "guiding_field_filepath"))));
 
   if (use_developer_ui) {
     integrator->set_deterministic_guiding(get_boolean(cscene, "use_deterministic_guiding"));
@@ -866,6 +879,7 @@ SceneParams BlenderSync::get_scene_params(BL::Scene &b_scene,
   params.use_bvh_spatial_split = RNA_boolean_get(&cscene, "debug_use_spatial_splits");
   params.use_bvh_compact_structure = RNA_boolean_get(&cscene, "debug_use_compact_bvh");
   params.use_bvh_unaligned_nodes = RNA_boolean_get(&cscene, "debug_use_hair_bvh");
+  params.use_bvh_disk_cache = RNA_boolean_get(&cscene, "debug_use_bvh_cache");
   params.num_bvh_time_steps = RNA_int_get(&cscene, "debug_bvh_time_steps");
 
   PointerRNA csscene = RNA_pointer_get(&b_scene.ptr, "cycles_curves");
@@ -887,6 +901,15 @@ SceneParams BlenderSync::get_scene_params(BL::Scene &b_scene,
     params.texture_limit = 0;
   }
 
+  const int texture_memory_limit = RNA_int_get(
+      &cscene, background ? "texture_memory_limit_render" : "texture_memory_limit");
+  if (texture_memory_limit > 0 && b_scene.render().use_simplify()) {
+    params.texture_memory_limit = size_t(texture_memory_limit) * 1024 * 1024;
+  }
+  else {
+    params.texture_memory_limit = 0;
+  }
+
   params.bvh_layout = DebugFlags().cpu.bvh_layout;
 
   params.background = background;
@@ -956,6 +979,7 @@ SessionParams BlenderSync::get_session_params(BL::RenderEngine &b_engine,
 
   /* Viewport Performance */
   params.pixel_size = b_engine.get_preview_pixel_size(b_scene);
+  params.use_viewport_warm_start = !background && get_boolean(cscene, "use_viewport_warm_start");
 
   if (background) {
     params.pixel_size = 1;
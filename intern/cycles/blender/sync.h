@@ -188,6 +188,8 @@ class BlenderSync {
                           bool use_particle_hair,
                           TaskPool *task_pool);
 
+  void sync_geometry_deduplicate();
+
   void sync_geometry_motion(BObjectInfo &b_ob_info,
                             Object *object,
                             const float motion_time,
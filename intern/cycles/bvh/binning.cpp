@@ -13,6 +13,7 @@
 
 #include "util/algorithm.h"
 #include "util/boundbox.h"
+#include "util/tbb.h"
 #include "util/types.h"
 
 CCL_NAMESPACE_BEGIN
@@ -68,11 +69,7 @@ BVHObjectBinning::BVHObjectBinning(const BVHRange &job,
     cent_bounds_ = cent_bounds();
   }
   else {
-    /* TODO(sergey): With some additional storage we can avoid
-     * need in re-calculating this.
-     */
-    bounds_ = unaligned_heuristic->compute_aligned_boundbox(
-        *this, prims, *aligned_space, &cent_bounds_);
+    compute_aligned_prim_bounds(prims);
   }
 
   /* compute number of bins to use and precompute scaling factor for binning */
@@ -99,8 +96,8 @@ BVHObjectBinning::BVHObjectBinning(const BVHRange &job,
       const BVHReference &prim0 = prims[start() + i + 0];
       const BVHReference &prim1 = prims[start() + i + 1];
 
-      const BoundBox bounds0 = get_prim_bounds(prim0);
-      const BoundBox bounds1 = get_prim_bounds(prim1);
+      const BoundBox bounds0 = get_prim_bounds(i + 0, prim0);
+      const BoundBox bounds1 = get_prim_bounds(i + 1, prim1);
 
       const int4 bin0 = get_bin(bounds0);
       const int4 bin1 = get_bin(bounds1);
@@ -132,7 +129,7 @@ BVHObjectBinning::BVHObjectBinning(const BVHRange &job,
     if (i < int64_t(size())) {
       /* map primitive to bin */
       const BVHReference &prim0 = prims[start() + i];
-      const BoundBox bounds0 = get_prim_bounds(prim0);
+      const BoundBox bounds0 = get_prim_bounds(i, prim0);
       const int4 bin0 = get_bin(bounds0);
 
       /* increase bounds of bins */
@@ -209,6 +206,37 @@ BVHObjectBinning::BVHObjectBinning(const BVHRange &job,
   leafSAH = bounds_.half_area() * blocks(size());
 }
 
+void BVHObjectBinning::compute_aligned_prim_bounds(const BVHReference *prims)
+{
+  const size_t N = size();
+  aligned_prim_bounds_.resize(N);
+
+  const BVHUnaligned *unaligned_heuristic = unaligned_heuristic_;
+  const Transform &aligned_space = *aligned_space_;
+  auto compute_bounds = [&](const size_t begin, const size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      aligned_prim_bounds_[i] = unaligned_heuristic->compute_aligned_prim_boundbox(
+          prims[start() + i], aligned_space);
+    }
+  };
+
+  /* Ranges near the root of dense hair contain millions of curve segments. */
+  if (N > PARALLEL_BOUNDS_SIZE) {
+    parallel_for(blocked_range<size_t>(0, N, PARALLEL_BOUNDS_SIZE),
+                 [&](const blocked_range<size_t> &r) { compute_bounds(r.begin(), r.end()); });
+  }
+  else {
+    compute_bounds(0, N);
+  }
+
+  bounds_ = BoundBox::empty;
+  cent_bounds_ = BoundBox::empty;
+  for (const BoundBox &prim_bounds : aligned_prim_bounds_) {
+    bounds_.grow(prim_bounds);
+    cent_bounds_.grow(prim_bounds.center2());
+  }
+}
+
 void BVHObjectBinning::split(BVHReference *prims,
                              BVHObjectBinning &left_o,
                              BVHObjectBinning &right_o) const
@@ -220,6 +248,16 @@ void BVHObjectBinning::split(BVHReference *prims,
   BoundBox lcent_bounds = BoundBox::empty;
   BoundBox rcent_bounds = BoundBox::empty;
 
+  /* The aligned bounds are indexed in the original order of the references, so decide the side
+   * of every primitive before the partitioning below reorders the references. */
+  vector<uint8_t> goes_left;
+  if (aligned_space_ != nullptr) {
+    goes_left.resize(N);
+    for (size_t i = 0; i < N; i++) {
+      goes_left[i] = get_bin(aligned_prim_bounds_[i].center2())[dim] < pos;
+    }
+  }
+
   int64_t l = 0;
   int64_t r = N - 1;
 
@@ -228,11 +266,11 @@ void BVHObjectBinning::split(BVHReference *prims,
     prefetch_L2(&prims[start() + r - 8]);
 
     const BVHReference prim = prims[start() + l];
-    const BoundBox unaligned_bounds = get_prim_bounds(prim);
-    const float3 unaligned_center = unaligned_bounds.center2();
     const float3 center = prim.bounds().center2();
+    const bool is_left = (aligned_space_ != nullptr) ? goes_left[l] != 0 :
+                                                       get_bin(center)[dim] < pos;
 
-    if (get_bin(unaligned_center)[dim] < pos) {
+    if (is_left) {
       lgeom_bounds.grow(prim.bounds());
       lcent_bounds.grow(center);
       l++;
@@ -241,9 +279,13 @@ void BVHObjectBinning::split(BVHReference *prims,
       rgeom_bounds.grow(prim.bounds());
       rcent_bounds.grow(center);
       swap(prims[start() + l], prims[start() + r]);
+      if (aligned_space_ != nullptr) {
+        swap(goes_left[l], goes_left[r]);
+      }
       r--;
     }
   }
+
   /* finish */
   if (l != 0 && N - 1 - r != 0) {
     right_o = BVHObjectBinning(BVHRange(rgeom_bounds, rcent_bounds, start() + l, N - 1 - r),
@@ -11,6 +11,7 @@
 #include "bvh/unaligned.h"
 
 #include "util/types.h"
+#include "util/vector.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -55,6 +56,13 @@ class BVHObjectBinning : public BVHRange {
   const BVHUnaligned *unaligned_heuristic_;
   const Transform *aligned_space_;
 
+  /* Bounds of the primitives in the aligned space, in the order of the references. Computing
+   * these is expensive for curves, so they are only computed once and reused for the binning and
+   * the split. */
+  vector<BoundBox> aligned_prim_bounds_;
+
+  enum { PARALLEL_BOUNDS_SIZE = 4096 };
+
   enum { MAX_BINS = 32 };
   enum { LOG_BLOCK_SIZE = 2 };
 
@@ -86,13 +94,16 @@ class BVHObjectBinning : public BVHRange {
     return (int)((a + ((1LL << LOG_BLOCK_SIZE) - 1)) >> LOG_BLOCK_SIZE);
   }
 
-  __forceinline BoundBox get_prim_bounds(const BVHReference &prim) const
+  /* Bounds of the i-th primitive of the range. */
+  __forceinline BoundBox get_prim_bounds(const size_t i, const BVHReference &prim) const
   {
     if (aligned_space_ == nullptr) {
       return prim.bounds();
     }
-    return unaligned_heuristic_->compute_aligned_prim_boundbox(prim, *aligned_space_);
+    return aligned_prim_bounds_[i];
   }
+
+  void compute_aligned_prim_bounds(const BVHReference *prims);
 };
 
 CCL_NAMESPACE_END
@@ -751,6 +751,10 @@ unique_ptr<BVHNode> BVHBuild::build_node(const BVHObjectBinning &range, const in
     if (unalignedSplitSAH < splitSAH) {
       do_unalinged_split = true;
     }
+    else {
+      /* Free the per-primitive aligned bounds before recursing. */
+      unaligned_range = BVHObjectBinning();
+    }
   }
 
   /* Perform split. */
@@ -765,7 +769,9 @@ unique_ptr<BVHNode> BVHBuild::build_node(const BVHObjectBinning &range, const in
 
   BoundBox bounds;
   if (do_unalinged_split) {
-    bounds = unaligned_heuristic.compute_aligned_boundbox(range, references.data(), aligned_space);
+    bounds = unaligned_range.unaligned_bounds();
+    /* Free the per-primitive aligned bounds before recursing. */
+    unaligned_range = BVHObjectBinning();
   }
   else {
     bounds = range.bounds();
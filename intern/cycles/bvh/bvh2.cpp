@@ -15,6 +15,7 @@
 #include "scene/pointcloud.h"
 
 #include "bvh/build.h"
+#include "bvh/cache.h"
 #include "bvh/node.h"
 #include "bvh/unaligned.h"
 
@@ -38,6 +39,17 @@ BVH2::BVH2(const BVHParams &params_,
 
 void BVH2::build(Progress &progress, Stats * /*unused*/)
 {
+  /* Geometry level BVH may be available from a previous render. */
+  string cache_key;
+  if (params.use_disk_cache && geometry.size() == 1) {
+    cache_key = bvh_cache_key(params, geometry[0], objects);
+    if (!cache_key.empty() && bvh_cache_read(cache_key, pack)) {
+      progress.set_substatus("Packing BVH triangles and strands");
+      pack_primitives();
+      return;
+    }
+  }
+
   progress.set_substatus("Building BVH");
 
   /* build nodes */
@@ -73,6 +85,10 @@ void BVH2::build(Progress &progress, Stats * /*unused*/)
   /* pack nodes */
   progress.set_substatus("Packing BVH nodes");
   pack_nodes(root.get());
+
+  if (!cache_key.empty()) {
+    bvh_cache_write(cache_key, pack);
+  }
 }
 
 void BVH2::refit(Progress &progress)
@@ -0,0 +1,255 @@
+/* SPDX-FileCopyrightText: 2011-2022 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <algorithm>
+#include <cstring>
+
+#include "bvh/cache.h"
+#include "bvh/bvh.h"
+#include "bvh/params.h"
+
+#include "scene/attribute.h"
+#include "scene/hair.h"
+#include "scene/mesh.h"
+#include "scene/object.h"
+#include "scene/pointcloud.h"
+
+#include "util/log.h"
+#include "util/md5.h"
+#include "util/path.h"
+#include "util/system.h"
+
+CCL_NAMESPACE_BEGIN
+
+/* Bump when the packed layout or the builder changes in a way that affects the result. */
+static const uint32_t BVH_CACHE_VERSION = 1;
+static const char BVH_CACHE_MAGIC[8] = {'C', 'Y', 'C', 'L', 'B', 'V', 'H', '2'};
+
+namespace {
+
+/* #MD5Hash::append takes an `int` length, so large buffers are hashed in chunks. */
+void hash_bytes(MD5Hash &md5, const void *data, const size_t size)
+{
+  const size_t chunk_size = size_t(1) << 30;
+  const uint8_t *bytes = (const uint8_t *)data;
+  for (size_t offset = 0; offset < size; offset += chunk_size) {
+    md5.append(bytes + offset, int(std::min(chunk_size, size - offset)));
+  }
+}
+
+template<typename T> void hash_value(MD5Hash &md5, const T &value)
+{
+  md5.append((const uint8_t *)&value, sizeof(T));
+}
+
+template<typename T> void hash_array(MD5Hash &md5, const array<T> &data)
+{
+  hash_value(md5, data.size());
+  if (!data.empty()) {
+    hash_bytes(md5, data.data(), data.size() * sizeof(T));
+  }
+}
+
+void hash_float3_array(MD5Hash &md5, const float3 *data, const size_t size)
+{
+  /* Don't hash 4th element used for padding. */
+  hash_value(md5, size);
+  for (size_t i = 0; i < size; i++) {
+    md5.append((const uint8_t *)&data[i], sizeof(float) * 3);
+  }
+}
+
+void hash_motion_attribute(MD5Hash &md5, const Geometry *geom)
+{
+  const Attribute *attr = geom->attributes.find(ATTR_STD_MOTION_VERTEX_POSITION);
+  if (attr == nullptr || !geom->has_motion_blur()) {
+    hash_value(md5, size_t(0));
+    return;
+  }
+
+  if (attr->type == TypeFloat4) {
+    hash_value(md5, attr->buffer.size());
+    hash_bytes(md5, attr->buffer.data(), attr->buffer.size());
+  }
+  else {
+    hash_float3_array(md5, attr->data_float3(), attr->buffer.size() / sizeof(float3));
+  }
+}
+
+void hash_params(MD5Hash &md5, const BVHParams &params)
+{
+  hash_value(md5, params.use_spatial_split);
+  hash_value(md5, params.spatial_split_alpha);
+  hash_value(md5, params.unaligned_split_threshold);
+  hash_value(md5, params.sah_node_cost);
+  hash_value(md5, params.sah_primitive_cost);
+  hash_value(md5, params.min_leaf_size);
+  hash_value(md5, params.max_triangle_leaf_size);
+  hash_value(md5, params.max_motion_triangle_leaf_size);
+  hash_value(md5, params.max_curve_leaf_size);
+  hash_value(md5, params.max_motion_curve_leaf_size);
+  hash_value(md5, params.max_point_leaf_size);
+  hash_value(md5, params.max_motion_point_leaf_size);
+  hash_value(md5, params.bvh_layout);
+  hash_value(md5, params.use_unaligned_nodes);
+  hash_value(md5, params.num_motion_triangle_steps);
+  hash_value(md5, params.num_motion_curve_steps);
+  hash_value(md5, params.num_motion_point_steps);
+  hash_value(md5, params.curve_subdivisions);
+}
+
+/* Arrays stored in the cache file, in order. Primitive visibility is not stored since it is
+ * filled in again when packing primitives. The visibility stored in the nodes is covered by the
+ * cache key instead. */
+template<typename PackT, typename Func> void foreach_pack_array(PackT &pack, const Func &func)
+{
+  func(pack.nodes);
+  func(pack.leaf_nodes);
+  func(pack.prim_type);
+  func(pack.prim_index);
+  func(pack.prim_object);
+  func(pack.prim_time);
+}
+
+}  // namespace
+
+string bvh_cache_key(const BVHParams &params,
+                     const Geometry *geom,
+                     const vector<Object *> &objects)
+{
+  if (params.top_level || params.bvh_layout != BVH_LAYOUT_BVH2) {
+    return "";
+  }
+
+  MD5Hash md5;
+  hash_value(md5, BVH_CACHE_VERSION);
+  hash_params(md5, params);
+  hash_value(md5, geom->geometry_type);
+  hash_value(md5, geom->get_motion_steps());
+  hash_motion_attribute(md5, geom);
+
+  hash_value(md5, objects.size());
+  for (const Object *ob : objects) {
+    hash_value(md5, ob->visibility_for_tracing());
+  }
+
+  if (geom->is_mesh() || geom->is_volume()) {
+    const Mesh *mesh = static_cast<const Mesh *>(geom);
+    hash_float3_array(md5, mesh->get_verts().data(), mesh->get_verts().size());
+    hash_array(md5, mesh->get_triangles());
+  }
+  else if (geom->is_hair()) {
+    const Hair *hair = static_cast<const Hair *>(geom);
+    hash_value(md5, hair->curve_shape);
+    hash_float3_array(md5, hair->get_curve_keys().data(), hair->get_curve_keys().size());
+    hash_array(md5, hair->get_curve_radius());
+    hash_array(md5, hair->get_curve_first_key());
+  }
+  else if (geom->is_pointcloud()) {
+    const PointCloud *pointcloud = static_cast<const PointCloud *>(geom);
+    hash_float3_array(md5, pointcloud->get_points().data(), pointcloud->get_points().size());
+    hash_array(md5, pointcloud->get_radius());
+  }
+  else {
+    return "";
+  }
+
+  return md5.get_hex();
+}
+
+static string bvh_cache_filepath(const string &key)
+{
+  /* Split into sub-directories to avoid huge amount of files in a single directory. */
+  return path_cache_get(path_join("bvh", path_join(key.substr(0, 2), key + ".bvh")));
+}
+
+bool bvh_cache_read(const string &key, PackedBVH &pack)
+{
+  vector<uint8_t> binary;
+  if (!path_read_binary(bvh_cache_filepath(key), binary)) {
+    return false;
+  }
+
+  const uint8_t *data = binary.data();
+  const uint8_t *data_end = binary.data() + binary.size();
+
+  auto read = [&](void *dst, const size_t size) {
+    if (size_t(data_end - data) < size) {
+      return false;
+    }
+    memcpy(dst, data, size);
+    data += size;
+    return true;
+  };
+
+  char magic[sizeof(BVH_CACHE_MAGIC)];
+  uint32_t version;
+  if (!read(magic, sizeof(magic)) || memcmp(magic, BVH_CACHE_MAGIC, sizeof(magic)) != 0 ||
+      !read(&version, sizeof(version)) || version != BVH_CACHE_VERSION ||
+      !read(&pack.root_index, sizeof(pack.root_index)))
+  {
+    return false;
+  }
+
+  bool ok = true;
+  foreach_pack_array(pack, [&](auto &array) {
+    uint64_t size = 0;
+    if (!ok || !read(&size, sizeof(size)) || size_t(data_end - data) / sizeof(array[0]) < size) {
+      ok = false;
+      return;
+    }
+    array.resize(size);
+    if (size) {
+      read(array.data(), size * sizeof(array[0]));
+    }
+  });
+
+  if (!ok || data != data_end) {
+    VLOG_WARNING << "Ignoring corrupt BVH cache entry " << key;
+    pack = PackedBVH();
+    return false;
+  }
+
+  return true;
+}
+
+void bvh_cache_write(const string &key, const PackedBVH &pack)
+{
+  vector<uint8_t> binary;
+
+  auto write = [&](const void *src, const size_t size) {
+    const uint8_t *bytes = (const uint8_t *)src;
+    binary.insert(binary.end(), bytes, bytes + size);
+  };
+
+  write(BVH_CACHE_MAGIC, sizeof(BVH_CACHE_MAGIC));
+  write(&BVH_CACHE_VERSION, sizeof(BVH_CACHE_VERSION));
+  write(&pack.root_index, sizeof(pack.root_index));
+
+  foreach_pack_array(pack, [&](const auto &array) {
+    const uint64_t size = array.size();
+    write(&size, sizeof(size));
+    if (size) {
+      write(array.data(), size * sizeof(array[0]));
+    }
+  });
+
+  /* Write to a temporary file first, so that concurrent renders never read a partial entry. */
+  const string filepath = bvh_cache_filepath(key);
+  const string filepath_tmp = string_printf(
+      "%s.%llu.tmp", filepath.c_str(), (unsigned long long)system_self_process_id());
+  path_create_directories(filepath);
+  if (!path_write_binary(filepath_tmp, binary) ||
+      std::rename(filepath_tmp.c_str(), filepath.c_str()) != 0)
+  {
+    VLOG_WARNING << "Failed to write BVH cache entry " << filepath;
+    path_remove(filepath_tmp);
+    return;
+  }
+
+  VLOG_INFO << "Written BVH cache entry " << filepath << " ("
+            << string_human_readable_size(binary.size()) << ")";
+}
+
+CCL_NAMESPACE_END
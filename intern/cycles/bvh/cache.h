@@ -0,0 +1,37 @@
+/* SPDX-FileCopyrightText: 2011-2022 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#pragma once
+
+#include "util/string.h"
+#include "util/vector.h"
+
+CCL_NAMESPACE_BEGIN
+
+class BVHParams;
+class Geometry;
+class Object;
+struct PackedBVH;
+
+/* BVH Disk Cache
+ *
+ * Stores the packed BVH2 of individual geometry on disk, keyed by a hash of the geometry
+ * positions, topology and build parameters. Static geometry that is rendered again, for example
+ * when re-rendering the same frame or rendering an animation with a static set, can then skip
+ * the BVH build entirely. */
+
+/* Compute the key used to look up the BVH of the geometry, or an empty string if the geometry
+ * can not be cached. The nodes store the ray visibility of the objects, so it is part of the
+ * key too. */
+string bvh_cache_key(const BVHParams &params,
+                     const Geometry *geom,
+                     const vector<Object *> &objects);
+
+/* Read packed BVH from the cache, returns false if there is no valid entry for the key. */
+bool bvh_cache_read(const string &key, PackedBVH &pack);
+
+/* Write packed BVH into the cache, failures are not fatal and only logged. */
+void bvh_cache_write(const string &key, const PackedBVH &pack);
+
+CCL_NAMESPACE_END
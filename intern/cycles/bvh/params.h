@@ -107,6 +107,9 @@ class BVHParams {
   /* These are needed for Embree. */
   int curve_subdivisions;
 
+  /* Read and write geometry level BVH2 from the disk cache, see `bvh/cache.h`. */
+  bool use_disk_cache;
+
   /* fixed parameters */
   enum { MAX_DEPTH = 64, MAX_SPATIAL_DEPTH = 48, NUM_SPATIAL_BINS = 32 };
 
@@ -142,6 +145,8 @@ class BVHParams {
     bvh_type = 0;
 
     curve_subdivisions = 4;
+
+    use_disk_cache = false;
   }
 
   /* SAH costs */
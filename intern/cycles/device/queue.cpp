@@ -3,10 +3,13 @@
  * SPDX-License-Identifier: Apache-2.0 */
 
 #include "device/queue.h"
+#include "device/device.h"
 #include "device/kernel.h"
 
 #include "util/algorithm.h"
 #include "util/log.h"
+#include "util/path.h"
+#include "util/thread.h"
 #include "util/time.h"
 
 #include <iomanip>
@@ -17,10 +20,19 @@ DeviceQueue::DeviceQueue(Device *device) : device(device)
 {
   DCHECK_NE(device, nullptr);
   is_per_kernel_performance_ = getenv("CYCLES_DEBUG_PER_KERNEL_PERFORMANCE");
+
+  const char *trace_filepath = getenv("CYCLES_DEBUG_KERNEL_TRACE");
+  if (trace_filepath) {
+    trace_filepath_ = trace_filepath;
+  }
 }
 
 DeviceQueue::~DeviceQueue()
 {
+  if (!trace_filepath_.empty()) {
+    trace_write();
+  }
+
   if (VLOG_DEVICE_STATS_IS_ON) {
     /* Print kernel execution times sorted by time. */
     vector<pair<DeviceKernelMask, double>> stats_sorted;
@@ -67,11 +79,22 @@ void DeviceQueue::debug_enqueue_begin(DeviceKernel kernel, const int work_size)
   }
 
   last_kernels_enqueued_.set(kernel, true);
+
+  if (!trace_filepath_.empty()) {
+    trace_events_.push_back({kernel, work_size, time_dt(), 0.0});
+  }
 }
 
 void DeviceQueue::debug_enqueue_end()
 {
-  if (VLOG_DEVICE_STATS_IS_ON && is_per_kernel_performance_) {
+  if (!trace_filepath_.empty()) {
+    /* Kernels are serialized so their execution time can be measured on the host. */
+    synchronize();
+    if (!trace_events_.empty()) {
+      trace_events_.back().end_time = time_dt();
+    }
+  }
+  else if (VLOG_DEVICE_STATS_IS_ON && is_per_kernel_performance_) {
     synchronize();
   }
 }
@@ -100,4 +123,49 @@ string DeviceQueue::debug_active_kernels()
   return device_kernel_mask_as_string(last_kernels_enqueued_);
 }
 
+void DeviceQueue::trace_write()
+{
+  /* Queues of multiple devices append to the same file, each as its own thread in the timeline.
+   * The closing bracket of the array is optional in the trace format, which allows appending. */
+  static thread_mutex trace_mutex;
+  static int trace_num_queues = 0;
+  const thread_scoped_lock lock(trace_mutex);
+
+  FILE *file = path_fopen(trace_filepath_, (trace_num_queues == 0) ? "w" : "a");
+  if (!file) {
+    LOG(ERROR) << "Failed to open kernel trace file " << trace_filepath_;
+    return;
+  }
+
+  const int tid = trace_num_queues++;
+  if (tid == 0) {
+    fprintf(file, "[\n");
+  }
+
+  fprintf(file,
+          "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": %d, "
+          "\"args\": {\"name\": \"%s\"}},\n",
+          tid,
+          device->info.description.c_str());
+
+  for (const KernelTraceEvent &event : trace_events_) {
+    if (event.end_time < event.begin_time) {
+      continue;
+    }
+    fprintf(file,
+            "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %d, "
+            "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"work_size\": %d}},\n",
+            device_kernel_as_string(event.kernel),
+            tid,
+            event.begin_time * 1e6,
+            (event.end_time - event.begin_time) * 1e6,
+            event.work_size);
+  }
+
+  fclose(file);
+
+  VLOG_INFO << "Written " << trace_events_.size() << " kernel trace events to "
+            << trace_filepath_;
+}
+
 CCL_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include "util/map.h"
 #include "util/string.h"
 #include "util/unique_ptr.h"
+#include "util/vector.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -191,6 +192,19 @@ class DeviceQueue {
   /* If it is true, then a performance statistics in the debugging logs will have focus on kernels
    * and an explicit queue synchronization will be added after each kernel execution. */
   bool is_per_kernel_performance_ = false;
+
+  /* Timeline of kernel executions, exported in the Chrome trace event format when the queue is
+   * destroyed. Enabled by setting CYCLES_DEBUG_KERNEL_TRACE to the output file path. */
+  struct KernelTraceEvent {
+    DeviceKernel kernel;
+    int work_size;
+    double begin_time;
+    double end_time;
+  };
+  string trace_filepath_;
+  vector<KernelTraceEvent> trace_events_;
+
+  void trace_write();
 };
 
 CCL_NAMESPACE_END
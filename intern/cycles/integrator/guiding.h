@@ -6,6 +6,8 @@
 
 #include "kernel/types.h"
 
+#include "util/string.h"
+
 CCL_NAMESPACE_BEGIN
 
 struct GuidingParams {
@@ -20,6 +22,9 @@ struct GuidingParams {
   float roughness_threshold = 0.05f;
   int training_samples = 128;
   bool deterministic = false;
+  /* File to continue training from, and to store the trained field in at the end of rendering.
+   * Used to warm start the field of consecutive animation frames. */
+  string field_filepath;
 
   GuidingParams() = default;
 
@@ -30,7 +35,8 @@ struct GuidingParams {
              (sampling_type == other.sampling_type) &&
              (training_samples == other.training_samples) &&
              (roughness_threshold == other.roughness_threshold) &&
-             (deterministic == other.deterministic));
+             (deterministic == other.deterministic) &&
+             (field_filepath == other.field_filepath));
   }
 };
 
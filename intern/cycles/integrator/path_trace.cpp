@@ -12,6 +12,7 @@
 #include "integrator/path_trace_tile.h"
 #include "integrator/render_scheduler.h"
 
+#include "scene/film.h"
 #include "scene/pass.h"
 #include "scene/scene.h"
 
@@ -19,7 +20,9 @@
 #include "session/tile.h"
 
 #include "util/log.h"
+#include "util/path.h"
 #include "util/progress.h"
+#include "util/system.h"
 #include "util/tbb.h"
 #include "util/time.h"
 
@@ -376,6 +379,12 @@ void PathTrace::init_render_buffers(const RenderWork &render_work)
     });
 
     tile_buffer_read();
+
+    warm_start_.num_samples = 0;
+    warm_start_apply();
+
+    warm_start_.camera = device_scene_->data.cam;
+    warm_start_.has_camera = true;
   }
 }
 
@@ -858,7 +867,253 @@ void PathTrace::cancel()
 
 int PathTrace::get_num_samples_in_buffer()
 {
-  return render_scheduler_.get_num_rendered_samples();
+  return render_scheduler_.get_num_rendered_samples() + warm_start_.num_samples;
+}
+
+/* Maximum number of samples the reprojected render counts as. Kept low, so that reprojection
+ * artifacts quickly blend out with the new samples. */
+static constexpr int kWarmStartMaxSamples = 4;
+
+static bool warm_start_supported(const BufferParams &params, const KernelCamera &camera)
+{
+  /* Only the full viewport without border is handled, where buffer and raster pixels match. */
+  return camera.type == CAMERA_PERSPECTIVE && params.full_x == 0 && params.full_y == 0 &&
+         params.window_x == 0 && params.window_y == 0 && params.window_width == params.width &&
+         params.window_height == params.height &&
+         params.get_pass_offset(PASS_COMBINED) != PASS_UNUSED &&
+         params.get_pass_offset(PASS_DEPTH) != PASS_UNUSED;
+}
+
+void PathTrace::capture_warm_start()
+{
+  if (!film_->get_use_viewport_warm_start() || film_->get_display_pass() != PASS_COMBINED ||
+      !warm_start_.has_camera)
+  {
+    return;
+  }
+
+  const BufferParams &params = render_state_.effective_big_tile_params;
+  const int num_samples = get_num_samples_in_buffer();
+  if (num_samples == 0 || !warm_start_supported(params, warm_start_.camera)) {
+    return;
+  }
+
+  /* During navigation only the first low resolution samples get rendered. Keep the render at the
+   * final resolution from before the navigation rather than replacing it with those. */
+  if (!warm_start_.source_color.empty() &&
+      render_state_.resolution_divider > warm_start_.source_resolution_divider)
+  {
+    return;
+  }
+
+  RenderBuffers buffers(cpu_device_.get());
+  buffers.reset(params);
+  copy_to_render_buffers(&buffers);
+
+  const int64_t num_pixels = int64_t(params.width) * params.height;
+  const int pass_stride = params.pass_stride;
+  const int pass_combined = params.get_pass_offset(PASS_COMBINED);
+  const int pass_depth = params.get_pass_offset(PASS_DEPTH);
+  const int pass_sample_count = params.get_pass_offset(PASS_SAMPLE_COUNT);
+
+  warm_start_.source_color.resize(num_pixels);
+  warm_start_.source_depth.resize(num_pixels);
+
+  const float *buffer = buffers.buffer.data();
+  for (int64_t i = 0; i < num_pixels; i++) {
+    const float *pixel = buffer + i * pass_stride;
+    const int pixel_num_samples = (pass_sample_count != PASS_UNUSED) ?
+                                      __float_as_uint(pixel[pass_sample_count]) :
+                                      num_samples;
+    const float4 color = make_float4(pixel[pass_combined + 0],
+                                     pixel[pass_combined + 1],
+                                     pixel[pass_combined + 2],
+                                     pixel[pass_combined + 3]);
+    warm_start_.source_color[i] = (pixel_num_samples) ? color / float(pixel_num_samples) :
+                                                        zero_float4();
+    warm_start_.source_depth[i] = pixel[pass_depth];
+  }
+
+  warm_start_.source_camera = warm_start_.camera;
+  warm_start_.source_resolution_divider = render_state_.resolution_divider;
+  warm_start_.source_width = params.width;
+  warm_start_.source_height = params.height;
+  warm_start_.source_num_samples = num_samples;
+}
+
+void PathTrace::clear_warm_start()
+{
+  warm_start_.source_color.clear();
+  warm_start_.source_color.shrink_to_fit();
+  warm_start_.source_depth.clear();
+  warm_start_.source_depth.shrink_to_fit();
+}
+
+void PathTrace::warm_start_apply()
+{
+  if (warm_start_.source_color.empty() || !film_->get_use_viewport_warm_start() ||
+      film_->get_display_pass() != PASS_COMBINED)
+  {
+    return;
+  }
+
+  const BufferParams &params = render_state_.effective_big_tile_params;
+  const KernelCamera &camera = device_scene_->data.cam;
+  if (render_state_.resolution_divider != warm_start_.source_resolution_divider ||
+      params.width != warm_start_.source_width || params.height != warm_start_.source_height ||
+      !warm_start_supported(params, camera))
+  {
+    return;
+  }
+
+  const int width = params.width;
+  const int height = params.height;
+  const int64_t num_pixels = int64_t(width) * height;
+
+  const KernelCamera &source_camera = warm_start_.source_camera;
+  const float3 camera_P = transform_get_column(&camera.cameratoworld, 3);
+  const float3 source_camera_P = transform_get_column(&source_camera.cameratoworld, 3);
+
+  /* Splat every pixel of the previous render to the new camera, keeping the nearest surface. The
+   * background has no depth and is reprojected by direction only. */
+  vector<float4> color(num_pixels, zero_float4());
+  vector<float> depth(num_pixels, FLT_MAX);
+  vector<bool> covered(num_pixels, false);
+  int64_t num_covered = 0;
+
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      const int64_t i = int64_t(y) * width + x;
+      const float source_depth = warm_start_.source_depth[i];
+      const float3 D = transform_perspective(&source_camera.rastertocamera,
+                                             make_float3(x + 0.5f, y + 0.5f, 0.0f));
+
+      float3 P;
+      float pixel_depth;
+      if (source_depth > 0.0f) {
+        P = transform_point(&source_camera.cameratoworld, D * (source_depth / D.z));
+        pixel_depth = transform_point(&camera.worldtocamera, P).z;
+        if (pixel_depth <= camera.nearclip) {
+          continue;
+        }
+      }
+      else {
+        const float3 dir = transform_direction(&source_camera.cameratoworld, D);
+        if (transform_direction(&camera.worldtocamera, dir).z <= 0.0f) {
+          continue;
+        }
+        P = camera_P + dir;
+        pixel_depth = FLT_MAX;
+      }
+
+      const float3 raster = transform_perspective(&camera.worldtoraster, P);
+      const int px = int(floorf(raster.x));
+      const int py = int(floorf(raster.y));
+      if (px < 0 || py < 0 || px >= width || py >= height) {
+        continue;
+      }
+
+      const int64_t j = int64_t(py) * width + px;
+      if (!covered[j] || pixel_depth < depth[j]) {
+        num_covered += !covered[j];
+        covered[j] = true;
+        color[j] = warm_start_.source_color[i];
+        depth[j] = pixel_depth;
+      }
+    }
+  }
+
+  /* A large camera move leaves too little of the previous render to be a useful estimate. */
+  if (num_covered < num_pixels / 2) {
+    VLOG_WORK << "Skipping viewport warm start, previous render covers " << num_covered << " of "
+              << num_pixels << " pixels.";
+    return;
+  }
+
+  /* Fill the holes left by the splatting. Gaps between magnified pixels take the farthest direct
+   * neighbor, as they are mostly uncovered background. Remaining pixels take the previous render
+   * in the same direction. */
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      const int64_t i = int64_t(y) * width + x;
+      if (covered[i]) {
+        continue;
+      }
+
+      int64_t fill = -1;
+      for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+          const int nx = x + dx;
+          const int ny = y + dy;
+          if (nx < 0 || ny < 0 || nx >= width || ny >= height) {
+            continue;
+          }
+          const int64_t j = int64_t(ny) * width + nx;
+          if (covered[j] && (fill == -1 || depth[j] > depth[fill])) {
+            fill = j;
+          }
+        }
+      }
+
+      if (fill != -1) {
+        color[i] = color[fill];
+        depth[i] = depth[fill];
+        continue;
+      }
+
+      const float3 D = transform_perspective(&camera.rastertocamera,
+                                             make_float3(x + 0.5f, y + 0.5f, 0.0f));
+      const float3 dir = transform_direction(&camera.cameratoworld, D);
+      const float3 raster = transform_perspective(&source_camera.worldtoraster,
+                                                  source_camera_P + dir);
+      const int sx = clamp(int(floorf(raster.x)), 0, width - 1);
+      const int sy = clamp(int(floorf(raster.y)), 0, height - 1);
+      color[i] = warm_start_.source_color[int64_t(sy) * width + sx];
+    }
+  }
+
+  /* Write the reprojection as a few samples worth of the combined pass. With adaptive sampling
+   * the per-pixel sample count and the auxiliary half buffer are set up to match. */
+  const int num_samples = min(warm_start_.source_num_samples, kWarmStartMaxSamples);
+
+  RenderBuffers buffers(cpu_device_.get());
+  buffers.reset(params);
+  buffers.zero();
+
+  const int pass_stride = params.pass_stride;
+  const int pass_combined = params.get_pass_offset(PASS_COMBINED);
+  const int pass_depth = params.get_pass_offset(PASS_DEPTH);
+  const int pass_sample_count = params.get_pass_offset(PASS_SAMPLE_COUNT);
+  const int pass_adaptive_aux_buffer = params.get_pass_offset(PASS_ADAPTIVE_AUX_BUFFER);
+
+  float *buffer = buffers.buffer.data();
+  for (int64_t i = 0; i < num_pixels; i++) {
+    float *pixel = buffer + i * pass_stride;
+    const float4 value = color[i] * float(num_samples);
+
+    pixel[pass_combined + 0] = value.x;
+    pixel[pass_combined + 1] = value.y;
+    pixel[pass_combined + 2] = value.z;
+    pixel[pass_combined + 3] = value.w;
+
+    /* Path tracing only writes depth for the first sample of a pixel. */
+    pixel[pass_depth] = (depth[i] != FLT_MAX) ? depth[i] : 0.0f;
+
+    if (pass_sample_count != PASS_UNUSED) {
+      pixel[pass_sample_count] = __uint_as_float(num_samples);
+    }
+    if (pass_adaptive_aux_buffer != PASS_UNUSED) {
+      pixel[pass_adaptive_aux_buffer + 0] = value.x;
+      pixel[pass_adaptive_aux_buffer + 1] = value.y;
+      pixel[pass_adaptive_aux_buffer + 2] = value.z;
+    }
+  }
+
+  copy_from_render_buffers(&buffers);
+
+  warm_start_.num_samples = num_samples;
+
+  VLOG_WORK << "Viewport warm start with " << num_samples << " samples of the previous render.";
 }
 
 bool PathTrace::is_cancel_requested()
@@ -1028,60 +1283,86 @@ static string get_layer_view_name(const RenderBuffers &buffers)
   return result;
 }
 
+/* Number of rows read around a band of the full frame buffer, to give the denoiser enough context
+ * at the band boundaries. */
+static constexpr int kFullFrameBandOverlap = 64;
+
 void PathTrace::process_full_buffer_from_disk(string_view filename)
 {
   VLOG_WORK << "Processing full frame buffer file " << filename;
 
-  progress_set_status("Reading full buffer from disk");
-
-  RenderBuffers full_frame_buffers(cpu_device_.get());
-
-  DenoiseParams denoise_params;
-  if (!tile_manager_.read_full_buffer_from_disk(filename, &full_frame_buffers, &denoise_params)) {
-    const string error_message = "Error reading tiles from file";
-    if (progress_) {
-      progress_->set_error(error_message);
-      progress_->set_cancel(error_message);
-    }
-    else {
-      LOG(ERROR) << error_message;
+  /* Process the frame in bands of rows of the render tile height, so that only a band of the
+   * full frame buffer is in memory at once. Bands are denoised with extra rows around them to
+   * avoid visible seams. */
+  const int2 tile_size = tile_manager_.get_tile_size();
+  const int band_height = (tile_size.y > 0) ? tile_size.y : INT_MAX;
+  const int band_overlap = (band_height != INT_MAX) ? kFullFrameBandOverlap : 0;
+
+  int full_height = 0;
+  int band_y = 0;
+  do {
+    progress_set_status("Reading full buffer from disk");
+
+    RenderBuffers full_frame_buffers(cpu_device_.get());
+
+    DenoiseParams denoise_params;
+    if (!tile_manager_.read_full_buffer_band_from_disk(filename,
+                                                       &full_frame_buffers,
+                                                       &denoise_params,
+                                                       band_y,
+                                                       band_height,
+                                                       band_overlap,
+                                                       &full_height))
+    {
+      const string error_message = "Error reading tiles from file";
+      if (progress_) {
+        progress_->set_error(error_message);
+        progress_->set_cancel(error_message);
+      }
+      else {
+        LOG(ERROR) << error_message;
+      }
+      return;
     }
-    return;
-  }
 
-  const string layer_view_name = get_layer_view_name(full_frame_buffers);
+    const string layer_view_name = get_layer_view_name(full_frame_buffers);
 
-  render_state_.has_denoised_result = false;
+    render_state_.has_denoised_result = false;
 
-  if (denoise_params.use && denoiser_ && !progress_->get_cancel()) {
-    progress_set_status(layer_view_name, "Denoising");
+    if (denoise_params.use && denoiser_ && !progress_->get_cancel()) {
+      progress_set_status(layer_view_name, "Denoising");
 
-    /* If GPU should be used is not based on file metadata. */
-    denoise_params.use_gpu = render_scheduler_.is_denoiser_gpu_used();
+      /* If GPU should be used is not based on file metadata. */
+      denoise_params.use_gpu = render_scheduler_.is_denoiser_gpu_used();
 
-    /* Re-use the denoiser as much as possible, avoiding possible device re-initialization.
-     *
-     * It will not conflict with the regular rendering as:
-     *  - Rendering is supposed to be finished here.
-     *  - The next rendering will go via Session's `run_update_for_next_iteration` which will
-     *    ensure proper denoiser is used. */
-    set_denoiser_params(denoise_params);
+      /* Re-use the denoiser as much as possible, avoiding possible device re-initialization.
+       *
+       * It will not conflict with the regular rendering as:
+       *  - Rendering is supposed to be finished here.
+       *  - The next rendering will go via Session's `run_update_for_next_iteration` which will
+       *    ensure proper denoiser is used. */
+      set_denoiser_params(denoise_params);
 
-    /* Number of samples doesn't matter too much, since the samples count pass will be used. */
-    denoiser_->denoise_buffer(full_frame_buffers.params, &full_frame_buffers, 0, false);
+      /* Number of samples doesn't matter too much, since the samples count pass will be used. */
+      denoiser_->denoise_buffer(full_frame_buffers.params, &full_frame_buffers, 0, false);
 
-    render_state_.has_denoised_result = true;
-  }
+      render_state_.has_denoised_result = true;
+    }
 
-  full_frame_state_.render_buffers = &full_frame_buffers;
+    full_frame_state_.render_buffers = &full_frame_buffers;
+    full_frame_state_.offset = make_int2(0, band_y);
 
-  progress_set_status(layer_view_name, "Finishing");
+    progress_set_status(layer_view_name, "Finishing");
 
-  /* Write the full result pretending that there is a single tile.
-   * Requires some state change, but allows to use same communication API with the software. */
-  tile_buffer_write();
+    /* Write the result pretending that the band is a single tile.
+     * Requires some state change, but allows to use same communication API with the software. */
+    tile_buffer_write();
+
+    full_frame_state_.render_buffers = nullptr;
+    full_frame_state_.offset = make_int2(0, 0);
 
-  full_frame_state_.render_buffers = nullptr;
+    band_y += band_height;
+  } while (band_y < full_height);
 }
 
 int PathTrace::get_num_render_tile_samples() const
@@ -1154,7 +1435,7 @@ int2 PathTrace::get_render_tile_size() const
 int2 PathTrace::get_render_tile_offset() const
 {
   if (full_frame_state_.render_buffers) {
-    return make_int2(0, 0);
+    return full_frame_state_.offset;
   }
 
   const Tile &tile = tile_manager_.get_current_tile();
@@ -1338,6 +1619,7 @@ void PathTrace::set_guiding_params(const GuidingParams &guiding_params, const bo
 #if defined(WITH_PATH_GUIDING)
   if (guiding_params_.modified(guiding_params)) {
     guiding_params_ = guiding_params;
+    guiding_warm_start_iteration_ = -1;
 
 #  if !(OPENPGL_VERSION_MAJOR == 0 && OPENPGL_VERSION_MINOR <= 5)
 #    define OPENPGL_USE_FIELD_CONFIG
@@ -1406,11 +1688,21 @@ void PathTrace::set_guiding_params(const GuidingParams &guiding_params, const bo
           device_->get_guiding_device());
       if (guiding_device) {
         guiding_sample_data_storage_ = make_unique<openpgl::cpp::SampleStorage>();
+        if (guiding_field_file_matches_config()) {
+          /* Warm start from the field trained for the previous frame. */
+          guiding_field_ = make_unique<openpgl::cpp::Field>(guiding_device,
+                                                            guiding_params_.field_filepath);
+          guiding_warm_start_iteration_ = guiding_field_->GetIteration();
+          VLOG_INFO << "Loaded path guiding field from " << guiding_params_.field_filepath
+                    << " at training iteration " << guiding_warm_start_iteration_;
+        }
+        else {
 #  ifdef OPENPGL_USE_FIELD_CONFIG
-        guiding_field_ = make_unique<openpgl::cpp::Field>(guiding_device, field_config);
+          guiding_field_ = make_unique<openpgl::cpp::Field>(guiding_device, field_config);
 #  else
-        guiding_field_ = make_unique<openpgl::cpp::Field>(guiding_device, field_args);
+          guiding_field_ = make_unique<openpgl::cpp::Field>(guiding_device, field_args);
 #  endif
+        }
       }
       else {
         guiding_sample_data_storage_ = nullptr;
@@ -1423,8 +1715,14 @@ void PathTrace::set_guiding_params(const GuidingParams &guiding_params, const bo
     }
   }
   else if (reset) {
-    if (guiding_field_) {
+    if (guiding_field_ && !guiding_params_.field_filepath.empty()) {
+      /* Scene changed while the session is kept alive, such as rendering the next frame with
+       * persistent data. Continue training from the current field instead of starting over. */
+      guiding_warm_start_iteration_ = guiding_field_->GetIteration();
+    }
+    else if (guiding_field_) {
       guiding_field_->Reset();
+      guiding_warm_start_iteration_ = -1;
     }
   }
 #else
@@ -1436,8 +1734,15 @@ void PathTrace::set_guiding_params(const GuidingParams &guiding_params, const bo
 void PathTrace::guiding_prepare_structures()
 {
 #if defined(WITH_PATH_GUIDING)
+  /* A warm started field only needs to adapt to the changes since the previous frame, so it is
+   * trained for a fraction of the training samples. */
+  const int training_samples = (guiding_warm_start_iteration_ >= 0) ?
+                                   max(guiding_params_.training_samples / 4, 1) :
+                                   guiding_params_.training_samples;
+  const int training_start_iteration = max(guiding_warm_start_iteration_, 0);
   const bool train = (guiding_params_.training_samples == 0) ||
-                     (guiding_field_->GetIteration() < guiding_params_.training_samples);
+                     (guiding_field_->GetIteration() <
+                      training_start_iteration + training_samples);
 
   for (auto &&path_trace_work : path_trace_works_) {
     path_trace_work->guiding_init_kernel_globals(
@@ -1458,6 +1763,87 @@ void PathTrace::guiding_prepare_structures()
 #endif
 }
 
+#if defined(WITH_PATH_GUIDING)
+/* OpenPGL does not store the field configuration in a way that can be queried after loading, so
+ * it is stored in a separate file next to the field. */
+static string guiding_field_config_filepath(const GuidingParams &guiding_params)
+{
+  return guiding_params.field_filepath + ".config";
+}
+
+static string guiding_field_config_key(const GuidingParams &guiding_params)
+{
+  return string_printf("openpgl %d.%d type %d deterministic %d max_depth 16",
+                       OPENPGL_VERSION_MAJOR,
+                       OPENPGL_VERSION_MINOR,
+                       int(guiding_params.type),
+                       int(guiding_params.deterministic));
+}
+
+/* Write to a temporary file first, so that other processes never read a partial file. */
+template<typename WriteFn>
+static bool guiding_write_file_atomic(const string &filepath, const WriteFn &write_fn)
+{
+  const string filepath_tmp = string_printf(
+      "%s.%llu.tmp", filepath.c_str(), (unsigned long long)system_self_process_id());
+  if (!write_fn(filepath_tmp) || std::rename(filepath_tmp.c_str(), filepath.c_str()) != 0) {
+    path_remove(filepath_tmp);
+    return false;
+  }
+  return true;
+}
+#endif
+
+bool PathTrace::guiding_field_file_matches_config() const
+{
+#if defined(WITH_PATH_GUIDING)
+  const string &filepath = guiding_params_.field_filepath;
+  if (filepath.empty() || !path_exists(filepath)) {
+    return false;
+  }
+
+  string config_key;
+  if (!path_read_text(guiding_field_config_filepath(guiding_params_), config_key) ||
+      config_key != guiding_field_config_key(guiding_params_))
+  {
+    VLOG_WARNING << "Path guiding field " << filepath
+                 << " was trained with different settings, training from scratch";
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void PathTrace::guiding_store_field()
+{
+#if defined(WITH_PATH_GUIDING)
+  if (!guiding_field_ || guiding_params_.field_filepath.empty() ||
+      guiding_field_->GetIteration() == 0)
+  {
+    return;
+  }
+
+  const string &filepath = guiding_params_.field_filepath;
+  string config_key = guiding_field_config_key(guiding_params_);
+  const bool config_stored = guiding_write_file_atomic(
+      guiding_field_config_filepath(guiding_params_),
+      [&](const string &filepath_tmp) { return path_write_text(filepath_tmp, config_key); });
+  const bool field_stored = config_stored &&
+                            guiding_write_file_atomic(filepath, [&](const string &filepath_tmp) {
+                              return guiding_field_->Store(filepath_tmp);
+                            });
+  if (!field_stored) {
+    VLOG_WARNING << "Failed to store path guiding field to " << filepath;
+    return;
+  }
+
+  VLOG_INFO << "Stored path guiding field to " << filepath << " at training iteration "
+            << guiding_field_->GetIteration();
+#endif
+}
+
 void PathTrace::guiding_update_structures()
 {
 #if defined(WITH_PATH_GUIDING)
@@ -12,6 +12,8 @@
 #include "integrator/path_trace_work.h"
 #include "integrator/work_balancer.h"
 
+#include "kernel/types.h"
+
 #include "session/buffers.h"
 
 #include "util/guiding.h"  // IWYU pragma: keep
@@ -72,6 +74,15 @@ class PathTrace {
 
   void device_free();
 
+  /* Keep the current viewport render, so that it can be reprojected to the camera of the next
+   * render and used as its starting estimate. Is to be called before resetting rendering when only
+   * the camera changed. */
+  void capture_warm_start();
+
+  /* Forget the render kept by capture_warm_start(). Is to be called when anything but the camera
+   * changed in the scene, so that the render is no longer a valid estimate. */
+  void clear_warm_start();
+
   /* Set progress tracker.
    * Used to communicate details about the progress to the outer world, check whether rendering is
    * to be canceled.
@@ -100,6 +111,10 @@ class PathTrace {
    * Use to setup the guiding structures before each rendering iteration. */
   void set_guiding_params(const GuidingParams &params, const bool reset);
 
+  /* Store the trained guiding field to the training cache file, if any.
+   * Called once a final render is finished, so that the next frame can continue training. */
+  void guiding_store_field();
+
   /* Sets output driver for render buffer output. */
   void set_output_driver(unique_ptr<OutputDriver> driver);
 
@@ -225,9 +240,16 @@ class PathTrace {
    * pointers to the global Field and SegmentStorage)*/
   void guiding_prepare_structures();
 
+  /* Whether the training cache file exists and was trained with the current field settings. */
+  bool guiding_field_file_matches_config() const;
+
   /* Get number of samples in the current state of the render buffers. */
   int get_num_samples_in_buffer();
 
+  /* Write the reprojection of the render kept by capture_warm_start() to the freshly initialized
+   * render buffers. */
+  void warm_start_apply();
+
   /* Check whether user requested to cancel rendering, so that path tracing is to be finished as
    * soon as possible. */
   bool is_cancel_requested();
@@ -303,6 +325,10 @@ class PathTrace {
 
   /* The number of already performed training iterations for the guiding field. */
   int guiding_update_count = 0;
+
+  /* Training iteration of the field when it was loaded from the training cache file, or -1 when
+   * the field was trained from scratch. */
+  int guiding_warm_start_iteration_ = -1;
 #endif
 
   /* State which is common for all the steps of the render work.
@@ -352,9 +378,34 @@ class PathTrace {
    * Used by `ready_to_reset()` to implement logic which feels the most interactive. */
   bool did_draw_after_reset_ = true;
 
+  /* Viewport warm start after camera navigation.
+   *
+   * The previous render is reprojected to the new camera using its depth, and written to the
+   * render buffers as if it was a few samples. New samples accumulate on top of it, so it blends
+   * out as rendering progresses. */
+  struct {
+    /* Camera used to render the samples which are currently in the render buffers. */
+    KernelCamera camera;
+    bool has_camera = false;
+
+    /* Camera, resolution divider, average color and depth of the render to be reprojected. */
+    KernelCamera source_camera;
+    int source_resolution_divider = 0;
+    int source_width = 0;
+    int source_height = 0;
+    int source_num_samples = 0;
+    vector<float4> source_color;
+    vector<float> source_depth;
+
+    /* Number of samples the reprojected render counts as in the current render buffers. */
+    int num_samples = 0;
+  } warm_start_;
+
   /* State of the full frame processing and writing to the software. */
   struct {
     RenderBuffers *render_buffers = nullptr;
+    /* Offset of the buffer window in the full frame, when processed in bands. */
+    int2 offset = make_int2(0, 0);
   } full_frame_state_;
 };
 
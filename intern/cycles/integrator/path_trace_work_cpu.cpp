@@ -32,6 +32,9 @@ static inline tbb::task_arena local_tbb_arena_create(const Device *device)
   return tbb::task_arena(device->info.cpu_threads);
 }
 
+/* Width and height in pixels of the blocks into which the image is split for rendering. */
+static constexpr int64_t kPixelBlockSize = 8;
+
 /* Get ThreadKernelGlobalsCPU for the current thread. */
 static inline ThreadKernelGlobalsCPU *kernel_thread_globals_get(
     vector<ThreadKernelGlobalsCPU> &kernel_thread_globals)
@@ -66,7 +69,14 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
 {
   const int64_t image_width = effective_buffer_params_.width;
   const int64_t image_height = effective_buffer_params_.height;
-  const int64_t total_pixels_num = image_width * image_height;
+
+  /* Pixels are rendered in small square blocks rather than in scanline order, so that paths
+   * traced by a thread one after another are spatially coherent. Rays of neighboring pixels
+   * traverse mostly the same BVH nodes and hit the same shaders and textures, which keeps that
+   * data in the CPU caches. */
+  const int64_t num_blocks_x = divide_up(image_width, kPixelBlockSize);
+  const int64_t num_blocks_y = divide_up(image_height, kPixelBlockSize);
+  const int64_t total_blocks_num = num_blocks_x * num_blocks_y;
 
   if (device_->profiler.active()) {
     for (ThreadKernelGlobalsCPU &kernel_globals : kernel_thread_globals_) {
@@ -76,28 +86,37 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
 
   tbb::task_arena local_arena = local_tbb_arena_create(device_);
   local_arena.execute([&]() {
-    parallel_for(int64_t(0), total_pixels_num, [&](int64_t work_index) {
-      if (is_cancel_requested()) {
-        return;
-      }
+    parallel_for(int64_t(0), total_blocks_num, [&](int64_t block_index) {
+      const int64_t block_y = block_index / num_blocks_x;
+      const int64_t block_x = block_index - block_y * num_blocks_x;
 
-      const int y = work_index / image_width;
-      const int x = work_index - y * image_width;
-
-      KernelWorkTile work_tile;
-      work_tile.x = effective_buffer_params_.full_x + x;
-      work_tile.y = effective_buffer_params_.full_y + y;
-      work_tile.w = 1;
-      work_tile.h = 1;
-      work_tile.start_sample = start_sample;
-      work_tile.sample_offset = sample_offset;
-      work_tile.num_samples = 1;
-      work_tile.offset = effective_buffer_params_.offset;
-      work_tile.stride = effective_buffer_params_.stride;
+      const int64_t x_start = block_x * kPixelBlockSize;
+      const int64_t y_start = block_y * kPixelBlockSize;
+      const int64_t x_end = min(x_start + kPixelBlockSize, image_width);
+      const int64_t y_end = min(y_start + kPixelBlockSize, image_height);
 
       ThreadKernelGlobalsCPU *kernel_globals = kernel_thread_globals_get(kernel_thread_globals_);
 
-      render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
+      for (int64_t y = y_start; y < y_end; y++) {
+        for (int64_t x = x_start; x < x_end; x++) {
+          if (is_cancel_requested()) {
+            return;
+          }
+
+          KernelWorkTile work_tile;
+          work_tile.x = effective_buffer_params_.full_x + x;
+          work_tile.y = effective_buffer_params_.full_y + y;
+          work_tile.w = 1;
+          work_tile.h = 1;
+          work_tile.start_sample = start_sample;
+          work_tile.sample_offset = sample_offset;
+          work_tile.num_samples = 1;
+          work_tile.offset = effective_buffer_params_.offset;
+          work_tile.stride = effective_buffer_params_.stride;
+
+          render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
+        }
+      }
     });
   });
   if (device_->profiler.active()) {
@@ -36,6 +36,20 @@ static double calculate_total_time(const vector<WorkBalanceInfo> &work_balance_i
   return total_time;
 }
 
+/* Slowest device took this much longer than the average to be considered a straggler. */
+static constexpr double kStragglerTimeFactor = 1.25;
+
+static bool has_straggler(const vector<WorkBalanceInfo> &work_balance_infos,
+                          const double time_average)
+{
+  for (const WorkBalanceInfo &info : work_balance_infos) {
+    if (info.time_spent > time_average * kStragglerTimeFactor) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /* The balance is based on equalizing time which devices spent performing a task. Assume that
  * average of the observed times is usable for estimating whether more or less work is to be
  * scheduled, and how difference in the work scheduling is needed. */
@@ -44,6 +58,13 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
 {
   const int num_infos = work_balance_infos.size();
 
+  for (const WorkBalanceInfo &info : work_balance_infos) {
+    if (info.time_spent <= 0) {
+      /* Not all devices did work since the last rebalance, nothing to base the balance on. */
+      return false;
+    }
+  }
+
   const double total_time = calculate_total_time(work_balance_infos);
   const double time_average = total_time / num_infos;
 
@@ -58,15 +79,23 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
    * to do 5% less of the current work, and another needs to do 5% more. */
   const double lerp_weight = 1.0 / num_infos;
 
+  /* When one of the devices is much slower than the others it gates every render iteration, and
+   * the damped convergence would leave the other devices idle for many iterations. In this case
+   * jump directly to weights proportional to the measured throughput of every device. */
+  const double balance_lerp_weight = has_straggler(work_balance_infos, time_average) ?
+                                         1.0 :
+                                         lerp_weight;
+
   bool has_big_difference = false;
 
   for (const WorkBalanceInfo &info : work_balance_infos) {
-    const double time_target = mix(info.time_spent, time_average, lerp_weight);
+    const double time_target = mix(info.time_spent, time_average, balance_lerp_weight);
     const double new_weight = info.weight * time_target / info.time_spent;
     new_weights.push_back(new_weight);
     total_weight += new_weight;
 
-    if (std::fabs(1.0 - time_target / time_average) > 0.02) {
+    const double time_target_damped = mix(info.time_spent, time_average, lerp_weight);
+    if (std::fabs(1.0 - time_target_damped / time_average) > 0.02) {
       has_big_difference = true;
     }
   }
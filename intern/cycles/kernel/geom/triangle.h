@@ -96,9 +96,9 @@ ccl_device_inline void triangle_vertices_and_normals(KernelGlobals kg,
   P[1] = kernel_data_fetch(tri_verts, tri_vindex.y);
   P[2] = kernel_data_fetch(tri_verts, tri_vindex.z);
 
-  N[0] = kernel_data_fetch(tri_vnormal, tri_vindex.x);
-  N[1] = kernel_data_fetch(tri_vnormal, tri_vindex.y);
-  N[2] = kernel_data_fetch(tri_vnormal, tri_vindex.z);
+  N[0] = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.x));
+  N[1] = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.y));
+  N[2] = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.z));
 }
 
 /* Interpolate smooth vertex normal from vertices */
@@ -109,9 +109,9 @@ triangle_smooth_normal(KernelGlobals kg, const float3 Ng, const int prim, const
   /* load triangle vertices */
   const uint3 tri_vindex = kernel_data_fetch(tri_vindex, prim);
 
-  const float3 n0 = kernel_data_fetch(tri_vnormal, tri_vindex.x);
-  const float3 n1 = kernel_data_fetch(tri_vnormal, tri_vindex.y);
-  const float3 n2 = kernel_data_fetch(tri_vnormal, tri_vindex.z);
+  const float3 n0 = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.x));
+  const float3 n1 = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.y));
+  const float3 n2 = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.z));
 
   const float3 N = safe_normalize((1.0f - u - v) * n0 + u * n1 + v * n2);
 
@@ -133,9 +133,9 @@ ccl_device_inline float3 triangle_smooth_normal(KernelGlobals kg,
   /* Load triangle vertices. */
   const uint3 tri_vindex = kernel_data_fetch(tri_vindex, prim);
 
-  const float3 n0 = kernel_data_fetch(tri_vnormal, tri_vindex.x);
-  const float3 n1 = kernel_data_fetch(tri_vnormal, tri_vindex.y);
-  const float3 n2 = kernel_data_fetch(tri_vnormal, tri_vindex.z);
+  const float3 n0 = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.x));
+  const float3 n1 = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.y));
+  const float3 n2 = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.z));
 
   const float3 N = safe_normalize(triangle_interpolate(u, v, n0, n1, n2));
   N_x = safe_normalize(triangle_interpolate(u + du.dx, v + dv.dx, n0, n1, n2));
@@ -156,9 +156,9 @@ ccl_device_inline float3 triangle_smooth_normal_unnormalized(KernelGlobals kg,
   /* load triangle vertices */
   const uint3 tri_vindex = kernel_data_fetch(tri_vindex, prim);
 
-  float3 n0 = kernel_data_fetch(tri_vnormal, tri_vindex.x);
-  float3 n1 = kernel_data_fetch(tri_vnormal, tri_vindex.y);
-  float3 n2 = kernel_data_fetch(tri_vnormal, tri_vindex.z);
+  float3 n0 = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.x));
+  float3 n1 = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.y));
+  float3 n2 = decode_octahedral_normal(kernel_data_fetch(tri_vnormal, tri_vindex.z));
 
   /* ensure that the normals are in object space */
   if (sd->object_flag & SD_OBJECT_TRANSFORM_APPLIED) {
@@ -122,6 +122,8 @@ NODE_DEFINE(Film)
 
   SOCKET_BOOLEAN(use_sample_count, "Use Sample Count Pass", false);
 
+  SOCKET_BOOLEAN(use_viewport_warm_start, "Use Viewport Warm Start", false);
+
   return type;
 }
 
@@ -570,6 +572,13 @@ void Film::update_passes(Scene *scene)
     }
   }
 
+  /* Add depth pass to reproject the previous viewport render after camera navigation. */
+  if (use_viewport_warm_start) {
+    if (!Pass::contains(scene->passes, PASS_DEPTH)) {
+      add_auto_pass(scene, PASS_DEPTH);
+    }
+  }
+
   /* Remove duplicates and initialize internal pass info. */
   finalize_passes(scene, use_denoise);
 
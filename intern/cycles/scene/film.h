@@ -52,6 +52,8 @@ class Film : public Node {
 
   NODE_SOCKET_API(bool, use_sample_count)
 
+  NODE_SOCKET_API(bool, use_viewport_warm_start)
+
  private:
   size_t filter_table_offset_;
   bool prev_have_uv_pass = false;
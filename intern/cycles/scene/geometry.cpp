@@ -449,7 +449,14 @@ void GeometryManager::device_update_preprocess(Device *device, Scene *scene, Pro
         device_update_flags |= DEVICE_MESH_DATA_NEEDS_REALLOC;
       }
       else if (mesh->is_modified()) {
-        device_update_flags |= DEVICE_MESH_DATA_MODIFIED;
+        /* Only tag the arrays whose source sockets changed, so that e.g. sculpting does not
+         * upload the shader array and editing materials does not upload the vertices. */
+        if (mesh->verts_is_modified()) {
+          device_update_flags |= DEVICE_MESH_DATA_MODIFIED;
+        }
+        if (mesh->shader_is_modified() || mesh->smooth_is_modified()) {
+          device_update_flags |= DEVICE_MESH_SHADER_MODIFIED;
+        }
       }
     }
 
@@ -557,11 +564,14 @@ void GeometryManager::device_update_preprocess(Device *device, Scene *scene, Pro
     dscene->attributes_uchar4.tag_modified();
   }
 
+  /* if anything else than vertices or shaders are modified, we would need to reallocate, so
+   * these are the only arrays that can be updated */
   if (device_update_flags & DEVICE_MESH_DATA_MODIFIED) {
-    /* if anything else than vertices or shaders are modified, we would need to reallocate, so
-     * these are the only arrays that can be updated */
     dscene->tri_verts.tag_modified();
     dscene->tri_vnormal.tag_modified();
+  }
+
+  if (device_update_flags & DEVICE_MESH_SHADER_MODIFIED) {
     dscene->tri_shader.tag_modified();
   }
 
@@ -54,6 +54,9 @@ enum {
 
   ATTR_UCHAR4_NEEDS_REALLOC = (1 << 15),
 
+  /* Triangle shaders or smooth flags changed, independently of the vertex data. */
+  DEVICE_MESH_SHADER_MODIFIED = (1 << 16),
+
   ATTRS_NEED_REALLOC = (ATTR_FLOAT_NEEDS_REALLOC | ATTR_FLOAT2_NEEDS_REALLOC |
                         ATTR_FLOAT3_NEEDS_REALLOC | ATTR_FLOAT4_NEEDS_REALLOC |
                         ATTR_UCHAR4_NEEDS_REALLOC),
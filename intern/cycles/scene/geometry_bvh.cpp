@@ -82,6 +82,7 @@ void Geometry::compute_bvh(Device *device,
       bparams.num_motion_point_steps = params->num_bvh_time_steps;
       bparams.bvh_type = params->bvh_type;
       bparams.curve_subdivisions = params->curve_subdivisions();
+      bparams.use_disk_cache = params->use_bvh_disk_cache;
 
       bvh = BVH::create(bparams, geometry, objects, device);
       MEM_GUARDED_CALL(progress, device->build_bvh, bvh.get(), *progress, false);
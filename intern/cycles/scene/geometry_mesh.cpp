@@ -65,7 +65,7 @@ void GeometryManager::device_update_mesh(Device * /*unused*/,
 
     packed_float3 *tri_verts = dscene->tri_verts.alloc(vert_size);
     uint *tri_shader = dscene->tri_shader.alloc(tri_size);
-    packed_float3 *vnormal = dscene->tri_vnormal.alloc(vert_size);
+    uint *vnormal = dscene->tri_vnormal.alloc(vert_size);
     packed_uint3 *tri_vindex = dscene->tri_vindex.alloc(tri_size);
 
     const bool copy_all_data = dscene->tri_shader.need_realloc() ||
@@ -86,8 +86,12 @@ void GeometryManager::device_update_mesh(Device * /*unused*/,
           mesh->pack_normals(&vnormal[mesh->vert_offset]);
         }
 
-        if (mesh->verts_is_modified() || mesh->triangles_is_modified() || copy_all_data) {
-          mesh->pack_verts(&tri_verts[mesh->vert_offset], &tri_vindex[mesh->prim_offset]);
+        if (mesh->verts_is_modified() || copy_all_data) {
+          mesh->pack_verts(&tri_verts[mesh->vert_offset]);
+        }
+
+        if (mesh->triangles_is_modified() || copy_all_data) {
+          mesh->pack_triangles(&tri_vindex[mesh->prim_offset]);
         }
 
         if (progress.get_cancel()) {
@@ -60,6 +60,61 @@ const char *name_from_type(ImageDataType type)
   return "";
 }
 
+/* Size in bytes of a single texel as stored on the device, or 0 for sparse volume types
+ * that are not stored as a dense grid. */
+size_t texel_size_from_type(ImageDataType type)
+{
+  switch (type) {
+    case IMAGE_DATA_TYPE_FLOAT4:
+      return sizeof(float) * 4;
+    case IMAGE_DATA_TYPE_FLOAT:
+      return sizeof(float);
+    case IMAGE_DATA_TYPE_BYTE4:
+      return sizeof(uchar) * 4;
+    case IMAGE_DATA_TYPE_BYTE:
+      return sizeof(uchar);
+    case IMAGE_DATA_TYPE_HALF4:
+      return sizeof(half) * 4;
+    case IMAGE_DATA_TYPE_HALF:
+      return sizeof(half);
+    case IMAGE_DATA_TYPE_USHORT4:
+      return sizeof(uint16_t) * 4;
+    case IMAGE_DATA_TYPE_USHORT:
+      return sizeof(uint16_t);
+    case IMAGE_DATA_TYPE_NANOVDB_FLOAT:
+    case IMAGE_DATA_TYPE_NANOVDB_FLOAT3:
+    case IMAGE_DATA_TYPE_NANOVDB_FPN:
+    case IMAGE_DATA_TYPE_NANOVDB_FP16:
+    case IMAGE_DATA_NUM_TYPES:
+      return 0;
+  }
+  return 0;
+}
+
+/* Memory used by an image once it is scaled down to fit the given resolution limit, using the
+ * same power of two scale factor as #ImageManager::file_load_image. */
+size_t image_memory_size_for_limit(const ImageMetaData &metadata, const int texture_limit)
+{
+  const size_t max_size = max(max(metadata.width, metadata.height), metadata.depth);
+  size_t width = metadata.width;
+  size_t height = metadata.height;
+  size_t depth = metadata.depth;
+
+  if (texture_limit > 0 && max_size > texture_limit) {
+    float scale_factor = 1.0f;
+    while (max_size * scale_factor > texture_limit) {
+      scale_factor *= 0.5f;
+    }
+    width = max((size_t)(width * scale_factor), (size_t)1);
+    height = max((size_t)(height * scale_factor), (size_t)1);
+    if (depth > 1) {
+      depth = max((size_t)(depth * scale_factor), (size_t)1);
+    }
+  }
+
+  return width * height * depth * texel_size_from_type(metadata.type);
+}
+
 }  // namespace
 
 /* Image Handle */
@@ -310,6 +365,7 @@ ImageManager::ImageManager(const DeviceInfo &info)
   need_update_ = true;
   osl_texture_system = nullptr;
   animation_frame = 0;
+  memory_texture_limit_ = 0;
 
   /* Set image limits */
   features.has_nanovdb = info.has_nanovdb;
@@ -706,7 +762,11 @@ void ImageManager::device_load_image(Device *device,
 
   progress.set_status("Updating Images", "Loading " + img->loader->name());
 
-  const int texture_limit = scene->params.texture_limit;
+  int texture_limit = scene->params.texture_limit;
+  if (memory_texture_limit_ > 0) {
+    texture_limit = (texture_limit > 0) ? min(texture_limit, memory_texture_limit_) :
+                                          memory_texture_limit_;
+  }
 
   load_image_metadata(img);
   const ImageDataType type = img->metadata.type;
@@ -857,6 +917,85 @@ void ImageManager::device_free_image(Device * /*unused*/, size_t slot)
   images[slot].reset();
 }
 
+int ImageManager::texture_limit_for_memory_budget(const Scene *scene)
+{
+  const size_t memory_limit = scene->params.texture_memory_limit;
+  if (memory_limit == 0) {
+    return 0;
+  }
+
+  /* Sparse volume grids can not be resized, so they are always counted at full size. */
+  size_t fixed_size = 0;
+  size_t full_size = 0;
+  size_t max_resolution = 0;
+  for (const unique_ptr<Image> &img : images) {
+    if (!img || img->users == 0) {
+      continue;
+    }
+
+    load_image_metadata(img.get());
+    const ImageMetaData &metadata = img->metadata;
+    if (texel_size_from_type(metadata.type) == 0) {
+      fixed_size += metadata.byte_size;
+      continue;
+    }
+
+    full_size += image_memory_size_for_limit(metadata, scene->params.texture_limit);
+    max_resolution = max(max_resolution,
+                         max(max(metadata.width, metadata.height), metadata.depth));
+  }
+
+  if (fixed_size + full_size <= memory_limit) {
+    return 0;
+  }
+
+  /* Lower the resolution limit by powers of two until all images fit. Every image keeps at
+   * least a single texel, so this is bounded even when the budget can never be met. */
+  int texture_limit = (int)next_power_of_two((uint)max_resolution);
+  if (scene->params.texture_limit > 0) {
+    texture_limit = min(texture_limit, scene->params.texture_limit);
+  }
+
+  while (texture_limit > 1) {
+    texture_limit /= 2;
+
+    size_t total_size = fixed_size;
+    for (const unique_ptr<Image> &img : images) {
+      if (img && img->users != 0 && texel_size_from_type(img->metadata.type) != 0) {
+        total_size += image_memory_size_for_limit(img->metadata, texture_limit);
+      }
+    }
+
+    if (total_size <= memory_limit) {
+      break;
+    }
+  }
+
+  VLOG_INFO << "Limiting texture resolution to " << texture_limit << " to fit "
+            << string_human_readable_size(full_size)
+            << " of images into the texture memory limit of "
+            << string_human_readable_size(memory_limit) << ".";
+
+  return texture_limit;
+}
+
+void ImageManager::update_memory_texture_limit(const Scene *scene)
+{
+  const int texture_limit = texture_limit_for_memory_budget(scene);
+  if (texture_limit == memory_texture_limit_) {
+    return;
+  }
+
+  /* Images that were already loaded at a different resolution need to be reloaded, so that
+   * the budget is shared fairly between old and new images. */
+  memory_texture_limit_ = texture_limit;
+  for (const unique_ptr<Image> &img : images) {
+    if (img && img->users != 0 && img->mem) {
+      img->need_load = true;
+    }
+  }
+}
+
 void ImageManager::device_update(Device *device, Scene *scene, Progress &progress)
 {
   if (!need_update()) {
@@ -869,6 +1008,8 @@ void ImageManager::device_update(Device *device, Scene *scene, Progress &progres
     }
   });
 
+  update_memory_texture_limit(scene);
+
   TaskPool pool;
   for (size_t slot = 0; slot < images.size(); slot++) {
     Image *img = images[slot].get();
@@ -911,6 +1052,8 @@ void ImageManager::device_load_builtin(Device *device, Scene *scene, Progress &p
     return;
   }
 
+  update_memory_texture_limit(scene);
+
   TaskPool pool;
   for (size_t slot = 0; slot < images.size(); slot++) {
     Image *img = images[slot].get();
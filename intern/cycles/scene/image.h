@@ -215,6 +215,10 @@ class ImageManager {
   thread_mutex images_mutex;
   int animation_frame;
 
+  /* Resolution limit derived from the texture memory limit of the scene, 0 if all images fit
+   * at their full resolution. */
+  int memory_texture_limit_;
+
   vector<unique_ptr<Image>> images;
   void *osl_texture_system;
 
@@ -227,6 +231,9 @@ class ImageManager {
 
   void load_image_metadata(Image *img);
 
+  int texture_limit_for_memory_budget(const Scene *scene);
+  void update_memory_texture_limit(const Scene *scene);
+
   template<TypeDesc::BASETYPE FileFormat, typename StorageType>
   bool file_load_image(Image *img, const int texture_limit);
 
@@ -4,8 +4,11 @@
 
 #include "scene/image_vdb.h"
 
+#include "util/algorithm.h"
 #include "util/log.h"
 #include "util/openvdb.h"
+#include "util/thread.h"
+#include "util/vector.h"
 
 #ifdef WITH_OPENVDB
 #  include <openvdb/tools/Dense.h>
@@ -126,6 +129,100 @@ struct ToNanoOp {
     }
   }
 };
+
+/* Converted NanoVDB grids, shared between loaders of the same OpenVDB grid.
+ *
+ * Blender keeps grids in a file cache, so a volume sequence or a static volume gives the same
+ * OpenVDB grid across frames and re-renders. Keeping the conversion result for as long as the
+ * OpenVDB grid is alive avoids converting it again. Entries hold a weak reference to the grid,
+ * and are removed once it is freed.
+ *
+ * The cached grids are host copies of data that is also uploaded to the device, so their total
+ * size is bounded, removing the least recently used grids first. */
+class NanoGridCache {
+ public:
+  static constexpr size_t max_bytes = size_t(1) << 30;
+
+  std::shared_ptr<nanovdb::GridHandle<>> find(const openvdb::GridBase::ConstPtr &grid,
+                                              const int precision)
+  {
+    const thread_scoped_lock lock(mutex_);
+
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->precision == precision && it->grid.lock() == grid &&
+          it->num_active_voxels == grid->activeVoxelCount())
+      {
+        /* Move to the back, which holds the most recently used entries. */
+        std::rotate(it, it + 1, entries_.end());
+        return entries_.back().nanogrid;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void add(const openvdb::GridBase::ConstPtr &grid,
+           const int precision,
+           std::shared_ptr<nanovdb::GridHandle<>> nanogrid)
+  {
+    const size_t size = nanogrid->size();
+    if (size > max_bytes) {
+      return;
+    }
+
+    const thread_scoped_lock lock(mutex_);
+
+    remove_if([&](const Entry &entry) {
+      return entry.grid.expired() || (entry.grid.lock() == grid && entry.precision == precision);
+    });
+
+    while (!entries_.empty() && total_bytes_ + size > max_bytes) {
+      total_bytes_ -= entries_.front().nanogrid->size();
+      entries_.erase(entries_.begin());
+    }
+
+    entries_.push_back({grid, precision, grid->activeVoxelCount(), std::move(nanogrid)});
+    total_bytes_ += size;
+  }
+
+  /* Remove the grids whose OpenVDB grid was freed. */
+  void remove_expired()
+  {
+    const thread_scoped_lock lock(mutex_);
+    remove_if([](const Entry &entry) { return entry.grid.expired(); });
+  }
+
+ private:
+  struct Entry {
+    std::weak_ptr<const openvdb::GridBase> grid;
+    int precision;
+    /* Guards against grids which are modified in place. */
+    openvdb::Index64 num_active_voxels;
+    std::shared_ptr<nanovdb::GridHandle<>> nanogrid;
+  };
+
+  template<typename Fn> void remove_if(const Fn &fn)
+  {
+    /* Unlike #std::remove_if, the removed entries stay valid to update the total size. */
+    auto new_end = std::stable_partition(
+        entries_.begin(), entries_.end(), [&](const Entry &entry) { return !fn(entry); });
+    for (auto it = new_end; it != entries_.end(); ++it) {
+      total_bytes_ -= it->nanogrid->size();
+    }
+    entries_.erase(new_end, entries_.end());
+  }
+
+  thread_mutex mutex_;
+  /* Ordered from least to most recently used. */
+  vector<Entry> entries_;
+  size_t total_bytes_ = 0;
+};
+
+static NanoGridCache &nano_grid_cache()
+{
+  static NanoGridCache cache;
+  return cache;
+}
 #  endif
 
 VDBImageLoader::VDBImageLoader(openvdb::GridBase::ConstPtr grid_, const string &grid_name)
@@ -162,12 +259,21 @@ bool VDBImageLoader::load_metadata(const ImageDeviceFeatures &features, ImageMet
     openvdb::tools::pruneInactive(pruned_grid.tree());
     nanogrid = nanovdb::openToNanoVDB(pruned_grid);
 #    endif
-    ToNanoOp op;
-    op.precision = precision;
-    if (!openvdb::grid_type_operation(grid, op)) {
-      return false;
+    nanogrid = nano_grid_cache().find(grid, precision);
+    if (!nanogrid) {
+      ToNanoOp op;
+      op.precision = precision;
+      if (!openvdb::grid_type_operation(grid, op)) {
+        return false;
+      }
+      if (op.nanogrid) {
+        nanogrid = std::make_shared<nanovdb::GridHandle<>>(std::move(op.nanogrid));
+        nano_grid_cache().add(grid, precision, nanogrid);
+      }
+    }
+    else {
+      VLOG_INFO << "Reusing NanoVDB conversion of grid " << grid_name;
     }
-    nanogrid = std::move(op.nanogrid);
   }
 #  endif
 
@@ -184,7 +290,7 @@ bool VDBImageLoader::load_metadata(const ImageDeviceFeatures &features, ImageMet
 
 #  ifdef WITH_NANOVDB
   if (nanogrid) {
-    metadata.byte_size = nanogrid.size();
+    metadata.byte_size = nanogrid->size();
     if (metadata.channels == 1) {
       if (precision == 0) {
         metadata.type = IMAGE_DATA_TYPE_NANOVDB_FPN;
@@ -255,7 +361,7 @@ bool VDBImageLoader::load_pixels(const ImageMetaData & /*metadata*/,
 #ifdef WITH_OPENVDB
 #  ifdef WITH_NANOVDB
   if (nanogrid) {
-    memcpy(pixels, nanogrid.data(), nanogrid.size());
+    memcpy(pixels, nanogrid->data(), nanogrid->size());
   }
   else
 #  endif
@@ -296,6 +402,9 @@ void VDBImageLoader::cleanup()
 #endif
 #ifdef WITH_NANOVDB
   nanogrid.reset();
+  /* Converted grids are not needed anymore once uploaded, unless their OpenVDB grid is kept by
+   * another owner for a following render. */
+  nano_grid_cache().remove_expired();
 #endif
 }
 
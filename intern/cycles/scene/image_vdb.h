@@ -8,6 +8,8 @@
 #  include <openvdb/openvdb.h>
 #endif
 #ifdef WITH_NANOVDB
+#  include <memory>
+
 #  include <nanovdb/NanoVDB.h>
 #  if NANOVDB_MAJOR_VERSION_NUMBER > 32 || \
       (NANOVDB_MAJOR_VERSION_NUMBER == 32 && NANOVDB_MINOR_VERSION_NUMBER >= 7)
@@ -55,7 +57,8 @@ class VDBImageLoader : public ImageLoader {
   openvdb::CoordBBox bbox;
 #endif
 #ifdef WITH_NANOVDB
-  nanovdb::GridHandle<> nanogrid;
+  /* Shared with other loaders of the same OpenVDB grid, see #NanoGridCache. */
+  std::shared_ptr<nanovdb::GridHandle<>> nanogrid;
   int precision = 0;
 #endif
 };
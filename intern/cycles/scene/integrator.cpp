@@ -90,6 +90,7 @@ NODE_DEFINE(Integrator)
               guiding_directional_sampling_type_enum,
               GUIDING_DIRECTIONAL_SAMPLING_TYPE_RIS);
   SOCKET_FLOAT(guiding_roughness_threshold, "Guiding Roughness Threshold", 0.05f);
+  SOCKET_STRING(guiding_field_filepath, "Guiding Field Filepath", ustring());
 
   SOCKET_BOOLEAN(caustics_reflective, "Reflective Caustics", true);
   SOCKET_BOOLEAN(caustics_refractive, "Refractive Caustics", true);
@@ -474,6 +475,7 @@ GuidingParams Integrator::get_guiding_params(const Device *device) const
   guiding_params.type = guiding_distribution_type;
   guiding_params.training_samples = guiding_training_samples;
   guiding_params.deterministic = deterministic_guiding;
+  guiding_params.field_filepath = guiding_field_filepath.string();
   guiding_params.sampling_type = guiding_directional_sampling_type;
   // In Blender/Cycles the user set roughness is squared to behave more linear.
   guiding_params.roughness_threshold = guiding_roughness_threshold * guiding_roughness_threshold;
@@ -56,6 +56,7 @@ class Integrator : public Node {
   NODE_SOCKET_API(GuidingDistributionType, guiding_distribution_type);
   NODE_SOCKET_API(GuidingDirectionalSamplingType, guiding_directional_sampling_type);
   NODE_SOCKET_API(float, guiding_roughness_threshold);
+  NODE_SOCKET_API(ustring, guiding_field_filepath);
 
   NODE_SOCKET_API(bool, caustics_reflective)
   NODE_SOCKET_API(bool, caustics_refractive)
@@ -232,8 +232,11 @@ LightManager::LightManager()
   need_update_background = true;
   last_background_enabled = false;
   last_background_resolution = 0;
+  light_tree_mesh_cache = make_unique<LightTreeMeshCache>();
 }
 
+LightManager::~LightManager() = default;
+
 bool LightManager::has_background_light(Scene *scene)
 {
   for (Object *object : scene->objects) {
@@ -825,6 +828,7 @@ void LightManager::device_update_tree(Device * /*unused*/,
   KernelIntegrator *kintegrator = &dscene->data.integrator;
 
   if (!kintegrator->use_light_tree) {
+    light_tree_mesh_cache->entries.clear();
     return;
   }
 
@@ -833,7 +837,7 @@ void LightManager::device_update_tree(Device * /*unused*/,
 
   /* TODO: For now, we'll start with a smaller number of max lights in a node.
    * More benchmarking is needed to determine what number works best. */
-  LightTree light_tree(scene, dscene, progress, 8);
+  LightTree light_tree(scene, dscene, progress, 8, light_tree_mesh_cache.get());
   LightTreeNode *root = light_tree.build(scene, dscene);
   if (progress.get_cancel()) {
     return;
@@ -21,6 +21,7 @@ CCL_NAMESPACE_BEGIN
 class Device;
 class DeviceScene;
 class Object;
+struct LightTreeMeshCache;
 class Progress;
 class Scene;
 class Shader;
@@ -104,6 +105,7 @@ class LightManager {
   bool need_update_background;
 
   LightManager();
+  ~LightManager();
 
   /* IES texture management */
   int add_ies(const string &content);
@@ -151,6 +153,9 @@ class LightManager {
   bool last_background_enabled;
   int last_background_resolution;
 
+  /* Subtrees of emissive meshes, reused by the next light tree build. */
+  unique_ptr<LightTreeMeshCache> light_tree_mesh_cache;
+
   uint32_t update_flags;
 };
 
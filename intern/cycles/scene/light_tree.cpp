@@ -7,6 +7,7 @@
 #include "scene/object.h"
 
 #include "util/math_fast.h"
+#include "util/md5.h"
 #include "util/progress.h"
 
 CCL_NAMESPACE_BEGIN
@@ -82,6 +83,16 @@ LightTreeEmitter::LightTreeEmitter(Object *object, const int object_id) : object
   light_set_membership = object->get_light_set_membership();
 }
 
+LightTreeEmitter::LightTreeEmitter(const LightTreeEmitter &other, const int object_id)
+    : prim_id(other.prim_id),
+      object_id(object_id),
+      centroid(other.centroid),
+      light_set_membership(other.light_set_membership),
+      measure(other.measure)
+{
+  assert(other.is_triangle());
+}
+
 LightTreeEmitter::LightTreeEmitter(Scene *scene,
                                    const int prim_id,
                                    const int object_id,
@@ -281,11 +292,95 @@ void LightTree::add_mesh(Scene *scene, Mesh *mesh, const int object_id)
   }
 }
 
+/* Hash of all the data that the emitters and subtree of a mesh are computed from. The object is
+ * the first one instancing the mesh, whose light set membership the emitters inherit. */
+static string light_tree_mesh_cache_key(const Mesh *mesh, const Object *object)
+{
+  MD5Hash md5;
+
+  md5.append((const uint8_t *)&mesh->transform_applied, sizeof(mesh->transform_applied));
+  const bool negative_scale = mesh->transform_applied &&
+                              transform_negative_scale(object->get_tfm());
+  md5.append((const uint8_t *)&negative_scale, sizeof(negative_scale));
+  const uint64_t light_set_membership = object->get_light_set_membership();
+  md5.append((const uint8_t *)&light_set_membership, sizeof(light_set_membership));
+
+  for (const Node *node : mesh->get_used_shaders()) {
+    const Shader *shader = static_cast<const Shader *>(node);
+    md5.append((const uint8_t *)&shader->emission_estimate, sizeof(float) * 3);
+    md5.append((const uint8_t *)&shader->emission_sampling, sizeof(shader->emission_sampling));
+  }
+
+  /* Don't hash 4th element used for padding. */
+  for (const float3 &vert : mesh->get_verts()) {
+    md5.append((const uint8_t *)&vert, sizeof(float) * 3);
+  }
+  md5.append((const uint8_t *)mesh->get_triangles().data(),
+             mesh->get_triangles().size() * sizeof(int));
+  md5.append((const uint8_t *)mesh->get_shader().data(), mesh->get_shader().size() * sizeof(int));
+
+  return md5.get_hex();
+}
+
+static int light_tree_node_count(const LightTreeNode &node)
+{
+  if (node.is_inner()) {
+    return 1 + light_tree_node_count(*node.get_inner().children[LightTree::left]) +
+           light_tree_node_count(*node.get_inner().children[LightTree::right]);
+  }
+  return 1;
+}
+
+/* Deep copy of a subtree, with emitter indices of leaf nodes shifted by the given offset. */
+static unique_ptr<LightTreeNode> light_tree_node_copy(const LightTreeNode &node,
+                                                      const int emitter_offset)
+{
+  unique_ptr<LightTreeNode> new_node = make_unique<LightTreeNode>(node.measure, node.bit_trail);
+  new_node->object_id = node.object_id;
+  new_node->light_link = node.light_link;
+  new_node->light_link.shared_node_index = -1;
+
+  if (node.is_leaf()) {
+    new_node->make_leaf(node.get_leaf().first_emitter_index + emitter_offset,
+                        node.get_leaf().num_emitters);
+  }
+  else {
+    assert(node.is_inner());
+    for (int i = 0; i < 2; i++) {
+      new_node->get_inner().children[i] = light_tree_node_copy(*node.get_inner().children[i],
+                                                               emitter_offset);
+    }
+  }
+  new_node->type = node.type;
+
+  return new_node;
+}
+
+unique_ptr<LightTreeNode> LightTree::add_mesh_from_cache(const Mesh *mesh,
+                                                         const string &key,
+                                                         const int object_id)
+{
+  const auto it = mesh_cache_->entries.find(mesh);
+  if (it == mesh_cache_->entries.end() || it->second.key != key) {
+    return nullptr;
+  }
+
+  const LightTreeMeshCacheEntry &entry = it->second;
+  const int start = emitters_.size();
+  for (const LightTreeEmitter &emitter : entry.emitters) {
+    emitters_.emplace_back(emitter, object_id);
+  }
+
+  num_nodes += entry.num_nodes;
+  return light_tree_node_copy(*entry.root, start);
+}
+
 LightTree::LightTree(Scene *scene,
                      DeviceScene *dscene,
                      Progress &progress,
-                     const uint max_lights_in_leaf)
-    : progress_(progress), max_lights_in_leaf_(max_lights_in_leaf)
+                     const uint max_lights_in_leaf,
+                     LightTreeMeshCache *mesh_cache)
+    : progress_(progress), max_lights_in_leaf_(max_lights_in_leaf), mesh_cache_(mesh_cache)
 {
   KernelIntegrator *kintegrator = &dscene->data.integrator;
 
@@ -347,45 +442,87 @@ LightTreeNode *LightTree::build(Scene *scene, DeviceScene *dscene)
   const int num_distant_lights = distant_lights_.size();
 
   /* Create a node for each mesh light, and keep track of unique mesh lights. */
-  std::unordered_map<Mesh *, std::tuple<LightTreeNode *, int, int>> unique_mesh;
+  struct UniqueMesh {
+    LightTreeNode *node;
+    int start;
+    int end;
+    string cache_key;
+    bool from_cache;
+  };
+  std::unordered_map<Mesh *, UniqueMesh> unique_mesh;
   uint *object_offsets = dscene->object_lookup_offset.alloc(scene->objects.size());
   emitters_.reserve(num_triangles + num_local_lights + num_distant_lights);
   for (LightTreeEmitter &emitter : mesh_lights_) {
     Object *object = scene->objects[emitter.object_id];
     Mesh *mesh = static_cast<Mesh *>(object->get_geometry());
-    emitter.root = create_node(LightTreeMeasure::empty, 0);
 
     auto map_it = unique_mesh.find(mesh);
     if (map_it == unique_mesh.end()) {
       const int start = emitters_.size();
-      add_mesh(scene, mesh, emitter.object_id);
+      string cache_key;
+      if (mesh_cache_) {
+        cache_key = light_tree_mesh_cache_key(mesh, object);
+        emitter.root = add_mesh_from_cache(mesh, cache_key, emitter.object_id);
+      }
+      const bool from_cache = (emitter.root != nullptr);
+      if (!from_cache) {
+        emitter.root = create_node(LightTreeMeasure::empty, 0);
+        add_mesh(scene, mesh, emitter.object_id);
+      }
       const int end = emitters_.size();
 
-      unique_mesh[mesh] = std::make_tuple(emitter.root.get(), start, end);
+      unique_mesh[mesh] = {emitter.root.get(), start, end, std::move(cache_key), from_cache};
       emitter.root->object_id = emitter.object_id;
     }
     else {
-      emitter.root->make_instance(std::get<0>(map_it->second), emitter.object_id);
+      emitter.root = create_node(LightTreeMeasure::empty, 0);
+      emitter.root->make_instance(map_it->second.node, emitter.object_id);
     }
     object_offsets[emitter.object_id] = offset_map_[mesh];
   }
 
-  /* Build a subtree for each unique mesh light. */
+  /* Build a subtree for each unique mesh light that is not in the cache. */
   parallel_for_each(unique_mesh, [this](auto &map_it) {
-    LightTreeNode *node = std::get<0>(map_it.second);
-    int const start = std::get<1>(map_it.second);
-    int const end = std::get<2>(map_it.second);
-    recursive_build(self, node, start, end, emitters_.data(), 0, 0);
-    node->type |= LIGHT_TREE_INSTANCE;
+    UniqueMesh &mesh = map_it.second;
+    if (mesh.from_cache) {
+      return;
+    }
+    recursive_build(self, mesh.node, mesh.start, mesh.end, emitters_.data(), 0, 0);
+    mesh.node->type |= LIGHT_TREE_INSTANCE;
   });
   task_pool.wait_work();
 
+  if (progress_.get_cancel()) {
+    return nullptr;
+  }
+
+  /* Store subtrees for the next build, removing meshes which are no longer emissive. */
+  if (mesh_cache_) {
+    LightTreeMeshCache mesh_cache;
+    for (auto &[mesh, unique] : unique_mesh) {
+      LightTreeMeshCacheEntry &entry = mesh_cache.entries[mesh];
+      if (unique.from_cache) {
+        entry = std::move(mesh_cache_->entries[mesh]);
+        continue;
+      }
+
+      entry.key = std::move(unique.cache_key);
+      entry.emitters.reserve(unique.end - unique.start);
+      for (int i = unique.start; i < unique.end; i++) {
+        entry.emitters.emplace_back(emitters_[i], emitters_[i].object_id);
+      }
+      entry.root = light_tree_node_copy(*unique.node, -unique.start);
+      entry.num_nodes = light_tree_node_count(*entry.root);
+    }
+    *mesh_cache_ = std::move(mesh_cache);
+  }
+
   /* Update measure. */
   parallel_for_each(mesh_lights_, [&](LightTreeEmitter &emitter) {
     Object *object = scene->objects[emitter.object_id];
     Mesh *mesh = static_cast<Mesh *>(object->get_geometry());
 
-    LightTreeNode *reference = std::get<0>(unique_mesh.find(mesh)->second);
+    LightTreeNode *reference = unique_mesh.find(mesh)->second.node;
     emitter.measure = emitter.root->measure = reference->measure;
 
     /* Transform measure. The measure is only directly transformable if the transformation has
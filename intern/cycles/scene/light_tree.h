@@ -13,6 +13,7 @@
 #include "util/vector.h"
 
 #include <atomic>
+#include <unordered_map>
 #include <variant>
 
 CCL_NAMESPACE_BEGIN
@@ -201,6 +202,8 @@ struct LightTreeEmitter {
                    const int prim_id,
                    const int object_id,
                    bool need_transformation = false);
+  /* Copy of a triangle emitter, referencing the given object. */
+  LightTreeEmitter(const LightTreeEmitter &other, const int object_id);
 
   __forceinline bool is_mesh() const
   {
@@ -378,6 +381,24 @@ struct LightTreeNode {
   }
 };
 
+/* Light Tree Mesh Cache
+ *
+ * Subtrees of the emissive triangles of meshes from previous light tree builds. Building these
+ * dominates the light tree build time in scenes with many emissive triangles, while interactive
+ * edits typically only touch lights or a few objects. A subtree is reused when the hash of the
+ * mesh data it was built from did not change. Emitter indices in the nodes are relative to the
+ * first triangle emitter of the mesh. */
+struct LightTreeMeshCacheEntry {
+  string key;
+  vector<LightTreeEmitter> emitters;
+  unique_ptr<LightTreeNode> root;
+  int num_nodes = 0;
+};
+
+struct LightTreeMeshCache {
+  std::unordered_map<const Mesh *, LightTreeMeshCacheEntry> entries;
+};
+
 /* Light BVH
  *
  * BVH-like data structure that keeps track of lights
@@ -398,6 +419,9 @@ class LightTree {
 
   uint max_lights_in_leaf_;
 
+  /* Optional cache of mesh subtrees, which is read and updated by the build. */
+  LightTreeMeshCache *mesh_cache_;
+
  public:
   std::atomic<int> num_nodes = 0;
   size_t num_triangles = 0;
@@ -412,7 +436,11 @@ class LightTree {
     right = 1,
   };
 
-  LightTree(Scene *scene, DeviceScene *dscene, Progress &progress, const uint max_lights_in_leaf);
+  LightTree(Scene *scene,
+            DeviceScene *dscene,
+            Progress &progress,
+            const uint max_lights_in_leaf,
+            LightTreeMeshCache *mesh_cache = nullptr);
 
   /* Returns a pointer to the root node. */
   LightTreeNode *build(Scene *scene, DeviceScene *dscene);
@@ -461,6 +489,12 @@ class LightTree {
 
   /* Add all the emissive triangles of a mesh to the light tree. */
   void add_mesh(Scene *scene, Mesh *mesh, const int object_id);
+
+  /* Add the emissive triangles and subtree of a mesh from the cache, returns the root node of the
+   * subtree or nullptr if there is no valid cache entry. */
+  unique_ptr<LightTreeNode> add_mesh_from_cache(const Mesh *mesh,
+                                                const string &key,
+                                                const int object_id);
 };
 
 CCL_NAMESPACE_END
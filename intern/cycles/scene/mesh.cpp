@@ -840,7 +840,7 @@ void Mesh::pack_shaders(Scene *scene, uint *tri_shader)
   }
 }
 
-void Mesh::pack_normals(packed_float3 *vnormal)
+void Mesh::pack_normals(uint *vnormal)
 {
   Attribute *attr_vN = attributes.find(ATTR_STD_VERTEX_NORMAL);
   if (attr_vN == nullptr) {
@@ -856,25 +856,29 @@ void Mesh::pack_normals(packed_float3 *vnormal)
 
   if (do_transform) {
     for (size_t i = 0; i < verts_size; i++) {
-      vnormal[i] = safe_normalize(transform_direction(&ntfm, vN[i]));
+      vnormal[i] = encode_octahedral_normal(safe_normalize(transform_direction(&ntfm, vN[i])));
     }
   }
   else {
     for (size_t i = 0; i < verts_size; i++) {
-      vnormal[i] = vN[i];
+      vnormal[i] = encode_octahedral_normal(vN[i]);
     }
   }
 }
 
-void Mesh::pack_verts(packed_float3 *tri_verts, packed_uint3 *tri_vindex)
+void Mesh::pack_verts(packed_float3 *tri_verts)
 {
   const size_t verts_size = verts.size();
-  const size_t triangles_size = num_triangles();
-  const int *p_tris = triangles.data();
-  int off = 0;
   for (size_t i = 0; i < verts_size; i++) {
     tri_verts[i] = verts[i];
   }
+}
+
+void Mesh::pack_triangles(packed_uint3 *tri_vindex)
+{
+  const size_t triangles_size = num_triangles();
+  const int *p_tris = triangles.data();
+  int off = 0;
   for (size_t i = 0; i < triangles_size; i++) {
     tri_vindex[i] = make_packed_uint3(p_tris[off + 0] + vert_offset,
                                       p_tris[off + 1] + vert_offset,
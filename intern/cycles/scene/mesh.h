@@ -217,8 +217,9 @@ class Mesh : public Geometry {
   void get_uv_tiles(ustring map, unordered_set<int> &tiles) override;
 
   void pack_shaders(Scene *scene, uint *shader);
-  void pack_normals(packed_float3 *vnormal);
-  void pack_verts(packed_float3 *tri_verts, packed_uint3 *tri_vindex);
+  void pack_normals(uint *vnormal);
+  void pack_verts(packed_float3 *tri_verts);
+  void pack_triangles(packed_uint3 *tri_vindex);
 
   bool has_motion_blur() const override;
   PrimitiveType primitive_type() const override;
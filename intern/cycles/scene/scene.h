@@ -68,10 +68,14 @@ class SceneParams {
   bool use_bvh_spatial_split;
   bool use_bvh_compact_structure;
   bool use_bvh_unaligned_nodes;
+  bool use_bvh_disk_cache;
   int num_bvh_time_steps;
   int hair_subdivisions;
   CurveShapeType hair_shape;
   int texture_limit;
+  /* Maximum device memory used by image textures in bytes, 0 for no limit. Images are scaled
+   * down uniformly when their combined size exceeds it. */
+  size_t texture_memory_limit;
 
   bool background;
 
@@ -83,10 +87,12 @@ class SceneParams {
     use_bvh_spatial_split = false;
     use_bvh_compact_structure = true;
     use_bvh_unaligned_nodes = true;
+    use_bvh_disk_cache = false;
     num_bvh_time_steps = 0;
     hair_subdivisions = 3;
     hair_shape = CURVE_RIBBON;
     texture_limit = 0;
+    texture_memory_limit = 0;
     background = true;
   }
 
@@ -97,9 +103,11 @@ class SceneParams {
              use_bvh_spatial_split == params.use_bvh_spatial_split &&
              use_bvh_compact_structure == params.use_bvh_compact_structure &&
              use_bvh_unaligned_nodes == params.use_bvh_unaligned_nodes &&
+             use_bvh_disk_cache == params.use_bvh_disk_cache &&
              num_bvh_time_steps == params.num_bvh_time_steps &&
              hair_subdivisions == params.hair_subdivisions && hair_shape == params.hair_shape &&
-             texture_limit == params.texture_limit);
+             texture_limit == params.texture_limit &&
+             texture_memory_limit == params.texture_memory_limit);
   }
 
   int curve_subdivisions()
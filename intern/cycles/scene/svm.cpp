@@ -72,10 +72,25 @@ void SVMShaderManager::device_update_specific(Device *device,
   /* test if we need to update */
   device_free(device, dscene, scene);
 
-  /* Build all shaders. */
+  /* Build all shaders that changed since the last update, reuse the program of others. */
+  const Shader *background_shader = scene->background->get_shader(scene);
   TaskPool task_pool;
   vector<array<int4>> shader_svm_nodes(num_shaders);
+  vector<bool> shader_compiled(num_shaders, false);
+  int num_reused_shaders = 0;
   for (int i = 0; i < num_shaders; i++) {
+    Shader *shader = scene->shaders[i];
+    const auto cached = compiled_shaders_.find(shader);
+    if (cached != compiled_shaders_.end() && !shader->is_modified() &&
+        cached->second.graph == shader->graph.get() &&
+        cached->second.background == (shader == background_shader))
+    {
+      shader_svm_nodes[i] = cached->second.svm_nodes;
+      num_reused_shaders++;
+      continue;
+    }
+
+    shader_compiled[i] = true;
     task_pool.push([this, scene, &progress, &shader_svm_nodes, i] {
       device_update_shader(scene, scene->shaders[i], progress, &shader_svm_nodes[i]);
     });
@@ -83,9 +98,28 @@ void SVMShaderManager::device_update_specific(Device *device,
   task_pool.wait_work();
 
   if (progress.get_cancel()) {
+    compiled_shaders_.clear();
     return;
   }
 
+  /* Remember compiled programs for the next update, forgetting removed shaders. */
+  unordered_map<const Shader *, CompiledShader> compiled_shaders;
+  for (int i = 0; i < num_shaders; i++) {
+    Shader *shader = scene->shaders[i];
+    CompiledShader &compiled = compiled_shaders[shader];
+    if (shader_compiled[i]) {
+      compiled.graph = shader->graph.get();
+      compiled.background = (shader == background_shader);
+      compiled.svm_nodes = shader_svm_nodes[i];
+    }
+    else {
+      compiled = std::move(compiled_shaders_[shader]);
+    }
+  }
+  compiled_shaders_ = std::move(compiled_shaders);
+
+  VLOG_INFO << "Reused " << num_reused_shaders << " compiled shaders.";
+
   /* The global node list contains a jump table (one node per shader)
    * followed by the nodes of all shaders. */
   int svm_nodes_size = num_shaders;
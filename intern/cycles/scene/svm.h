@@ -10,6 +10,7 @@
 #include "scene/shader_graph.h"
 
 #include "util/array.h"
+#include "util/map.h"
 #include "util/string.h"
 
 CCL_NAMESPACE_BEGIN
@@ -41,6 +42,16 @@ class SVMShaderManager : public ShaderManager {
                             Shader *shader,
                             Progress &progress,
                             array<int4> *svm_nodes);
+
+  /* Compiled program of a shader from a previous update. The program is reused as long as the
+   * shader and its graph were not modified, so that editing one material in a scene with many
+   * materials only recompiles that material. */
+  struct CompiledShader {
+    const ShaderGraph *graph = nullptr;
+    bool background = false;
+    array<int4> svm_nodes;
+  };
+  unordered_map<const Shader *, CompiledShader> compiled_shaders_;
 };
 
 /* Graph Compiler */
@@ -7,7 +7,9 @@
 
 #include "session/display_driver.h"
 #include "util/map.h"
+#include "util/math.h"
 #include "util/task.h"
+#include "util/tbb.h"
 
 #include <OpenImageIO/filesystem.h>
 
@@ -193,6 +195,81 @@ bool DenoiseTask::load_input_pixels(const int layer)
   return true;
 }
 
+/* Blend the denoised result of the frame with the denoised result of the previous frame, which
+ * is reprojected along the motion pass. Used for denoisers that do not have a temporal mode of
+ * their own, to reduce flickering of the denoised animation.
+ *
+ * The history is clamped to the range of the denoised result in the 3x3 neighborhood of the
+ * pixel, which rejects it for disoccluded regions and changed shading to avoid ghosting. */
+void denoise_blend_reprojected_previous(const BufferParams &params, float *buffer)
+{
+  /* Weight of the reprojected previous frame in the result. */
+  const float history_weight = 0.5f;
+
+  const int width = params.width;
+  const int height = params.height;
+  const int pass_stride = params.pass_stride;
+  const int denoised_offset = params.get_pass_offset(PASS_COMBINED, PassMode::DENOISED);
+  const int previous_offset = params.get_pass_offset(PASS_DENOISING_PREVIOUS);
+  const int motion_offset = params.get_pass_offset(PASS_MOTION);
+
+  auto pixel = [&](const int x, const int y, const int offset) {
+    const float *p = buffer + (size_t(y) * width + x) * pass_stride + offset;
+    return make_float3(p[0], p[1], p[2]);
+  };
+
+  vector<float3> blended(size_t(width) * height);
+
+  parallel_for(0, height, [&](const int y) {
+    for (int x = 0; x < width; x++) {
+      const float3 current = pixel(x, y, denoised_offset);
+      float3 &result = blended[size_t(y) * width + x];
+      result = current;
+
+      /* Motion towards the previous frame, stored as previous minus current raster position. */
+      const float *motion = buffer + (size_t(y) * width + x) * pass_stride + motion_offset;
+      const float px = x + motion[0];
+      const float py = y + motion[1];
+      if (!(px >= 0.0f && py >= 0.0f && px <= width - 1 && py <= height - 1)) {
+        continue;
+      }
+
+      const int x0 = int(px);
+      const int y0 = int(py);
+      const int x1 = min(x0 + 1, width - 1);
+      const int y1 = min(y0 + 1, height - 1);
+      const float fx = px - x0;
+      const float fy = py - y0;
+      const float3 history = interp(
+          interp(pixel(x0, y0, previous_offset), pixel(x1, y0, previous_offset), fx),
+          interp(pixel(x0, y1, previous_offset), pixel(x1, y1, previous_offset), fx),
+          fy);
+
+      float3 neighborhood_min = current;
+      float3 neighborhood_max = current;
+      for (int dy = max(y - 1, 0); dy <= min(y + 1, height - 1); dy++) {
+        for (int dx = max(x - 1, 0); dx <= min(x + 1, width - 1); dx++) {
+          const float3 neighbor = pixel(dx, dy, denoised_offset);
+          neighborhood_min = min(neighborhood_min, neighbor);
+          neighborhood_max = max(neighborhood_max, neighbor);
+        }
+      }
+
+      result = interp(current, clamp(history, neighborhood_min, neighborhood_max), history_weight);
+    }
+  });
+
+  parallel_for(0, height, [&](const int y) {
+    for (int x = 0; x < width; x++) {
+      float *out = buffer + (size_t(y) * width + x) * pass_stride + denoised_offset;
+      const float3 &result = blended[size_t(y) * width + x];
+      out[0] = result.x;
+      out[1] = result.y;
+      out[2] = result.z;
+    }
+  });
+}
+
 /* Task stages */
 
 static void add_pass(unique_ptr_vector<Pass> &passes,
@@ -276,6 +353,12 @@ bool DenoiseTask::exec()
     /* Copy denoised pixels from device. */
     buffers.buffer.copy_from_device();
 
+    /* OptiX uses the previous output and motion pass itself, in its temporal mode. */
+    const DenoiseParams &params = denoiser->denoiser->get_params();
+    if (params.temporally_stable && params.type != DENOISER_OPTIX) {
+      denoise_blend_reprojected_previous(buffers.params, buffers.buffer.data());
+    }
+
     float *result = buffers.buffer.data();
     float *out = image.pixels.data();
 
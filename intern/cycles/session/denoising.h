@@ -23,6 +23,10 @@ OIIO_NAMESPACE_USING
 
 CCL_NAMESPACE_BEGIN
 
+/* Blend the denoised combined pass in the buffer with the denoised previous frame, reprojected
+ * along the motion pass. */
+void denoise_blend_reprojected_previous(const BufferParams &params, float *buffer);
+
 /* Denoiser pipeline */
 
 class DenoiserPipeline {
@@ -176,6 +176,7 @@ void Session::run_main_render_loop()
       if (params.background) {
         /* if no work left and in background mode, we can stop immediately. */
         progress.set_status("Finished");
+        path_trace_->guiding_store_field();
         break;
       }
     }
@@ -316,6 +317,14 @@ RenderWork Session::run_update_for_next_iteration()
   bool switched_to_new_tile = false;
 
   if (reset_buffers) {
+    /* Keep the render for the viewport warm start when only the camera changed. */
+    if (reset_scene) {
+      path_trace_->clear_warm_start();
+    }
+    else {
+      path_trace_->capture_warm_start();
+    }
+
     update_buffers_for_params();
 
     /* After reset make sure the tile manager is at the first big tile. */
@@ -687,6 +696,8 @@ bool Session::update_scene(const bool reset_samples)
    * tile results. */
   scene->film->set_use_sample_count(tile_manager_.has_multiple_tiles());
 
+  scene->film->set_use_viewport_warm_start(params.use_viewport_warm_start && !params.background);
+
   const bool reset = scene->need_reset(false);
 
   if (scene->update(progress)) {
@@ -63,6 +63,9 @@ class SessionParams {
 
   bool use_resolution_divider;
 
+  /* Start viewport renders after camera navigation from the reprojected previous render. */
+  bool use_viewport_warm_start;
+
   ShadingSystem shadingsystem;
 
   /* Session-specific temporary directory to store in-progress EXR files in. */
@@ -89,6 +92,8 @@ class SessionParams {
 
     use_resolution_divider = true;
 
+    use_viewport_warm_start = false;
+
     shadingsystem = SHADINGSYSTEM_SVM;
   }
 
@@ -628,6 +628,19 @@ void TileManager::finish_write_tiles()
 bool TileManager::read_full_buffer_from_disk(const string_view filename,
                                              RenderBuffers *buffers,
                                              DenoiseParams *denoise_params)
+{
+  int full_height;
+  return read_full_buffer_band_from_disk(
+      filename, buffers, denoise_params, 0, INT_MAX, 0, &full_height);
+}
+
+bool TileManager::read_full_buffer_band_from_disk(const string_view filename,
+                                                  RenderBuffers *buffers,
+                                                  DenoiseParams *denoise_params,
+                                                  const int band_y,
+                                                  const int band_height,
+                                                  const int overlap,
+                                                  int *r_full_height)
 {
   unique_ptr<ImageInput> in(ImageInput::open(filename));
   if (!in) {
@@ -641,6 +654,28 @@ bool TileManager::read_full_buffer_from_disk(const string_view filename,
   if (!buffer_params_from_image_spec_atttributes(&buffer_params, image_spec)) {
     return false;
   }
+
+  const int full_height = buffer_params.height;
+  const int window_begin = max(band_y, 0);
+  const int window_end = (band_height >= full_height - window_begin) ?
+                             full_height :
+                             window_begin + band_height;
+  const int read_begin = max(window_begin - overlap, 0);
+  const int read_end = min(window_end + overlap, full_height);
+
+  if (window_begin >= window_end) {
+    LOG(ERROR) << "Empty band requested from the tile file " << filename;
+    return false;
+  }
+
+  /* Only the rows of the band are allocated, the window excludes the overlap. */
+  if (read_begin != 0 || read_end != full_height) {
+    buffer_params.height = read_end - read_begin;
+    buffer_params.full_y += read_begin;
+    buffer_params.window_y = window_begin - read_begin;
+    buffer_params.window_height = window_end - window_begin;
+    buffer_params.update_offset_stride();
+  }
   buffers->reset(buffer_params);
 
   if (!node_from_image_spec_atttributes(denoise_params, image_spec, ATTR_DENOISE_SOCKET_PREFIX)) {
@@ -648,7 +683,16 @@ bool TileManager::read_full_buffer_from_disk(const string_view filename,
   }
 
   const int num_channels = in->spec().nchannels;
-  if (!in->read_image(0, 0, 0, num_channels, TypeDesc::FLOAT, buffers->buffer.data())) {
+  if (!in->read_scanlines(0,
+                          0,
+                          image_spec.y + read_begin,
+                          image_spec.y + read_end,
+                          0,
+                          0,
+                          num_channels,
+                          TypeDesc::FLOAT,
+                          buffers->buffer.data()))
+  {
     LOG(ERROR) << "Error reading pixels from the tile file " << in->geterror();
     return false;
   }
@@ -658,6 +702,8 @@ bool TileManager::read_full_buffer_from_disk(const string_view filename,
     return false;
   }
 
+  *r_full_height = full_height;
+
   return true;
 }
 
@@ -77,6 +77,11 @@ class TileManager {
     return overscan_;
   }
 
+  int2 get_tile_size() const
+  {
+    return tile_size_;
+  }
+
   bool next();
   bool done();
 
@@ -107,6 +112,20 @@ class TileManager {
                                   RenderBuffers *buffers,
                                   DenoiseParams *denoise_params);
 
+  /* Read a band of rows [band_y, band_y + band_height) of the full frame render buffer, so that
+   * the full frame does not need to be in memory at once. Up to `overlap` rows above and below
+   * the band are read as well, outside of the buffer window. The height of the full frame is
+   * returned in `r_full_height`.
+   *
+   * Returns true on success. */
+  bool read_full_buffer_band_from_disk(string_view filename,
+                                       RenderBuffers *buffers,
+                                       DenoiseParams *denoise_params,
+                                       const int band_y,
+                                       const int band_height,
+                                       const int overlap,
+                                       int *r_full_height);
+
   /* Compute valid tile size compatible with image saving. */
   int compute_render_tile_size(const int suggested_tile_size) const;
 
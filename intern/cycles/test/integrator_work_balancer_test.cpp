@@ -0,0 +1,68 @@
+/* SPDX-FileCopyrightText: 2011-2022 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "integrator/work_balancer.h"
+
+CCL_NAMESPACE_BEGIN
+
+static vector<WorkBalanceInfo> make_work_balance_infos(const vector<double> &times)
+{
+  vector<WorkBalanceInfo> infos(times.size());
+  work_balance_do_initial(infos);
+  for (size_t i = 0; i < times.size(); ++i) {
+    infos[i].time_spent = times[i];
+  }
+  return infos;
+}
+
+TEST(work_balance, Initial)
+{
+  vector<WorkBalanceInfo> infos(4);
+  work_balance_do_initial(infos);
+  for (const WorkBalanceInfo &info : infos) {
+    EXPECT_NEAR(info.weight, 0.25, 1e-6);
+  }
+}
+
+TEST(work_balance, Balanced)
+{
+  vector<WorkBalanceInfo> infos = make_work_balance_infos({1.0, 1.01, 0.99});
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+}
+
+TEST(work_balance, NoStatistics)
+{
+  vector<WorkBalanceInfo> infos = make_work_balance_infos({1.0, 0.0});
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.5, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.5, 1e-6);
+}
+
+TEST(work_balance, SmallDifference)
+{
+  /* Small differences converge gradually, to avoid oscillation caused by timing noise. */
+  vector<WorkBalanceInfo> infos = make_work_balance_infos({1.0, 1.1});
+  EXPECT_TRUE(work_balance_do_rebalance(infos));
+  EXPECT_GT(infos[0].weight, 0.5);
+  EXPECT_LT(infos[0].weight, 1.1 / 2.1);
+  EXPECT_NEAR(infos[0].weight + infos[1].weight, 1.0, 1e-6);
+}
+
+TEST(work_balance, Straggler)
+{
+  /* One device is twice as slow as the other three: weights follow the throughput directly. */
+  vector<WorkBalanceInfo> infos = make_work_balance_infos({1.0, 1.0, 1.0, 2.0});
+  EXPECT_TRUE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 2.0 / 7.0, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 2.0 / 7.0, 1e-6);
+  EXPECT_NEAR(infos[2].weight, 2.0 / 7.0, 1e-6);
+  EXPECT_NEAR(infos[3].weight, 1.0 / 7.0, 1e-6);
+  for (const WorkBalanceInfo &info : infos) {
+    EXPECT_EQ(info.time_spent, 0.0);
+  }
+}
+
+CCL_NAMESPACE_END
@@ -0,0 +1,66 @@
+/* SPDX-FileCopyrightText: 2025 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "session/buffers.h"
+#include "session/denoising.h"
+
+CCL_NAMESPACE_BEGIN
+
+static BufferPass make_buffer_pass(const PassType type, const PassMode mode = PassMode::NOISY)
+{
+  BufferPass pass;
+  pass.type = type;
+  pass.mode = mode;
+  pass.offset = 0;
+  return pass;
+}
+
+TEST(denoise_blend_reprojected_previous, VerticalMotion)
+{
+  const int width = 8;
+  const int height = 8;
+
+  BufferParams params;
+  params.width = width;
+  params.height = height;
+  params.passes.push_back(make_buffer_pass(PASS_COMBINED, PassMode::DENOISED));
+  params.passes.push_back(make_buffer_pass(PASS_DENOISING_PREVIOUS));
+  params.passes.push_back(make_buffer_pass(PASS_MOTION));
+  params.update_passes();
+
+  const int denoised_offset = params.get_pass_offset(PASS_COMBINED, PassMode::DENOISED);
+  const int previous_offset = params.get_pass_offset(PASS_DENOISING_PREVIOUS);
+  const int motion_offset = params.get_pass_offset(PASS_MOTION);
+
+  /* Content moves up by one row: what is now at row `y` was at row `y + 1` in the previous
+   * frame. The current frame stores the row index, so the previous frame stores `y - 1`. */
+  vector<float> buffer(size_t(width) * height * params.pass_stride, 0.0f);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      float *pixel = buffer.data() + (size_t(y) * width + x) * params.pass_stride;
+      for (int i = 0; i < 3; i++) {
+        pixel[denoised_offset + i] = float(y);
+        pixel[previous_offset + i] = float(y - 1);
+      }
+      pixel[motion_offset + 0] = 0.0f;
+      pixel[motion_offset + 1] = 1.0f;
+    }
+  }
+
+  denoise_blend_reprojected_previous(params, buffer.data());
+
+  /* The reprojected history matches the current frame, so blending leaves it unchanged. */
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      const float *pixel = buffer.data() + (size_t(y) * width + x) * params.pass_stride;
+      EXPECT_FLOAT_EQ(pixel[denoised_offset + 0], float(y));
+      EXPECT_FLOAT_EQ(pixel[denoised_offset + 1], float(y));
+      EXPECT_FLOAT_EQ(pixel[denoised_offset + 2], float(y));
+    }
+  }
+}
+
+CCL_NAMESPACE_END
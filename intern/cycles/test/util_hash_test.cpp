@@ -0,0 +1,31 @@
+/* SPDX-FileCopyrightText: 2011-2025 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "util/hash.h"
+
+CCL_NAMESPACE_BEGIN
+
+TEST(util_hash, pcg3d_i4_matches_pcg3d_i)
+{
+  const int3 points[4] = {make_int3(0, 0, 0),
+                          make_int3(-1, 2, -3),
+                          make_int3(123456, -7890, 42),
+                          make_int3(-2147483647, 2147483647, -1)};
+
+  int4 x = make_int4(points[0].x, points[1].x, points[2].x, points[3].x);
+  int4 y = make_int4(points[0].y, points[1].y, points[2].y, points[3].y);
+  int4 z = make_int4(points[0].z, points[1].z, points[2].z, points[3].z);
+  hash_pcg3d_i4(x, y, z);
+
+  for (int i = 0; i < 4; i++) {
+    const int3 expected = hash_pcg3d_i(points[i]);
+    EXPECT_EQ(x[i], expected.x);
+    EXPECT_EQ(y[i], expected.y);
+    EXPECT_EQ(z[i], expected.z);
+  }
+}
+
+CCL_NAMESPACE_END
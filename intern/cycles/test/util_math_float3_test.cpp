@@ -64,4 +64,24 @@ TEST_F(Float3Test, fmod)
   }
 }
 
+TEST_F(Float3Test, octahedral_normal)
+{
+  const float3 normals[] = {make_float3(0.0f, 0.0f, 1.0f),
+                            make_float3(0.0f, 0.0f, -1.0f),
+                            make_float3(1.0f, 0.0f, 0.0f),
+                            make_float3(0.0f, -1.0f, 0.0f),
+                            normalize(make_float3(-0.3f, 0.5f, -0.8f)),
+                            normalize(make_float3(-1e-4f, -1e-4f, -1.0f)),
+                            normalize(make_float3(0.7f, -0.2f, 0.1f))};
+
+  for (const float3 n : normals) {
+    const float3 d = decode_octahedral_normal(encode_octahedral_normal(n));
+    EXPECT_NEAR(len(d), 1.0f, 1e-6f);
+    EXPECT_GT(dot(n, d), 0.99999f);
+  }
+
+  EXPECT_EQ(encode_octahedral_normal(zero_float3()), 0);
+  EXPECT_TRUE(is_zero(decode_octahedral_normal(0)));
+}
+
 CCL_NAMESPACE_END
@@ -72,6 +72,29 @@ ccl_device_inline int4 hash_pcg4d_i(int4 v)
   return v & make_int4(0x7FFFFFFF);
 }
 
+/* Same as hash_pcg3d_i, for four points at once with their coordinates stored in separate
+ * vectors, so every step maps to a single vector operation. */
+ccl_device_inline void hash_pcg3d_i4(ccl_private int4 &x,
+                                     ccl_private int4 &y,
+                                     ccl_private int4 &z)
+{
+  x = x * make_int4(1664525) + make_int4(1013904223);
+  y = y * make_int4(1664525) + make_int4(1013904223);
+  z = z * make_int4(1664525) + make_int4(1013904223);
+  x += y * z;
+  y += z * x;
+  z += x * y;
+  x = x ^ (x >> 16);
+  y = y ^ (y >> 16);
+  z = z ^ (z >> 16);
+  x += y * z;
+  y += z * x;
+  z += x * y;
+  x = x & make_int4(0x7FFFFFFF);
+  y = y & make_int4(0x7FFFFFFF);
+  z = z & make_int4(0x7FFFFFFF);
+}
+
 /* ***** Jenkins Lookup3 Hash Functions ***** */
 
 /* Source: http://burtleburtle.net/bob/c/lookup3.c */
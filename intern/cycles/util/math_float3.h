@@ -672,4 +672,44 @@ ccl_device_inline float2 map_to_sphere(const float3 co)
   return make_float2(u, v);
 }
 
+/* Octahedral encoding of unit vectors into 16 bits per axis, used to store vertex normals in a
+ * third of the memory of a packed_float3. The error is well below what is visible in shading.
+ * Code 0 is reserved for the zero vector, so degenerate normals keep falling back to the
+ * geometric normal. */
+ccl_device_inline uint encode_octahedral_normal(const float3 n)
+{
+  const float l1 = fabsf(n.x) + fabsf(n.y) + fabsf(n.z);
+  if (!(l1 > 0.0f)) {
+    return 0;
+  }
+
+  float u = n.x / l1;
+  float v = n.y / l1;
+  if (n.z < 0.0f) {
+    const float fold_u = (1.0f - fabsf(v)) * signf(u);
+    v = (1.0f - fabsf(u)) * signf(v);
+    u = fold_u;
+  }
+
+  const uint qu = uint(saturatef(u * 0.5f + 0.5f) * 65535.0f + 0.5f);
+  const uint qv = uint(saturatef(v * 0.5f + 0.5f) * 65535.0f + 0.5f);
+  const uint code = qu | (qv << 16);
+
+  /* The (-1, -1) corner decodes to -Z, as does (1, 1). */
+  return (code == 0) ? 0xFFFFFFFFu : code;
+}
+
+ccl_device_inline float3 decode_octahedral_normal(const uint code)
+{
+  const float u = float(code & 0xFFFF) * (2.0f / 65535.0f) - 1.0f;
+  const float v = float(code >> 16) * (2.0f / 65535.0f) - 1.0f;
+
+  float3 n = make_float3(u, v, 1.0f - fabsf(u) - fabsf(v));
+  const float t = fmaxf(-n.z, 0.0f);
+  n.x += (n.x >= 0.0f) ? -t : t;
+  n.y += (n.y >= 0.0f) ? -t : t;
+
+  return (code == 0) ? zero_float3() : normalize(n);
+}
+
 CCL_NAMESPACE_END
@@ -27,9 +27,11 @@
 
 #include "libmv/tracking/track_region.h"
 
+#include <algorithm>
 #include <Eigen/QR>
 #include <Eigen/SVD>
 #include <iostream>
+#include <vector>
 #include "ceres/ceres.h"
 #include "libmv/image/convolve.h"
 #include "libmv/image/image.h"
@@ -37,6 +39,7 @@
 #include "libmv/logging/logging.h"
 #include "libmv/multiview/homography.h"
 #include "libmv/numeric/numeric.h"
+#include "libmv/threading/parallel_for.h"
 
 // Expand the Jet functionality of Ceres to allow mixed numeric/autodiff.
 //
@@ -1244,7 +1247,17 @@ bool BruteTranslationOnlyInitialize(const FloatImage& image1,
   int w = pattern.cols();
   int h = pattern.rows();
 
-  for (int r = 0; r < (image2.Height() - h); ++r) {
+  // Rows of shifts are searched in parallel, each keeping its own best shift.
+  // They are reduced in row order afterwards, so the chosen shift is the same
+  // as with a single-threaded search, including ties.
+  const int num_rows = std::max(image2.Height() - h, 0);
+  std::vector<double> row_best_sad(num_rows,
+                                   std::numeric_limits<double>::max());
+  std::vector<int> row_best_c(num_rows, -1);
+
+  parallel_for(0, num_rows, [&](const int r) {
+    double& row_sad = row_best_sad[r];
+    int& row_c = row_best_c[r];
     for (int c = 0; c < (image2.Width() - w); ++c) {
       // Compute the weighted sum of absolute differences, Eigen style. Note
       // that the block from the search image is never stored in a variable, to
@@ -1263,12 +1276,19 @@ bool BruteTranslationOnlyInitialize(const FloatImage& image1,
       } else {
         sad = (mask * (pattern - search.block(r, c, h, w))).abs().sum();
       }
-      if (sad < best_sad) {
-        best_r = r;
-        best_c = c;
-        best_sad = sad;
+      if (sad < row_sad) {
+        row_c = c;
+        row_sad = sad;
       }
     }
+  });
+
+  for (int r = 0; r < num_rows; ++r) {
+    if (row_best_sad[r] < best_sad) {
+      best_r = r;
+      best_c = row_best_c[r];
+      best_sad = row_best_sad[r];
+    }
   }
 
   // This mean the effective pattern area is zero. This check could go earlier,
@@ -659,7 +659,6 @@ template<typename Mesh> class Mikktspace {
      * key go into the same shard.
      * This is done by hashing the key to get the shard index of each vertex.
      */
-    // TODO: Two-step filling that first counts and then fills? Could be parallel then.
     uint targetNrShards = isParallel ? uint(4 * nrThreads) : 1;
     uint nrShards = 1, hashShift = 32;
     while (nrShards < targetNrShards) {
@@ -667,24 +666,66 @@ template<typename Mesh> class Mikktspace {
       hashShift -= 1;
     }
 
-    /* Reserve 25% extra to account for variation due to hashing. */
-    size_t reserveSize = size_t(double(3 * nrTriangles) * 1.25 / nrShards);
-    std::vector<NeighborShard> shards(nrShards, {reserveSize});
+    auto edgeHash = [&](const uint t, const uint i) {
+      const Triangle &triangle = triangles[t];
+      const uint i0 = triangle.vertices[i];
+      const uint i1 = triangle.vertices[(i != 2) ? (i + 1) : 0];
+      const uint high = std::max(i0, i1), low = std::min(i0, i1);
+      return hash_uint3(high, low, 0);
+    };
 
-    for (uint t = 0; t < nrTriangles; t++) {
-      Triangle &triangle = triangles[t];
-      for (uint i = 0; i < 3; i++) {
-        const uint i0 = triangle.vertices[i];
-        const uint i1 = triangle.vertices[(i != 2) ? (i + 1) : 0];
-        const uint high = std::max(i0, i1), low = std::min(i0, i1);
-        const uint hash = hash_uint3(high, low, 0);
-        /* TODO: Reusing the hash here means less hash space inside each shard.
-         * Computing a second hash with a different seed it probably not worth it? */
-        const uint shard = isParallel ? (hash >> hashShift) : 0;
-        shards[shard].entries.emplace_back(hash, pack_index(t, i));
+    if (!isParallel) {
+      std::vector<NeighborShard> shards(1, {size_t(3 * nrTriangles)});
+      for (uint t = 0; t < nrTriangles; t++) {
+        for (uint i = 0; i < 3; i++) {
+          shards[0].entries.emplace_back(edgeHash(t, i), pack_index(t, i));
+        }
       }
+      shards[0].buildNeighbors(this);
+      return;
     }
 
+    /* Fill the shards in two steps over chunks of triangles: first count the entries every chunk
+     * adds to each shard, then write them at their final position. Chunks are laid out in order,
+     * so the entries of each shard are still sorted by t, as required by the stable sort below. */
+    const uint chunkSize = 4096;
+    const uint nrChunks = (nrTriangles + chunkSize - 1) / chunkSize;
+    std::vector<uint> chunkOffsets(size_t(nrChunks) * nrShards, 0);
+    runParallel(0u, nrChunks, [&](uint c) {
+      uint *counts = &chunkOffsets[size_t(c) * nrShards];
+      const uint tEnd = std::min(nrTriangles, (c + 1) * chunkSize);
+      for (uint t = c * chunkSize; t < tEnd; t++) {
+        for (uint i = 0; i < 3; i++) {
+          counts[edgeHash(t, i) >> hashShift]++;
+        }
+      }
+    });
+
+    std::vector<NeighborShard> shards(nrShards, {0});
+    for (uint s = 0; s < nrShards; s++) {
+      uint offset = 0;
+      for (uint c = 0; c < nrChunks; c++) {
+        const uint count = chunkOffsets[size_t(c) * nrShards + s];
+        chunkOffsets[size_t(c) * nrShards + s] = offset;
+        offset += count;
+      }
+      shards[s].entries.resize(offset, {0, 0});
+    }
+
+    runParallel(0u, nrChunks, [&](uint c) {
+      uint *offsets = &chunkOffsets[size_t(c) * nrShards];
+      const uint tEnd = std::min(nrTriangles, (c + 1) * chunkSize);
+      for (uint t = c * chunkSize; t < tEnd; t++) {
+        for (uint i = 0; i < 3; i++) {
+          const uint hash = edgeHash(t, i);
+          /* TODO: Reusing the hash here means less hash space inside each shard.
+           * Computing a second hash with a different seed it probably not worth it? */
+          const uint shard = hash >> hashShift;
+          shards[shard].entries[offsets[shard]++] = {hash, pack_index(t, i)};
+        }
+      }
+    });
+
     runParallel(0u, nrShards, [&](uint s) { shards[s].buildNeighbors(this); });
   }
 
@@ -4,6 +4,47 @@
  *
  * Author: Sergey Sharybin. */
 
+#include "internal/evaluator/eval_output_cpu.h"
+
+#include "BLI_task.hh"
+
 namespace blender::opensubdiv {
 
+bool ParallelCpuEvaluator::EvalStencils(const float *src,
+                                        const BufferDescriptor &src_desc,
+                                        float *dst,
+                                        const BufferDescriptor &dst_desc,
+                                        const int *sizes,
+                                        const int *offsets,
+                                        const int *indices,
+                                        const float *weights,
+                                        const int start,
+                                        const int end)
+{
+  if (end <= start) {
+    return true;
+  }
+  if (src_desc.length != dst_desc.length) {
+    return false;
+  }
+  threading::parallel_for(IndexRange::from_begin_end(start, end), 1024, [&](IndexRange range) {
+    // Evaluate every range as if it was a separate stencil table starting at zero, so that the
+    // result does not depend on how OpenSubdiv handles the start offset in its kernels.
+    BufferDescriptor range_dst_desc = dst_desc;
+    range_dst_desc.offset += int(range.start()) * dst_desc.stride;
+    const int range_offset = offsets[range.start()];
+    CpuEvaluator::EvalStencils(src,
+                               src_desc,
+                               dst,
+                               range_dst_desc,
+                               sizes + range.start(),
+                               offsets + range.start(),
+                               indices + range_offset,
+                               weights + range_offset,
+                               0,
+                               int(range.size()));
+  });
+  return true;
+}
+
 }  // namespace blender::opensubdiv
@@ -14,18 +14,62 @@
 #include <opensubdiv/osd/cpuVertexBuffer.h>
 
 using OpenSubdiv::Far::StencilTable;
+using OpenSubdiv::Osd::BufferDescriptor;
 using OpenSubdiv::Osd::CpuEvaluator;
 using OpenSubdiv::Osd::CpuVertexBuffer;
 
 namespace blender::opensubdiv {
 
+// Same as OpenSubdiv's CpuEvaluator, but evaluates stencils in parallel.
+//
+// All stencils are factorized to the coarse control vertices, so they are independent of each
+// other and can be evaluated in any order, even when the source and destination buffer are the
+// same. The GPU evaluator relies on this as well.
+class ParallelCpuEvaluator : public CpuEvaluator {
+ public:
+  template<typename SRC_BUFFER, typename DST_BUFFER, typename STENCIL_TABLE>
+  static bool EvalStencils(SRC_BUFFER *src_buffer,
+                           const BufferDescriptor &src_desc,
+                           DST_BUFFER *dst_buffer,
+                           const BufferDescriptor &dst_desc,
+                           const STENCIL_TABLE *stencil_table,
+                           const ParallelCpuEvaluator * /*instance*/ = nullptr,
+                           void * /*device_context*/ = nullptr)
+  {
+    if (stencil_table->GetNumStencils() == 0) {
+      return false;
+    }
+    return EvalStencils(src_buffer->BindCpuBuffer(),
+                        src_desc,
+                        dst_buffer->BindCpuBuffer(),
+                        dst_desc,
+                        &stencil_table->GetSizes()[0],
+                        &stencil_table->GetOffsets()[0],
+                        &stencil_table->GetControlIndices()[0],
+                        &stencil_table->GetWeights()[0],
+                        0,
+                        stencil_table->GetNumStencils());
+  }
+
+  static bool EvalStencils(const float *src,
+                           const BufferDescriptor &src_desc,
+                           float *dst,
+                           const BufferDescriptor &dst_desc,
+                           const int *sizes,
+                           const int *offsets,
+                           const int *indices,
+                           const float *weights,
+                           int start,
+                           int end);
+};
+
 // NOTE: Define as a class instead of typedef to make it possible
 // to have anonymous class in opensubdiv_evaluator_internal.h
 class CpuEvalOutput : public VolatileEvalOutput<CpuVertexBuffer,
                                                 CpuVertexBuffer,
                                                 StencilTable,
                                                 CpuPatchTable,
-                                                CpuEvaluator> {
+                                                ParallelCpuEvaluator> {
  public:
   CpuEvalOutput(const StencilTable *vertex_stencils,
                 const StencilTable *varying_stencils,
@@ -37,7 +81,7 @@ class CpuEvalOutput : public VolatileEvalOutput<CpuVertexBuffer,
                            CpuVertexBuffer,
                            StencilTable,
                            CpuPatchTable,
-                           CpuEvaluator>(vertex_stencils,
+                           ParallelCpuEvaluator>(vertex_stencils,
                                          varying_stencils,
                                          all_face_varying_stencils,
                                          face_varying_width,
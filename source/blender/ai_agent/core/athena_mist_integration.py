@@ -160,8 +160,8 @@ Your role: {self.personality['role']}
 Your specializations: {', '.join(self.personality['specializations'])}
 
 Current Blender context:
-- Objects in scene: {len(context.get('objects', []))}
-- Materials: {len(context.get('materials', []))}
+- Objects in scene: {context.get('object_count', len(context.get('objects', [])))}
+- Materials: {context.get('material_count', len(context.get('materials', [])))}
 - Render engine: {context.get('render_settings', {}).get('engine', 'Unknown')}
 - User mode: {context.get('user_mode', 'Object Mode')}
 
@@ -346,11 +346,11 @@ Be inspiring and encouraging while maintaining technical accuracy.
         """Generate fallback suggestions based on context."""
         suggestions = []
         
-        if len(context.get('objects', [])) == 0:
+        if context.get('object_count', len(context.get('objects', []))) == 0:
             suggestions.append("Try creating a basic cube to get started with 3D modeling")
             suggestions.append("Consider adding some lighting to your scene")
         
-        if len(context.get('materials', [])) < 2:
+        if context.get('material_count', len(context.get('materials', []))) < 2:
             suggestions.append("Create a new material to add visual interest to your objects")
             suggestions.append("Experiment with different material types like Principled BSDF")
         
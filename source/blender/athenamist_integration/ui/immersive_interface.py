@@ -22,6 +22,9 @@ from datetime import datetime
 from ..core.athena_mist_integration import AthenaMistIntegration, AthenaMistMode
 from ..core.intent_parser import IntentParser
 
+# Maximum number of objects and materials listed individually in the scene context.
+CONTEXT_MAX_LISTED_ITEMS = 100
+
 
 class AthenaMistUIProperties(PropertyGroup):
     """Properties for the AthenaMist UI system."""
@@ -286,6 +289,10 @@ class AthenaMistSendMessageOperator(Operator):
     bl_idname = "athena_mist.send_message"
     bl_label = "Send Message"
     bl_description = "Send message to AthenaMist AI assistant"
+    # Operators run for the suggested actions are nested in this one, so they don't push undo
+    # steps of their own: all the changes made for a message are undone in a single step.
+    # Not registered, redoing would send the message again.
+    bl_options = {'UNDO'}
     
     def execute(self, context):
         """Execute the send message operation."""
@@ -310,18 +317,23 @@ class AthenaMistSendMessageOperator(Operator):
         """Get current Blender scene context."""
         scene = context.scene
         
+        # Only list the first objects and materials individually, walking all of them blocks the
+        # UI on large scenes while only the totals are used in the prompt.
+        scene_objects = scene.objects
+        all_materials = bpy.data.materials
+        
         # Collect objects
         objects = []
-        for obj in scene.objects:
+        for obj in scene_objects[:CONTEXT_MAX_LISTED_ITEMS]:
             objects.append({
                 'name': obj.name,
                 'type': obj.type,
-                'location': [obj.location.x, obj.location.y, obj.location.z]
+                'location': obj.location[:]
             })
         
         # Collect materials
         materials = []
-        for mat in bpy.data.materials:
+        for mat in all_materials[:CONTEXT_MAX_LISTED_ITEMS]:
             materials.append({
                 'name': mat.name,
                 'use_nodes': mat.use_nodes
@@ -336,7 +348,9 @@ class AthenaMistSendMessageOperator(Operator):
         
         return {
             'objects': objects,
+            'object_count': len(scene_objects),
             'materials': materials,
+            'material_count': len(all_materials),
             'render_settings': render_settings,
             'user_mode': context.mode
         }
@@ -368,14 +382,23 @@ class AthenaMistSendMessageOperator(Operator):
     
     def _execute_suggested_actions(self, actions):
         """Execute suggested actions from AI response."""
-        for action in actions:
-            action_type = action.get('type')
-            if action_type == 'create_object':
-                self._create_object(action)
-            elif action_type == 'modify_material':
-                self._modify_material(action)
-            elif action_type == 'setup_animation':
-                self._setup_animation(action)
+        if not actions:
+            return
+        
+        wm = bpy.context.window_manager
+        wm.progress_begin(0, len(actions))
+        try:
+            for i, action in enumerate(actions):
+                action_type = action.get('type')
+                if action_type == 'create_object':
+                    self._create_object(action)
+                elif action_type == 'modify_material':
+                    self._modify_material(action)
+                elif action_type == 'setup_animation':
+                    self._setup_animation(action)
+                wm.progress_update(i + 1)
+        finally:
+            wm.progress_end()
     
     def _create_object(self, action):
         """Create object based on AI suggestion."""
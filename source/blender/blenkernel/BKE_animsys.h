@@ -12,6 +12,8 @@
 #include "BLI_span.hh"
 #include "BLI_sys_types.h" /* for bool */
 
+#include "RNA_types.hh"
+
 struct AnimData;
 struct BlendDataReader;
 struct BlendWriter;
@@ -287,6 +289,31 @@ bool BKE_animsys_rna_path_resolve(struct PointerRNA *ptr,
                                   const char *rna_path,
                                   int array_index,
                                   struct PathResolvedRNA *r_result);
+
+/**
+ * The property resolved for the last RNA path passed to #BKE_animsys_rna_path_resolve_cached.
+ * F-Curves of vector properties are stored next to each other and share their RNA path, so this
+ * avoids resolving the same path for every array element.
+ *
+ * The cache is only valid while the RNA data it was resolved on is unchanged, it is meant to be
+ * kept on the stack for a single evaluation loop.
+ */
+struct AnimsysRNAPathCache {
+  const char *rna_path = nullptr;
+  PathResolvedRNA resolved;
+  int array_len = 0;
+  bool is_resolved = false;
+};
+
+/**
+ * Same as #BKE_animsys_rna_path_resolve, but re-uses the property from \a cache when \a rna_path
+ * is the same as the previous one, only validating \a array_index.
+ */
+bool BKE_animsys_rna_path_resolve_cached(PointerRNA *ptr,
+                                         const char *rna_path,
+                                         int array_index,
+                                         AnimsysRNAPathCache &cache,
+                                         PathResolvedRNA *r_result);
 bool BKE_animsys_read_from_rna_path(struct PathResolvedRNA *anim_rna, float *r_value);
 /**
  * Write the given value to a setting using RNA, and return success.
@@ -15,6 +15,8 @@
 
 #include "BKE_bake_items.hh"
 
+struct BLI_mmap_file;
+
 namespace blender::bke::bake {
 
 /**
@@ -168,10 +170,18 @@ class DiskBlobReader : public BlobReader {
  private:
   const std::string blobs_dir_;
   mutable Mutex mutex_;
+  /**
+   * Blob files are memory mapped when possible. This way reads of different slices don't have to
+   * wait for each other and only the parts of a file that are actually read are loaded from disk.
+   * Null if the file could not be mapped.
+   */
+  mutable Map<std::string, BLI_mmap_file *> mapped_files_;
+  /** Used for files that can't be memory mapped. */
   mutable Map<std::string, std::unique_ptr<fstream>> open_input_streams_;
 
  public:
   DiskBlobReader(std::string blobs_dir);
+  ~DiskBlobReader();
   [[nodiscard]] bool read(const BlobSlice &slice, void *r_data) const override;
 };
 
@@ -10,6 +10,11 @@
  *
  * \note all registered commands must print help to the STDOUT & exit with a zero exit-code
  * when `--help` is passed in as the first argument to a command.
+ *
+ * \note Commands run after start-up has completed (add-ons loaded, preferences read),
+ * so a single command can process many jobs in one process, e.g. a list of files to convert with
+ * the IO import/export operators, resetting #Main between jobs with an empty factory-settings
+ * read instead of restarting Blender for every file.
  */
 
 #include "BLI_utility_mixins.hh"
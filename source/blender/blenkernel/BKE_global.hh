@@ -301,6 +301,12 @@ enum {
    */
   G_LIBOVERRIDE_NO_AUTO_RESYNC = 1 << 3,
 
+  /**
+   * When in background mode, only read the active scene of a blend-file and the data it uses.
+   * Typically set by the `--read-active-scene-only` command-line argument.
+   */
+  G_BACKGROUND_READ_ACTIVE_SCENE_ONLY = 1 << 4,
+
   // G_FILE_DEPRECATED_9 = (1 << 9),
   G_FILE_NO_UI = (1 << 10),
 
@@ -339,8 +345,9 @@ enum {
  * This means we can change the values without worrying about do-versions.
  */
 #define G_FILE_FLAG_ALL_RUNTIME \
-  (G_BACKGROUND_NO_DEPSGRAPH | G_LIBOVERRIDE_NO_AUTO_RESYNC | G_FILE_NO_UI | \
-   G_FILE_RECOVER_READ | G_FILE_RECOVER_WRITE)
+  (G_BACKGROUND_NO_DEPSGRAPH | G_LIBOVERRIDE_NO_AUTO_RESYNC | \
+   G_BACKGROUND_READ_ACTIVE_SCENE_ONLY | G_FILE_NO_UI | G_FILE_RECOVER_READ | \
+   G_FILE_RECOVER_WRITE)
 
 /** #Global.moving, signals drawing in (3d) window to denote transform */
 enum {
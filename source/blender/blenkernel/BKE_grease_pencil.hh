@@ -93,6 +93,10 @@ class Drawing : public ::GreasePencilDrawing {
    * The triangles for fill geometry. Grouped by each stroke.
    */
   Span<int3> triangles() const;
+  /**
+   * The offset indices for each stroke in the flat triangle cache.
+   */
+  OffsetIndices<int> triangle_offsets() const;
   /**
    * Normal vectors for a plane that fits the stroke.
    */
@@ -174,12 +178,6 @@ class Drawing : public ::GreasePencilDrawing {
    * Return the number of users (keyframes) of this drawing.
    */
   int user_count() const;
-
- private:
-  /**
-   * The offset indices for each stroke in the flat triangle cache.
-   */
-  OffsetIndices<int> triangle_offsets() const;
 };
 static_assert(sizeof(Drawing) == sizeof(::GreasePencilDrawing));
 
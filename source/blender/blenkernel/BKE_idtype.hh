@@ -67,6 +67,12 @@ enum {
    * IDs have at least an 'extra user' (#ID_TAG_EXTRAUSER).
    */
   IDTYPE_FLAGS_NEVER_UNUSED = 1 << 6,
+  /**
+   * Indicates that the #IDTypeInfo.foreach_id callback of the given IDType only accesses data
+   * owned by the ID itself (including its embedded IDs), so that the ID pointers of several IDs
+   * can be processed in parallel, e.g. when remapping them in the 'lib_link' step of file reading.
+   */
+  IDTYPE_FLAGS_THREADSAFE_FOREACH_ID = 1 << 7,
 };
 
 struct IDCacheKey {
@@ -16,6 +16,7 @@
 #include "BLI_bounds_types.hh"
 #include "BLI_implicit_sharing.hh"
 #include "BLI_kdopbvh.hh"
+#include "BLI_kdtree.h"
 #include "BLI_math_vector_types.hh"
 #include "BLI_mutex.hh"
 #include "BLI_shared_cache.hh"
@@ -189,6 +190,7 @@ struct MeshRuntime {
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_verts_no_hidden;
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_edges;
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache_loose_edges_no_hidden;
+  SharedCache<std::unique_ptr<KDTree_3d, KDTree3dDeleter>> kdtree_cache_verts;
 
   SharedCache<std::optional<int>> max_material_index;
   SharedCache<VectorSet<int>> used_material_indices;
@@ -90,6 +90,8 @@ typedef struct PTCacheData {
 
 typedef struct PTCacheFile {
   FILE *fp;
+  /** Stream buffer of `fp`, larger than the default to reduce the number of file system reads. */
+  void *fp_buffer;
 
   int frame, old_format;
   unsigned int totpoint, type;
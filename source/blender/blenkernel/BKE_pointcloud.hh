@@ -11,6 +11,7 @@
 
 #include "BLI_bounds_types.hh"
 #include "BLI_kdopbvh.hh"
+#include "BLI_kdtree.h"
 #include "BLI_math_vector_types.hh"
 #include "BLI_shared_cache.hh"
 #include "BLI_string_ref.hh"
@@ -41,6 +42,7 @@ struct PointCloudRuntime {
   std::unique_ptr<bake::BakeMaterialsList> bake_materials;
 
   SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache;
+  SharedCache<std::unique_ptr<KDTree_3d, KDTree3dDeleter>> kdtree_cache;
 
   MEM_CXX_CLASS_ALLOC_FUNCS("PointCloudRuntime");
 };
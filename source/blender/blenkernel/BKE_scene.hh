@@ -188,8 +188,13 @@ void BKE_scene_graph_evaluated_ensure(Depsgraph *depsgraph, Main *bmain);
 void BKE_scene_graph_update_for_newframe(Depsgraph *depsgraph);
 /**
  * Applies changes right away, does all sets too.
+ *
+ * \param skip_evaluated_frame: Don't evaluate the frame change when the depsgraph is already
+ * fully evaluated at the current frame of the scene. Frame change handlers still run.
  */
-void BKE_scene_graph_update_for_newframe_ex(Depsgraph *depsgraph, bool clear_recalc);
+void BKE_scene_graph_update_for_newframe_ex(Depsgraph *depsgraph,
+                                            bool clear_recalc,
+                                            bool skip_evaluated_frame = false);
 
 /**
  * Ensures given scene/view_layer pair has a valid, up-to-date depsgraph.
@@ -21,6 +21,8 @@ class TopologyRefinerImpl;
 
 namespace blender::bke::subdiv {
 
+struct MeshTopologySource;
+
 enum VtxBoundaryInterpolation {
   /* Do not interpolate boundaries. */
   SUBDIV_VTX_BOUNDARY_NONE,
@@ -168,6 +170,10 @@ struct Subdiv {
   Displacement *displacement_evaluator;
   /* Statistics for debugging. */
   SubdivStats stats;
+  /* Implicit sharing state of the mesh arrays the topology refiner was last created or compared
+   * against. Allows to skip the topology comparison when the mesh topology is known to be
+   * unchanged, for example when only positions are animated. */
+  MeshTopologySource *mesh_topology_source;
 
   /* Cached values, are not supposed to be accessed directly. */
   struct {
@@ -344,17 +344,12 @@ static bool is_fcurve_evaluatable(const FCurve *fcu)
   return true;
 }
 
-bool BKE_animsys_rna_path_resolve(
-    PointerRNA *ptr, /* typically 'fcu->rna_path', 'fcu->array_index' */
-    const char *rna_path,
-    const int array_index,
-    PathResolvedRNA *r_result)
+/* Resolve the property of an RNA path, without taking the array index into account. */
+static bool animsys_rna_path_resolve_property(PointerRNA *ptr,
+                                              const char *path,
+                                              const int array_index,
+                                              PathResolvedRNA *r_result)
 {
-  if (rna_path == nullptr) {
-    return false;
-  }
-
-  const char *path = rna_path;
   if (!RNA_path_resolve_property(ptr, path, &r_result->ptr, &r_result->prop)) {
     /* failed to get path */
     /* XXX don't tag as failed yet though, as there are some legit situations (Action Constraint)
@@ -372,8 +367,16 @@ bool BKE_animsys_rna_path_resolve(
   if (ptr->owner_id != nullptr && !RNA_property_animateable(&r_result->ptr, r_result->prop)) {
     return false;
   }
+  return true;
+}
 
-  int array_len = RNA_property_array_length(&r_result->ptr, r_result->prop);
+/* Validate the array index for an already resolved property. */
+static bool animsys_rna_path_resolve_array_index(const PointerRNA *ptr,
+                                                 const char *path,
+                                                 const int array_index,
+                                                 const int array_len,
+                                                 PathResolvedRNA *r_result)
+{
   if (array_len && array_index >= array_len) {
     if (G.debug & G_DEBUG) {
       CLOG_WARN(&LOG,
@@ -390,6 +393,52 @@ bool BKE_animsys_rna_path_resolve(
   return true;
 }
 
+bool BKE_animsys_rna_path_resolve(
+    PointerRNA *ptr, /* typically 'fcu->rna_path', 'fcu->array_index' */
+    const char *rna_path,
+    const int array_index,
+    PathResolvedRNA *r_result)
+{
+  if (rna_path == nullptr) {
+    return false;
+  }
+
+  if (!animsys_rna_path_resolve_property(ptr, rna_path, array_index, r_result)) {
+    return false;
+  }
+
+  const int array_len = RNA_property_array_length(&r_result->ptr, r_result->prop);
+  return animsys_rna_path_resolve_array_index(ptr, rna_path, array_index, array_len, r_result);
+}
+
+bool BKE_animsys_rna_path_resolve_cached(PointerRNA *ptr,
+                                         const char *rna_path,
+                                         const int array_index,
+                                         AnimsysRNAPathCache &cache,
+                                         PathResolvedRNA *r_result)
+{
+  if (rna_path == nullptr) {
+    return false;
+  }
+
+  if (cache.rna_path == nullptr || !STREQ(cache.rna_path, rna_path)) {
+    cache.rna_path = rna_path;
+    cache.is_resolved = animsys_rna_path_resolve_property(
+        ptr, rna_path, array_index, &cache.resolved);
+    cache.array_len = cache.is_resolved ?
+                          RNA_property_array_length(&cache.resolved.ptr, cache.resolved.prop) :
+                          0;
+  }
+
+  if (!cache.is_resolved) {
+    return false;
+  }
+
+  *r_result = cache.resolved;
+  return animsys_rna_path_resolve_array_index(
+      ptr, rna_path, array_index, cache.array_len, r_result);
+}
+
 /* less than 1.0 evaluates to false, use epsilon to avoid float error */
 #define ANIMSYS_FLOAT_AS_BOOL(value) ((value) > (1.0f - FLT_EPSILON))
 
@@ -573,6 +622,7 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      bool flush_to_original)
 {
   /* Calculate then execute each curve. */
+  AnimsysRNAPathCache path_cache;
   for (FCurve *fcu : fcurves) {
 
     if (!is_fcurve_evaluatable(fcu)) {
@@ -580,7 +630,9 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (BKE_animsys_rna_path_resolve_cached(
+            ptr, fcu->rna_path, fcu->array_index, path_cache, &anim_rna))
+    {
       const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
       BKE_animsys_write_to_rna_path(&anim_rna, curval);
       if (flush_to_original) {
@@ -1598,6 +1650,25 @@ static NlaEvalChannel *nlaevalchan_verify(PointerRNA *ptr, NlaEvalData *nlaeval,
   return *p_path_nec = nec;
 }
 
+/**
+ * Same as #nlaevalchan_verify, but re-uses the channel of the previous call when the path is the
+ * same. The F-Curves of a vector property are stored next to each other, so this avoids hashing
+ * the same path for every array element.
+ */
+static NlaEvalChannel *nlaevalchan_verify_cached(PointerRNA *ptr,
+                                                 NlaEvalData *nlaeval,
+                                                 const char *path,
+                                                 const char **r_last_path,
+                                                 NlaEvalChannel **r_last_nec)
+{
+  if (path != nullptr && *r_last_path != nullptr && STREQ(path, *r_last_path)) {
+    return *r_last_nec;
+  }
+  *r_last_path = path;
+  *r_last_nec = nlaevalchan_verify(ptr, nlaeval, path);
+  return *r_last_nec;
+}
+
 /* ---------------------- */
 
 /** \returns true if a solution exists and the output was written to. */
@@ -2657,12 +2728,15 @@ static void nlasnapshot_from_action(PointerRNA *ptr,
   const float modified_evaltime = evaluate_time_fmodifiers(
       &storage, modifiers, nullptr, 0.0f, evaltime);
 
+  const char *last_path = nullptr;
+  NlaEvalChannel *last_nec = nullptr;
   for (const FCurve *fcu : animrig::legacy::fcurves_for_action_slot(action, slot_handle)) {
     if (!is_fcurve_evaluatable(fcu)) {
       continue;
     }
 
-    NlaEvalChannel *nec = nlaevalchan_verify(ptr, channels, fcu->rna_path);
+    NlaEvalChannel *nec = nlaevalchan_verify_cached(
+        ptr, channels, fcu->rna_path, &last_path, &last_nec);
 
     /* Invalid path or property cannot be animated. */
     if (nec == nullptr) {
@@ -3149,13 +3223,16 @@ static void nla_eval_domain_action(PointerRNA *ptr,
     return;
   }
 
+  const char *last_path = nullptr;
+  NlaEvalChannel *last_nec = nullptr;
   for (const FCurve *fcu : animrig::legacy::fcurves_for_action_slot(act, slot_handle)) {
     /* check if this curve should be skipped */
     if (!is_fcurve_evaluatable(fcu)) {
       continue;
     }
 
-    NlaEvalChannel *nec = nlaevalchan_verify(ptr, channels, fcu->rna_path);
+    NlaEvalChannel *nec = nlaevalchan_verify_cached(
+        ptr, channels, fcu->rna_path, &last_path, &last_nec);
 
     if (nec != nullptr) {
       /* For quaternion properties, enable all sub-channels. */
@@ -21,6 +21,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 
 #include "DNA_armature_types.h"
 #include "DNA_lattice_types.h"
@@ -428,34 +429,26 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
   }
 }
 
-static void armature_vert_task(void *__restrict userdata,
-                               const int i,
-                               const TaskParallelTLS *__restrict /*tls*/)
+static void armature_vert_range_task(const ArmatureUserdata *data,
+                                     const blender::IndexRange range)
 {
-  const ArmatureUserdata *data = static_cast<const ArmatureUserdata *>(userdata);
-  const MDeformVert *dvert;
-  if (data->use_dverts || data->armature_def_nr != -1) {
+  /* Resolve where the deform weights come from once per range, instead of once per vertex. */
+  const MDeformVert *dverts = nullptr;
+  int dverts_len = 0;
+  if ((data->use_dverts || data->armature_def_nr != -1) && data->dverts != nullptr) {
+    dverts = data->dverts;
     if (data->me_target) {
-      BLI_assert(i < data->me_target->verts_num);
-      if (data->dverts != nullptr) {
-        dvert = data->dverts + i;
-      }
-      else {
-        dvert = nullptr;
-      }
-    }
-    else if (data->dverts && i < data->dverts_len) {
-      dvert = data->dverts + i;
+      BLI_assert(range.last() < data->me_target->verts_num);
+      dverts_len = int(range.one_after_last());
     }
     else {
-      dvert = nullptr;
+      dverts_len = data->dverts_len;
     }
   }
-  else {
-    dvert = nullptr;
-  }
 
-  armature_vert_task_with_dvert(data, i, dvert);
+  for (const int i : range) {
+    armature_vert_task_with_dvert(data, i, i < dverts_len ? dverts + i : nullptr);
+  }
 }
 
 static void armature_vert_task_editmesh(void *__restrict userdata,
@@ -593,10 +586,12 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     }
   }
   else {
-    TaskParallelSettings settings;
-    BLI_parallel_range_settings_defaults(&settings);
-    settings.min_iter_per_thread = 32;
-    BLI_task_parallel_range(0, vert_coords_len, &data, armature_vert_task, &settings);
+    /* Process vertices in contiguous blocks so coordinates and weights are streamed through the
+     * cache, and the per-vertex work is not dispatched through a callback. */
+    blender::threading::parallel_for(
+        blender::IndexRange(vert_coords_len), 1024, [&](const blender::IndexRange range) {
+          armature_vert_range_task(&data, range);
+        });
   }
 
   if (pchan_from_defbase) {
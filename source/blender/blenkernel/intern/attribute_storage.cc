@@ -325,6 +325,10 @@ void AttributeStorage::resize(const AttrDomain domain, const int64_t new_size)
       case bke::AttrStorageType::Array: {
         const auto &data = std::get<bke::Attribute::ArrayData>(attr.data());
         const int64_t old_size = data.size;
+        if (old_size == new_size) {
+          /* Keep sharing the existing array. */
+          return;
+        }
 
         auto new_data = bke::Attribute::ArrayData::ForUninitialized(type, new_size);
         type.copy_construct_n(data.data, new_data.data, std::min(old_size, new_size));
@@ -334,6 +338,7 @@ void AttributeStorage::resize(const AttrDomain domain, const int64_t new_size)
         }
 
         attr.assign_data(std::move(new_data));
+        return;
       }
       case bke::AttrStorageType::Single: {
         return;
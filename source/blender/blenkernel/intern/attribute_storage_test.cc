@@ -155,6 +155,37 @@ TEST(attribute_storage, MoveConstruct)
   }
 }
 
+TEST(attribute_storage, ResizeSameSizeKeepsSharing)
+{
+  AttributeStorage storage;
+
+  auto *sharing_info = new ImplicitSharedValue<Array<float>>(Span<float>{1.5f, 1.2f, 1.1f, 1.0f});
+  Attribute::ArrayData data{};
+  data.sharing_info = ImplicitSharingPtr<>(sharing_info);
+  data.data = sharing_info->data.data();
+  data.size = 4;
+  storage.add("foo", AttrDomain::Point, AttrType::Float, std::move(data));
+  /* Keep the original array alive to compare against it after resizing. */
+  sharing_info->add_user();
+
+  storage.resize(AttrDomain::Point, 4);
+  {
+    const auto &data = std::get<Attribute::ArrayData>(storage.lookup("foo")->data());
+    EXPECT_EQ(data.data, sharing_info->data.data());
+  }
+
+  storage.resize(AttrDomain::Point, 2);
+  {
+    const auto &data = std::get<Attribute::ArrayData>(storage.lookup("foo")->data());
+    EXPECT_NE(data.data, sharing_info->data.data());
+    EXPECT_EQ(data.size, 2);
+    const float *data_ptr = static_cast<const float *>(data.data);
+    EXPECT_EQ(data_ptr[0], 1.5f);
+    EXPECT_EQ(data_ptr[1], 1.2f);
+  }
+  sharing_info->remove_user_and_delete_if_last();
+}
+
 TEST(attribute_storage, UniqueNames)
 {
   AttributeStorage storage;
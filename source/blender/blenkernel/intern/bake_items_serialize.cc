@@ -2,6 +2,13 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <fcntl.h>
+#ifndef _WIN32
+#  include <unistd.h>
+#else
+#  include <io.h>
+#endif
+
 #include "BKE_anonymous_attribute_id.hh"
 #include "BKE_bake_items.hh"
 #include "BKE_bake_items_serialize.hh"
@@ -17,6 +24,7 @@
 #include "BLI_endian_defines.h"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix_types.hh"
+#include "BLI_mmap.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
 
@@ -87,8 +95,40 @@ bool BlobReader::read_as_stream(const BlobSlice &slice, FunctionRef<bool(std::is
   return true;
 }
 
+/**
+ * Opening and freeing memory mapped files updates global state that is used to handle IO errors,
+ * so it must not happen from multiple threads at the same time.
+ */
+static Mutex mmap_mutex;
+
+static BLI_mmap_file *open_mapped_file(const char *path)
+{
+  const int file = BLI_open(path, O_BINARY | O_RDONLY, 0);
+  if (file == -1) {
+    return nullptr;
+  }
+  BLI_mmap_file *mmap_file;
+  {
+    std::lock_guard lock{mmap_mutex};
+    mmap_file = BLI_mmap_open(file);
+  }
+  /* The mapping stays valid after the file is closed. */
+  close(file);
+  return mmap_file;
+}
+
 DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blobs_dir)) {}
 
+DiskBlobReader::~DiskBlobReader()
+{
+  std::lock_guard lock{mmap_mutex};
+  for (BLI_mmap_file *mmap_file : mapped_files_.values()) {
+    if (mmap_file) {
+      BLI_mmap_free(mmap_file);
+    }
+  }
+}
+
 [[nodiscard]] bool DiskBlobReader::read(const BlobSlice &slice, void *r_data) const
 {
   if (slice.range.is_empty()) {
@@ -98,16 +138,26 @@ DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blo
   char blob_path[FILE_MAX];
   BLI_path_join(blob_path, sizeof(blob_path), blobs_dir_.c_str(), slice.name.c_str());
 
-  std::lock_guard lock{mutex_};
-  std::unique_ptr<fstream> &blob_file = open_input_streams_.lookup_or_add_cb_as(blob_path, [&]() {
-    return std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary);
-  });
-  blob_file->seekg(slice.range.start());
-  blob_file->read(static_cast<char *>(r_data), slice.range.size());
-  if (blob_file->gcount() != slice.range.size()) {
-    return false;
+  BLI_mmap_file *mmap_file;
+  {
+    std::lock_guard lock{mutex_};
+    mmap_file = mapped_files_.lookup_or_add_cb_as(blob_path,
+                                                  [&]() { return open_mapped_file(blob_path); });
+    if (!mmap_file) {
+      std::unique_ptr<fstream> &blob_file = open_input_streams_.lookup_or_add_cb_as(
+          blob_path,
+          [&]() { return std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary); });
+      blob_file->seekg(slice.range.start());
+      blob_file->read(static_cast<char *>(r_data), slice.range.size());
+      if (blob_file->gcount() != slice.range.size()) {
+        return false;
+      }
+      return true;
+    }
   }
-  return true;
+  /* The mapping is only freed when the reader is destructed, so the data can be copied without
+   * holding the lock. */
+  return BLI_mmap_read(mmap_file, r_data, size_t(slice.range.start()), size_t(slice.range.size()));
 }
 
 DiskBlobWriter::DiskBlobWriter(std::string blob_dir, std::string base_name)
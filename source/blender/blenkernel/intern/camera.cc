@@ -260,7 +260,7 @@ IDTypeInfo IDType_ID_CA = {
     /*name*/ "Camera",
     /*name_plural*/ N_("cameras"),
     /*translation_context*/ BLT_I18NCONTEXT_ID_CAMERA,
-    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE,
+    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE | IDTYPE_FLAGS_THREADSAFE_FOREACH_ID,
     /*asset_type_info*/ nullptr,
 
     /*init_data*/ camera_init_data,
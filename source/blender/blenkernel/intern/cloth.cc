@@ -22,6 +22,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 
 #include "DEG_depsgraph.hh"
 #include "DEG_depsgraph_query.hh"
@@ -144,36 +145,36 @@ void bvhtree_update_from_cloth(ClothModifierData *clmd, bool moving, bool self)
   /* update vertex position in bvh tree */
   if (clmd->hairdata == nullptr) {
     if (verts && vert_tris) {
-      for (i = 0; i < cloth->primitive_num; i++) {
-        float co[3][3], co_moving[3][3];
-        bool ret;
-
-        /* copy new locations into array */
-        if (moving) {
-          copy_v3_v3(co[0], verts[vert_tris[i][0]].txold);
-          copy_v3_v3(co[1], verts[vert_tris[i][1]].txold);
-          copy_v3_v3(co[2], verts[vert_tris[i][2]].txold);
-
-          /* update moving positions */
-          copy_v3_v3(co_moving[0], verts[vert_tris[i][0]].tx);
-          copy_v3_v3(co_moving[1], verts[vert_tris[i][1]].tx);
-          copy_v3_v3(co_moving[2], verts[vert_tris[i][2]].tx);
-
-          ret = BLI_bvhtree_update_node(bvhtree, i, co[0], co_moving[0], 3);
-        }
-        else {
-          copy_v3_v3(co[0], verts[vert_tris[i][0]].tx);
-          copy_v3_v3(co[1], verts[vert_tris[i][1]].tx);
-          copy_v3_v3(co[2], verts[vert_tris[i][2]].tx);
-
-          ret = BLI_bvhtree_update_node(bvhtree, i, co[0], nullptr, 3);
-        }
+      /* Every leaf only depends on its own triangle, so they can be updated in parallel. The range
+       * is clamped to the number of leaves in the tree from #BLI_bvhtree_get_len. */
+      const int primitive_num = std::min(int(cloth->primitive_num), BLI_bvhtree_get_len(bvhtree));
+      blender::threading::parallel_for(
+          blender::IndexRange(primitive_num), 1024, [&](const blender::IndexRange range) {
+            for (const int i : range) {
+              float co[3][3], co_moving[3][3];
+
+              /* copy new locations into array */
+              if (moving) {
+                copy_v3_v3(co[0], verts[vert_tris[i][0]].txold);
+                copy_v3_v3(co[1], verts[vert_tris[i][1]].txold);
+                copy_v3_v3(co[2], verts[vert_tris[i][2]].txold);
+
+                /* update moving positions */
+                copy_v3_v3(co_moving[0], verts[vert_tris[i][0]].tx);
+                copy_v3_v3(co_moving[1], verts[vert_tris[i][1]].tx);
+                copy_v3_v3(co_moving[2], verts[vert_tris[i][2]].tx);
+
+                BLI_bvhtree_update_node(bvhtree, i, co[0], co_moving[0], 3);
+              }
+              else {
+                copy_v3_v3(co[0], verts[vert_tris[i][0]].tx);
+                copy_v3_v3(co[1], verts[vert_tris[i][1]].tx);
+                copy_v3_v3(co[2], verts[vert_tris[i][2]].tx);
 
-        /* check if tree is already full */
-        if (ret == false) {
-          break;
-        }
-      }
+                BLI_bvhtree_update_node(bvhtree, i, co[0], nullptr, 3);
+              }
+            }
+          });
 
       BLI_bvhtree_update_tree(bvhtree);
     }
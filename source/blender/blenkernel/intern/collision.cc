@@ -19,6 +19,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 
 #include "BKE_cloth.hh"
 #include "BKE_collection.hh"
@@ -126,33 +127,32 @@ void bvhtree_update_from_mvert(BVHTree *bvhtree,
     moving = false;
   }
 
-  for (int i = 0; i < tri_num; i++) {
-    float co[3][3];
-    bool ret;
+  /* Every leaf only depends on its own triangle, so they can be updated in parallel. */
+  tri_num = std::min(tri_num, BLI_bvhtree_get_len(bvhtree));
+  blender::threading::parallel_for(
+      blender::IndexRange(tri_num), 1024, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          float co[3][3];
 
-    copy_v3_v3(co[0], positions[vert_tris[i][0]]);
-    copy_v3_v3(co[1], positions[vert_tris[i][1]]);
-    copy_v3_v3(co[2], positions[vert_tris[i][2]]);
+          copy_v3_v3(co[0], positions[vert_tris[i][0]]);
+          copy_v3_v3(co[1], positions[vert_tris[i][1]]);
+          copy_v3_v3(co[2], positions[vert_tris[i][2]]);
 
-    /* copy new locations into array */
-    if (moving) {
-      float co_moving[3][3];
-      /* update moving positions */
-      copy_v3_v3(co_moving[0], positions_moving[vert_tris[i][0]]);
-      copy_v3_v3(co_moving[1], positions_moving[vert_tris[i][1]]);
-      copy_v3_v3(co_moving[2], positions_moving[vert_tris[i][2]]);
+          /* copy new locations into array */
+          if (moving) {
+            float co_moving[3][3];
+            /* update moving positions */
+            copy_v3_v3(co_moving[0], positions_moving[vert_tris[i][0]]);
+            copy_v3_v3(co_moving[1], positions_moving[vert_tris[i][1]]);
+            copy_v3_v3(co_moving[2], positions_moving[vert_tris[i][2]]);
 
-      ret = BLI_bvhtree_update_node(bvhtree, i, &co[0][0], &co_moving[0][0], 3);
-    }
-    else {
-      ret = BLI_bvhtree_update_node(bvhtree, i, &co[0][0], nullptr, 3);
-    }
-
-    /* check if tree is already full */
-    if (ret == false) {
-      break;
-    }
-  }
+            BLI_bvhtree_update_node(bvhtree, i, &co[0][0], &co_moving[0][0], 3);
+          }
+          else {
+            BLI_bvhtree_update_node(bvhtree, i, &co[0][0], nullptr, 3);
+          }
+        }
+      });
 
   BLI_bvhtree_update_tree(bvhtree);
 }
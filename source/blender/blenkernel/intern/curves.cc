@@ -149,7 +149,7 @@ IDTypeInfo IDType_ID_CV = {
     /*name*/ "Curves",
     /*name_plural*/ N_("hair_curves"),
     /*translation_context*/ BLT_I18NCONTEXT_ID_CURVES,
-    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE,
+    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE | IDTYPE_FLAGS_THREADSAFE_FOREACH_ID,
     /*asset_type_info*/ nullptr,
 
     /*init_data*/ curves_init_data,
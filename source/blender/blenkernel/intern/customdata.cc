@@ -37,6 +37,7 @@
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #ifndef NDEBUG
@@ -2361,7 +2362,20 @@ static void *copy_layer_data(const eCustomDataType type, const void *data, const
     type_info.copy(data, new_data, totelem);
   }
   else {
-    memcpy(new_data, data, size_in_bytes);
+    /* Copy big layers from multiple threads, which also spreads the first touch of the new
+     * pages over the threads instead of placing all of them on the memory of one CPU. */
+    constexpr int64_t chunk_size = 1024 * 1024;
+    const IndexRange chunks(divide_ceil_ul(uint64_t(size_in_bytes), chunk_size));
+    blender::threading::memory_bandwidth_bound_task(size_in_bytes, [&]() {
+      blender::threading::parallel_for(chunks, 1, [&](const IndexRange range) {
+        const IndexRange bytes = IndexRange(size_in_bytes)
+                                     .drop_front(range.start() * chunk_size)
+                                     .take_front(range.size() * chunk_size);
+        memcpy(POINTER_OFFSET(new_data, bytes.start()),
+               POINTER_OFFSET(data, bytes.start()),
+               size_t(bytes.size()));
+      });
+    });
   }
   return new_data;
 }
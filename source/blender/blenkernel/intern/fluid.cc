@@ -56,6 +56,7 @@
 #  include "BLI_kdtree.h"
 #  include "BLI_math_vector.hh"
 #  include "BLI_mutex.hh"
+#  include "BLI_task.hh"
 #  include "BLI_threads.h"
 #  include "BLI_voxel.h"
 
@@ -2857,52 +2858,57 @@ static void update_flowsfluids(Depsgraph *depsgraph,
   BLI_assert((velx_initial && vely_initial && velz_initial) ||
              (!velx_initial && !vely_initial && !velz_initial));
 
-  uint z;
-  /* Grid reset before writing again. */
-  for (z = 0; z < fds->res[0] * fds->res[1] * fds->res[2]; z++) {
-    /* Only reset static phi on first frame, dynamic phi gets reset every time. */
-    if (phistatic_in && is_first_frame) {
-      phistatic_in[z] = PHI_MAX;
-    }
-    if (phi_in) {
-      phi_in[z] = PHI_MAX;
-    }
-    /* Only reset static phi on first frame, dynamic phi gets reset every time. */
-    if (phioutstatic_in && is_first_frame) {
-      phioutstatic_in[z] = PHI_MAX;
-    }
-    if (phiout_in) {
-      phiout_in[z] = PHI_MAX;
-    }
-    /* Sync smoke inflow grids with their counterparts (simulation grids). */
-    if (density_in) {
-      density_in[z] = density[z];
-    }
-    if (heat_in) {
-      heat_in[z] = heat[z];
-    }
-    if (color_r_in && color_g_in && color_b_in) {
-      color_r_in[z] = color_r[z];
-      color_g_in[z] = color_b[z];
-      color_b_in[z] = color_g[z];
-    }
-    if (fuel_in) {
-      fuel_in[z] = fuel[z];
-      react_in[z] = react[z];
-    }
-    if (emission_in) {
-      emission_in[z] = 0.0f;
-    }
-    if (velx_initial && vely_initial && velz_initial) {
-      velx_initial[z] = 0.0f;
-      vely_initial[z] = 0.0f;
-      velz_initial[z] = 0.0f;
-    }
-    /* Reset forces here as update_effectors() is skipped when no external forces are present. */
-    forcex[z] = 0.0f;
-    forcey[z] = 0.0f;
-    forcez[z] = 0.0f;
-  }
+  /* Grid reset before writing again. Every cell is written independently, so the reset of the
+   * (potentially very large) domain grids is split over threads. */
+  const int64_t cells_num = int64_t(fds->res[0]) * fds->res[1] * fds->res[2];
+  blender::threading::parallel_for(
+      blender::IndexRange(cells_num), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t z : range) {
+          /* Only reset static phi on first frame, dynamic phi gets reset every time. */
+          if (phistatic_in && is_first_frame) {
+            phistatic_in[z] = PHI_MAX;
+          }
+          if (phi_in) {
+            phi_in[z] = PHI_MAX;
+          }
+          /* Only reset static phi on first frame, dynamic phi gets reset every time. */
+          if (phioutstatic_in && is_first_frame) {
+            phioutstatic_in[z] = PHI_MAX;
+          }
+          if (phiout_in) {
+            phiout_in[z] = PHI_MAX;
+          }
+          /* Sync smoke inflow grids with their counterparts (simulation grids). */
+          if (density_in) {
+            density_in[z] = density[z];
+          }
+          if (heat_in) {
+            heat_in[z] = heat[z];
+          }
+          if (color_r_in && color_g_in && color_b_in) {
+            color_r_in[z] = color_r[z];
+            color_g_in[z] = color_b[z];
+            color_b_in[z] = color_g[z];
+          }
+          if (fuel_in) {
+            fuel_in[z] = fuel[z];
+            react_in[z] = react[z];
+          }
+          if (emission_in) {
+            emission_in[z] = 0.0f;
+          }
+          if (velx_initial && vely_initial && velz_initial) {
+            velx_initial[z] = 0.0f;
+            vely_initial[z] = 0.0f;
+            velz_initial[z] = 0.0f;
+          }
+          /* Reset forces here as update_effectors() is skipped when no external forces are
+           * present. */
+          forcex[z] = 0.0f;
+          forcey[z] = 0.0f;
+          forcez[z] = 0.0f;
+        }
+      });
 
   /* Apply emission data for every flow object. */
   for (int flow_index = 0; flow_index < numflowobjs; flow_index++) {
@@ -593,9 +593,11 @@ void BKE_image_free_old_gputextures(Main *bmain)
 
   /*
    * Run garbage collector once for every collecting period of time
-   * if textimeout is 0, that's the option to NOT run the collector
+   * if textimeout is 0, that's the option to NOT run the collector.
+   * Compare against the last run instead of requiring the current time to be a multiple of the
+   * period, this is only called on redraw and would otherwise skip most collections.
    */
-  if (U.textimeout == 0 || ctime % U.texcollectrate || ctime == lasttime) {
+  if (U.textimeout == 0 || ctime - lasttime < U.texcollectrate) {
     return;
   }
 
@@ -191,8 +191,15 @@ Instances &Instances::operator=(Instances &&other)
 void Instances::resize(int capacity)
 {
   const int old_size = this->instances_num();
+  if (capacity == old_size) {
+    /* Avoid copying attributes that are shared with other instances. */
+    return;
+  }
   attributes_.resize(AttrDomain::Instance, capacity);
   instances_num_ = capacity;
+  if (capacity < old_size) {
+    return;
+  }
   fill_attribute_range_default(this->attributes_for_write(),
                                AttrDomain::Instance,
                                {},
@@ -20,6 +20,7 @@
 #include "BLI_string.h"
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -57,6 +58,7 @@
 #include "BLO_read_write.hh"
 
 using blender::float3;
+using blender::IndexRange;
 using blender::float4x4;
 using blender::MutableSpan;
 using blender::Span;
@@ -906,6 +908,28 @@ static void key_evaluate_relative(const int start,
          * maintain a constant offset. */
         reffrom = static_cast<char *>(refb->data);
 
+        if (mode == KEY_MODE_DUMMY && key->elemstr[1] == IPO_FLOAT && key->elemstr[2] == 0) {
+          /* Meshes and lattices only store coordinates, blend them with a typed loop which is
+           * split over threads for dense meshes. */
+          BLI_assert(key->elemsize == sizeof(float3));
+          float3 *dst = reinterpret_cast<float3 *>(basispoin);
+          const float3 *ref_co = reinterpret_cast<const float3 *>(reffrom);
+          const float3 *key_co = reinterpret_cast<const float3 *>(from);
+          blender::threading::parallel_for(
+              IndexRange(start, end - start), 4096, [&](const IndexRange range) {
+                for (const int i : range) {
+                  const float fac = weights ? weights[i - start] * icuval : icuval;
+                  if (fac != 0.0f) {
+                    dst[i] -= fac * (ref_co[i] - key_co[i]);
+                  }
+                }
+              });
+          if (freefrom) {
+            MEM_freeN(freefrom);
+          }
+          continue;
+        }
+
         poin += start * poinsize;
         reffrom += key->elemsize * start; /* key elemsize yes! */
         from += key->elemsize * start;
@@ -175,7 +175,7 @@ IDTypeInfo IDType_ID_LT = {
     /*name*/ "Lattice",
     /*name_plural*/ N_("lattices"),
     /*translation_context*/ BLT_I18NCONTEXT_ID_LATTICE,
-    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE,
+    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE | IDTYPE_FLAGS_THREADSAFE_FOREACH_ID,
     /*asset_type_info*/ nullptr,
 
     /*init_data*/ lattice_init_data,
@@ -1113,6 +1113,12 @@ static void layer_collection_sync(ViewLayer *view_layer,
 
   BLI_assert(layer_resync->is_used);
 
+  /* When the hierarchy did not change, the old children layers are found in the same order as the
+   * children collections. Checking the next one first avoids searching through all the siblings
+   * for each child, which is quadratic for collections with many children. */
+  LayerCollectionResync *child_layer_resync_next = static_cast<LayerCollectionResync *>(
+      layer_resync->children_layer_resync.first);
+
   uint64_t skipped_children = 0;
   LISTBASE_FOREACH (CollectionChild *, child, &layer_resync->collection->children) {
     Collection *child_collection = child->collection;
@@ -1121,8 +1127,19 @@ static void layer_collection_sync(ViewLayer *view_layer,
       skipped_children++;
       continue;
     }
-    LayerCollectionResync *child_layer_resync = layer_collection_resync_find(layer_resync,
-                                                                             child_collection);
+    LayerCollectionResync *child_layer_resync = nullptr;
+    if (child_layer_resync_next != nullptr && child_layer_resync_next->is_usable &&
+        child_layer_resync_next->collection == child_collection)
+    {
+      child_layer_resync = child_layer_resync_next;
+    }
+    else {
+      child_layer_resync = layer_collection_resync_find(layer_resync, child_collection);
+    }
+    if (child_layer_resync != nullptr && child_layer_resync->parent_layer_resync == layer_resync)
+    {
+      child_layer_resync_next = child_layer_resync->next;
+    }
 
     if (child_layer_resync != nullptr) {
       BLI_assert(child_layer_resync->collection != nullptr);
@@ -1767,6 +1767,29 @@ ID *BKE_libblock_find_name_and_library_filepath(Main *bmain,
   return nullptr;
 }
 
+/**
+ * Check whether the ID already is at a valid position in its sorted list, by only looking at its
+ * direct neighbors. At least one of them has to be from the same library, otherwise the ID may be
+ * in the 'range' of another library.
+ */
+static bool id_sort_by_name_is_sorted(const ID *id)
+{
+  const ID *id_prev = static_cast<const ID *>(id->prev);
+  const ID *id_next = static_cast<const ID *>(id->next);
+  const bool is_prev_same_lib = id_prev != nullptr && id_prev->lib == id->lib;
+  const bool is_next_same_lib = id_next != nullptr && id_next->lib == id->lib;
+  if (!is_prev_same_lib && !is_next_same_lib) {
+    return false;
+  }
+  if (is_prev_same_lib && BLI_strcasecmp(id_prev->name, id->name) > 0) {
+    return false;
+  }
+  if (is_next_same_lib && BLI_strcasecmp(id_next->name, id->name) < 0) {
+    return false;
+  }
+  return true;
+}
+
 void id_sort_by_name(ListBase *lb, ID *id, ID *id_sorting_hint)
 {
 #define ID_SORT_STEP_SIZE 512
@@ -1778,6 +1801,12 @@ void id_sort_by_name(ListBase *lb, ID *id, ID *id_sorting_hint)
     return;
   }
 
+  /* Common when validating the names of many IDs (e.g. on link or append), or when renaming
+   * without changing the order. Avoids walking potentially huge lists for each of them. */
+  if (id_sort_by_name_is_sorted(id)) {
+    return;
+  }
+
   BLI_remlink(lb, id);
 
   /* Check if we can actually insert id before or after id_sorting_hint, if given. */
@@ -111,6 +111,38 @@ TEST(lib_id_main_sort, linked_ids_1)
   EXPECT_EQ(ctx.bmain->name_map_global, nullptr);
 }
 
+TEST(lib_id_main_sort, linked_ids_already_sorted)
+{
+  LibIDMainSortTestContext ctx;
+  EXPECT_TRUE(BLI_listbase_is_empty(&ctx.bmain->libraries));
+
+  Library *lib_a = static_cast<Library *>(BKE_id_new(ctx.bmain, ID_LI, "LI_A"));
+  ID *id_c = static_cast<ID *>(BKE_id_new(ctx.bmain, ID_OB, "OB_C"));
+  ID *id_a = static_cast<ID *>(BKE_id_new(ctx.bmain, ID_OB, "OB_A"));
+  ID *id_b = static_cast<ID *>(BKE_id_new(ctx.bmain, ID_OB, "OB_B"));
+
+  change_lib(ctx.bmain, id_c, lib_a);
+  id_sort_by_name(&ctx.bmain->objects, id_c, nullptr);
+  test_lib_id_main_sort_check_order({id_a, id_b, id_c});
+
+  /* Renaming without changing the order, or re-sorting a sorted ID, keeps it in place. */
+  change_name(ctx.bmain, id_a, "OB_AA", IDNewNameMode::RenameExistingNever);
+  test_lib_id_main_sort_check_order({id_a, id_b, id_c});
+  id_sort_by_name(&ctx.bmain->objects, id_b, nullptr);
+  test_lib_id_main_sort_check_order({id_a, id_b, id_c});
+
+  /* The last local ID moving to the adjacent library range stays in place too. */
+  change_lib(ctx.bmain, id_b, lib_a);
+  id_sort_by_name(&ctx.bmain->objects, id_b, nullptr);
+  test_lib_id_main_sort_check_order({id_a, id_b, id_c});
+
+  /* Renaming past the other linked ID still moves it. */
+  change_name(ctx.bmain, id_b, "OB_D", IDNewNameMode::RenameExistingNever);
+  test_lib_id_main_sort_check_order({id_a, id_c, id_b});
+
+  EXPECT_TRUE(BKE_main_namemap_validate(*ctx.bmain));
+}
+
 TEST(lib_id_main_unique_name, local_ids_rename_existing_never)
 {
   LibIDMainSortTestContext ctx;
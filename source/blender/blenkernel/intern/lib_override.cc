@@ -4759,21 +4759,9 @@ void BKE_lib_override_library_main_operations_create(Main *bmain,
     BKE_lib_override_library_main_tag(bmain, LIBOVERRIDE_PROP_OP_TAG_UNUSED, true);
   }
 
-  /* Usual pose bones issue, need to be done outside of the threaded process or we may run into
-   * concurrency issues here.
-   * Note that calling #BKE_pose_ensure again in thread in
-   * #BKE_lib_override_library_operations_create is not a problem then. */
-  LISTBASE_FOREACH (Object *, ob, &bmain->objects) {
-    if (ob->type == OB_ARMATURE) {
-      BLI_assert(ob->data != nullptr);
-      BKE_pose_ensure(bmain, ob, static_cast<bArmature *>(ob->data), true);
-    }
-  }
-
-  LibOverrideOpCreateData create_pool_data{};
-  create_pool_data.bmain = bmain;
-  create_pool_data.report_flags = RNA_OVERRIDE_MATCH_RESULT_INIT;
-  TaskPool *task_pool = BLI_task_pool_create(&create_pool_data, TASK_PRIORITY_HIGH);
+  /* Only the overrides that actually need to be diffed are gathered here, this is usually a small
+   * subset of all overrides when not forcing an update (e.g. on undo pushes). */
+  blender::Vector<ID *> ids_to_process;
 
   FOREACH_MAIN_ID_BEGIN (bmain, id) {
     if (ID_IS_LINKED(id) || !ID_IS_OVERRIDE_LIBRARY_REAL(id)) {
@@ -4803,20 +4791,10 @@ void BKE_lib_override_library_main_operations_create(Main *bmain,
     }
 
     if (force_auto || (id->tag & ID_TAG_LIBOVERRIDE_AUTOREFRESH)) {
-      /* Usual issue with pose, it's quiet rare but sometimes they may not be up to date when this
-       * function is called. */
-      if (GS(id->name) == ID_OB) {
-        Object *ob = reinterpret_cast<Object *>(id);
-        if (ob->type == OB_ARMATURE) {
-          BLI_assert(ob->data != nullptr);
-          BKE_pose_ensure(bmain, ob, static_cast<bArmature *>(ob->data), true);
-        }
-      }
       /* Only check overrides if we do have the real reference data available, and not some empty
        * 'placeholder' for missing data (broken links). */
       if ((id->override_library->reference->tag & ID_TAG_MISSING) == 0) {
-        BLI_task_pool_push(
-            task_pool, lib_override_library_operations_create_cb, id, false, nullptr);
+        ids_to_process.append(id);
       }
       else {
         BKE_lib_override_library_properties_tag(
@@ -4833,6 +4811,34 @@ void BKE_lib_override_library_main_operations_create(Main *bmain,
   }
   FOREACH_MAIN_ID_END;
 
+  /* Usual pose bones issue, need to be done outside of the threaded process or we may run into
+   * concurrency issues here. Sometimes they may not be up to date when this function is called.
+   * Note that calling #BKE_pose_ensure again in thread in
+   * #BKE_lib_override_library_operations_create is not a problem then. */
+  for (ID *id_to_process : ids_to_process) {
+    if (GS(id_to_process->name) != ID_OB) {
+      continue;
+    }
+    Object *ob = reinterpret_cast<Object *>(id_to_process);
+    if (ob->type == OB_ARMATURE) {
+      Object *ob_reference = reinterpret_cast<Object *>(ob->id.override_library->reference);
+      BLI_assert(ob->data != nullptr);
+      BLI_assert(ob_reference->data != nullptr);
+      BKE_pose_ensure(bmain, ob, static_cast<bArmature *>(ob->data), true);
+      BKE_pose_ensure(bmain, ob_reference, static_cast<bArmature *>(ob_reference->data), true);
+    }
+  }
+
+  LibOverrideOpCreateData create_pool_data{};
+  create_pool_data.bmain = bmain;
+  create_pool_data.report_flags = RNA_OVERRIDE_MATCH_RESULT_INIT;
+  TaskPool *task_pool = BLI_task_pool_create(&create_pool_data, TASK_PRIORITY_HIGH);
+
+  for (ID *id_to_process : ids_to_process) {
+    BLI_task_pool_push(
+        task_pool, lib_override_library_operations_create_cb, id_to_process, false, nullptr);
+  }
+
   BLI_task_pool_work_and_wait(task_pool);
 
   BLI_task_pool_free(task_pool);
@@ -170,7 +170,7 @@ IDTypeInfo IDType_ID_LA = {
     /*name*/ "Light",
     /*name_plural*/ N_("lights"),
     /*translation_context*/ BLT_I18NCONTEXT_ID_LIGHT,
-    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE,
+    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE | IDTYPE_FLAGS_THREADSAFE_FOREACH_ID,
     /*asset_type_info*/ nullptr,
 
     /*init_data*/ light_init_data,
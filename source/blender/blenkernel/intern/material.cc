@@ -239,7 +239,7 @@ IDTypeInfo IDType_ID_MA = {
     /*name*/ "Material",
     /*name_plural*/ N_("materials"),
     /*translation_context*/ BLT_I18NCONTEXT_ID_MATERIAL,
-    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE,
+    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE | IDTYPE_FLAGS_THREADSAFE_FOREACH_ID,
     /*asset_type_info*/ nullptr,
 
     /*init_data*/ material_init_data,
@@ -169,6 +169,7 @@ Mesh *BKE_mesh_remesh_quadriflow(const Mesh *mesh,
 static openvdb::FloatGrid::Ptr remesh_voxel_level_set_create(
     const Mesh *mesh, openvdb::math::Transform::Ptr transform)
 {
+  using namespace blender;
   const Span<float3> positions = mesh->vert_positions();
   const Span<int> corner_verts = mesh->corner_verts();
   const Span<int3> corner_tris = mesh->corner_tris();
@@ -176,16 +177,20 @@ static openvdb::FloatGrid::Ptr remesh_voxel_level_set_create(
   std::vector<openvdb::Vec3s> points(mesh->verts_num);
   std::vector<openvdb::Vec3I> triangles(corner_tris.size());
 
-  for (const int i : IndexRange(mesh->verts_num)) {
-    const float3 &co = positions[i];
-    points[i] = openvdb::Vec3s(co.x, co.y, co.z);
-  }
+  threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const float3 &co = positions[i];
+      points[i] = openvdb::Vec3s(co.x, co.y, co.z);
+    }
+  });
 
-  for (const int i : IndexRange(corner_tris.size())) {
-    const int3 &tri = corner_tris[i];
-    triangles[i] = openvdb::Vec3I(
-        corner_verts[tri[0]], corner_verts[tri[1]], corner_verts[tri[2]]);
-  }
+  threading::parallel_for(corner_tris.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int3 &tri = corner_tris[i];
+      triangles[i] = openvdb::Vec3I(
+          corner_verts[tri[0]], corner_verts[tri[1]], corner_verts[tri[2]]);
+    }
+  });
 
   openvdb::FloatGrid::Ptr grid = openvdb::tools::meshToLevelSet<openvdb::FloatGrid>(
       *transform, points, triangles, 1.0f);
@@ -219,24 +224,30 @@ static Mesh *remesh_voxel_volume_to_mesh(const openvdb::FloatGrid::Ptr level_set
         3, triangle_loop_start, face_offsets.drop_front(quads.size()));
   }
 
-  for (const int i : vert_positions.index_range()) {
-    vert_positions[i] = float3(vertices[i].x(), vertices[i].y(), vertices[i].z());
-  }
+  threading::parallel_for(vert_positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      vert_positions[i] = float3(vertices[i].x(), vertices[i].y(), vertices[i].z());
+    }
+  });
 
-  for (const int i : IndexRange(quads.size())) {
-    const int loopstart = i * 4;
-    mesh_corner_verts[loopstart] = quads[i][0];
-    mesh_corner_verts[loopstart + 1] = quads[i][3];
-    mesh_corner_verts[loopstart + 2] = quads[i][2];
-    mesh_corner_verts[loopstart + 3] = quads[i][1];
-  }
+  threading::parallel_for(IndexRange(quads.size()), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int loopstart = i * 4;
+      mesh_corner_verts[loopstart] = quads[i][0];
+      mesh_corner_verts[loopstart + 1] = quads[i][3];
+      mesh_corner_verts[loopstart + 2] = quads[i][2];
+      mesh_corner_verts[loopstart + 3] = quads[i][1];
+    }
+  });
 
-  for (const int i : IndexRange(tris.size())) {
-    const int loopstart = triangle_loop_start + i * 3;
-    mesh_corner_verts[loopstart] = tris[i][2];
-    mesh_corner_verts[loopstart + 1] = tris[i][1];
-    mesh_corner_verts[loopstart + 2] = tris[i][0];
-  }
+  threading::parallel_for(IndexRange(tris.size()), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int loopstart = triangle_loop_start + i * 3;
+      mesh_corner_verts[loopstart] = tris[i][2];
+      mesh_corner_verts[loopstart + 1] = tris[i][1];
+      mesh_corner_verts[loopstart + 2] = tris[i][0];
+    }
+  });
 
   mesh_calc_edges(*mesh, false, false);
 
@@ -308,9 +319,11 @@ static void calc_edge_centers(const Span<float3> positions,
                               const Span<int2> edges,
                               MutableSpan<float3> edge_centers)
 {
-  for (const int i : edges.index_range()) {
-    edge_centers[i] = math::midpoint(positions[edges[i][0]], positions[edges[i][1]]);
-  }
+  threading::parallel_for(edges.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      edge_centers[i] = math::midpoint(positions[edges[i][0]], positions[edges[i][1]]);
+    }
+  });
 }
 
 static void calc_face_centers(const Span<float3> positions,
@@ -318,9 +331,11 @@ static void calc_face_centers(const Span<float3> positions,
                               const Span<int> corner_verts,
                               MutableSpan<float3> face_centers)
 {
-  for (const int i : faces.index_range()) {
-    face_centers[i] = mesh::face_center_calc(positions, corner_verts.slice(faces[i]));
-  }
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      face_centers[i] = mesh::face_center_calc(positions, corner_verts.slice(faces[i]));
+    }
+  });
 }
 
 static void find_nearest_tris(const Span<float3> positions,
@@ -57,6 +57,7 @@ static void free_bvh_caches(MeshRuntime &mesh_runtime)
   mesh_runtime.bvh_cache_loose_verts_no_hidden.tag_dirty();
   mesh_runtime.bvh_cache_loose_edges.tag_dirty();
   mesh_runtime.bvh_cache_loose_edges_no_hidden.tag_dirty();
+  mesh_runtime.kdtree_cache_verts.tag_dirty();
 }
 
 MeshRuntime::MeshRuntime() = default;
@@ -277,6 +278,21 @@ blender::Span<blender::int3> Mesh::corner_tris() const
   return this->runtime->corner_tris_cache.data.data();
 }
 
+const KDTree_3d &Mesh::kdtree_verts() const
+{
+  this->runtime->kdtree_cache_verts.ensure(
+      [&](std::unique_ptr<KDTree_3d, KDTree3dDeleter> &r_data) {
+        const Span<float3> positions = this->vert_positions();
+        KDTree_3d *tree = BLI_kdtree_3d_new(positions.size());
+        for (const int i : positions.index_range()) {
+          BLI_kdtree_3d_insert(tree, i, positions[i]);
+        }
+        BLI_kdtree_3d_balance(tree);
+        r_data.reset(tree);
+      });
+  return *this->runtime->kdtree_cache_verts.data();
+}
+
 blender::Span<int> Mesh::corner_tri_faces() const
 {
   using namespace blender;
@@ -19,6 +19,7 @@
 #include "BLI_math_matrix.hh"
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
@@ -584,9 +585,12 @@ static void ensure_displacement_grids(Mesh *mesh, const int grid_level)
   const int num_grids = mesh->corners_num;
   MDisps *mdisps = static_cast<MDisps *>(
       CustomData_get_layer_for_write(&mesh->corner_data, CD_MDISPS, mesh->corners_num));
-  for (int grid_index = 0; grid_index < num_grids; grid_index++) {
-    ensure_displacement_grid(&mdisps[grid_index], grid_level);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(num_grids), 4096, [&](const blender::IndexRange range) {
+        for (const int grid_index : range) {
+          ensure_displacement_grid(&mdisps[grid_index], grid_level);
+        }
+      });
 }
 
 static void ensure_mask_grids(Mesh *mesh, const int level)
@@ -599,18 +603,21 @@ static void ensure_mask_grids(Mesh *mesh, const int level)
   const int num_grids = mesh->corners_num;
   const int grid_size = blender::bke::subdiv::grid_size_from_level(level);
   const int grid_area = grid_size * grid_size;
-  for (int grid_index = 0; grid_index < num_grids; grid_index++) {
-    GridPaintMask *grid_paint_mask = &grid_paint_masks[grid_index];
-    if (grid_paint_mask->level >= level) {
-      continue;
-    }
-    grid_paint_mask->level = level;
-    if (grid_paint_mask->data) {
-      MEM_freeN(grid_paint_mask->data);
-    }
-    /* TODO(sergey): Preserve data on the old level. */
-    grid_paint_mask->data = MEM_calloc_arrayN<float>(grid_area, "gpm.data");
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(num_grids), 4096, [&](const blender::IndexRange range) {
+        for (const int grid_index : range) {
+          GridPaintMask *grid_paint_mask = &grid_paint_masks[grid_index];
+          if (grid_paint_mask->level >= level) {
+            continue;
+          }
+          grid_paint_mask->level = level;
+          if (grid_paint_mask->data) {
+            MEM_freeN(grid_paint_mask->data);
+          }
+          /* TODO(sergey): Preserve data on the old level. */
+          grid_paint_mask->data = MEM_calloc_arrayN<float>(grid_area, "gpm.data");
+        }
+      });
 }
 
 void multires_reshape_ensure_grids(Mesh *mesh, const int level)
@@ -637,23 +644,26 @@ void multires_reshape_store_original_grids(MultiresReshapeContext *reshape_conte
   }
 
   const int num_grids = reshape_context->num_grids;
-  for (int grid_index = 0; grid_index < num_grids; grid_index++) {
-    MDisps *orig_grid = &orig_mdisps[grid_index];
-    /* Ignore possibly invalid/non-allocated original grids. They will be replaced with 0 original
-     * data when accessed during reshape process.
-     * Reshape process will ensure all grids are on top level, but that happens on separate set of
-     * grids which eventually replaces original one. */
-    if (orig_grid->disps != nullptr) {
-      orig_grid->disps = static_cast<float(*)[3]>(MEM_dupallocN(orig_grid->disps));
-    }
-    if (orig_grid_paint_masks != nullptr) {
-      GridPaintMask *orig_paint_mask_grid = &orig_grid_paint_masks[grid_index];
-      if (orig_paint_mask_grid->data != nullptr) {
-        orig_paint_mask_grid->data = static_cast<float *>(
-            MEM_dupallocN(orig_paint_mask_grid->data));
-      }
-    }
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(num_grids), 4096, [&](const blender::IndexRange range) {
+        for (const int grid_index : range) {
+          MDisps *orig_grid = &orig_mdisps[grid_index];
+          /* Ignore possibly invalid/non-allocated original grids. They will be replaced with 0
+           * original data when accessed during reshape process.
+           * Reshape process will ensure all grids are on top level, but that happens on separate
+           * set of grids which eventually replaces original one. */
+          if (orig_grid->disps != nullptr) {
+            orig_grid->disps = static_cast<float(*)[3]>(MEM_dupallocN(orig_grid->disps));
+          }
+          if (orig_grid_paint_masks != nullptr) {
+            GridPaintMask *orig_paint_mask_grid = &orig_grid_paint_masks[grid_index];
+            if (orig_paint_mask_grid->data != nullptr) {
+              orig_paint_mask_grid->data = static_cast<float *>(
+                  MEM_dupallocN(orig_paint_mask_grid->data));
+            }
+          }
+        }
+      });
 
   reshape_context->orig.mdisps = orig_mdisps;
   reshape_context->orig.grid_paint_masks = orig_grid_paint_masks;
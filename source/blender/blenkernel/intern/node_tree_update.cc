@@ -304,6 +304,8 @@ class NodeTreeMainUpdater {
   Map<bNodeTree *, TreeUpdateResult> update_result_by_tree_;
   NodeTreeRelations relations_;
   bool needs_relations_update_ = false;
+  /** Trees whose node previews have been tagged dirty already during this update. */
+  Set<const bNodeTree *> trees_with_dirty_previews_;
 
  public:
   NodeTreeMainUpdater(Main *bmain, const NodeTreeUpdateExtraParams &params)
@@ -809,6 +811,11 @@ class NodeTreeMainUpdater {
 
   void make_node_previews_dirty(bNodeTree &ntree)
   {
+    /* A group used by many group nodes, possibly in many updated trees, only has to be tagged
+     * once. Otherwise deeply nested groups are visited once for every path leading to them. */
+    if (!trees_with_dirty_previews_.add(&ntree)) {
+      return;
+    }
     ntree.runtime->previews_refresh_state++;
     for (bNode *node : ntree.all_nodes()) {
       if (!node->is_group()) {
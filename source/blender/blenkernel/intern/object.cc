@@ -1092,7 +1092,7 @@ IDTypeInfo IDType_ID_OB = {
     /*name*/ "Object",
     /*name_plural*/ N_("objects"),
     /*translation_context*/ BLT_I18NCONTEXT_ID_OBJECT,
-    /*flags*/ 0,
+    /*flags*/ IDTYPE_FLAGS_THREADSAFE_FOREACH_ID,
     /*asset_type_info*/ &AssetType_OB,
 
     /*init_data*/ object_init_data,
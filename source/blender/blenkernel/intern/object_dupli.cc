@@ -149,6 +149,15 @@ struct DupliGenerator {
 
 static const DupliGenerator *get_dupli_generator(const DupliContext *ctx);
 
+/**
+ * Cheap check for objects that can never generate instances, to avoid creating a sub-context for
+ * them. #get_dupli_generator returns null for these.
+ */
+static bool object_may_generate_duplis(const Object &ob)
+{
+  return (ob.transflag & OB_DUPLI) != 0 || blender::bke::object_has_geometry_set_instances(ob);
+}
+
 /**
  * Create initial context for root object.
  */
@@ -1009,6 +1018,11 @@ static void make_duplis_geometry_set_impl(const DupliContext *ctx,
         mul_m4_m4m4(matrix, parent_transform, instance_offset_matrices[i].ptr());
         make_dupli(ctx_for_instance, &object, matrix, id, &geometry_set, i);
 
+        if (!object_may_generate_duplis(object)) {
+          /* Skip the sub-context when scattering many simple objects. */
+          break;
+        }
+
         float space_matrix[4][4];
         mul_m4_m4m4(
             space_matrix, instance_offset_matrices[i].ptr(), object.world_to_object().ptr());
@@ -1748,7 +1762,7 @@ static const DupliGenerator *get_dupli_generator(const DupliContext *ctx)
   int transflag = ctx->object->transflag;
   int visibility_flag = ctx->object->visibility_flag;
 
-  if ((transflag & OB_DUPLI) == 0 && ctx->object->runtime->geometry_set_eval == nullptr) {
+  if (!object_may_generate_duplis(*ctx->object)) {
     return nullptr;
   }
 
@@ -24,6 +24,7 @@
 #include "BLI_path_utils.hh"
 #include "BLI_rand.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_image.hh"
@@ -792,6 +793,63 @@ bool BKE_ocean_init_from_modifier(Ocean *ocean, OceanModifierData const *omd, co
                         omd->seed);
 }
 
+/**
+ * Fill one row of the initial wave amplitudes (`_h0` and `_h0_minus`).
+ */
+static void ocean_init_spectrum_row(Ocean *o, RNG *rng, const int seed, const int i)
+{
+  for (int j = 0; j < o->_N; j++) {
+    /* This ensures we get a value tied to the surface location, avoiding dramatic surface
+     * change with changing resolution.
+     * Explicitly cast to signed int first to ensure consistent behavior on all processors,
+     * since behavior of `float` to `uint` cast is undefined in C. */
+    const int hash_x = o->_kx[i] * 360.0f;
+    const int hash_z = o->_kz[j] * 360.0f;
+    int new_seed = seed + BLI_hash_int_2d(hash_x, hash_z);
+
+    BLI_rng_seed(rng, new_seed);
+    float r1 = gaussRand(rng);
+    float r2 = gaussRand(rng);
+
+    fftw_complex r1r2;
+    init_complex(r1r2, r1, r2);
+    switch (o->_spectrum) {
+      case MOD_OCEAN_SPECTRUM_JONSWAP:
+        mul_complex_f(o->_h0[i * o->_N + j],
+                      r1r2,
+                      sqrt(BLI_ocean_spectrum_jonswap(o, o->_kx[i], o->_kz[j]) / 2.0f));
+        mul_complex_f(o->_h0_minus[i * o->_N + j],
+                      r1r2,
+                      sqrt(BLI_ocean_spectrum_jonswap(o, -o->_kx[i], -o->_kz[j]) / 2.0f));
+        break;
+      case MOD_OCEAN_SPECTRUM_TEXEL_MARSEN_ARSLOE:
+        mul_complex_f(
+            o->_h0[i * o->_N + j],
+            r1r2,
+            sqrt(BLI_ocean_spectrum_texelmarsenarsloe(o, o->_kx[i], o->_kz[j]) / 2.0f));
+        mul_complex_f(
+            o->_h0_minus[i * o->_N + j],
+            r1r2,
+            sqrt(BLI_ocean_spectrum_texelmarsenarsloe(o, -o->_kx[i], -o->_kz[j]) / 2.0f));
+        break;
+      case MOD_OCEAN_SPECTRUM_PIERSON_MOSKOWITZ:
+        mul_complex_f(o->_h0[i * o->_N + j],
+                      r1r2,
+                      sqrt(BLI_ocean_spectrum_piersonmoskowitz(o, o->_kx[i], o->_kz[j]) / 2.0f));
+        mul_complex_f(
+            o->_h0_minus[i * o->_N + j],
+            r1r2,
+            sqrt(BLI_ocean_spectrum_piersonmoskowitz(o, -o->_kx[i], -o->_kz[j]) / 2.0f));
+        break;
+      default:
+        mul_complex_f(o->_h0[i * o->_N + j], r1r2, sqrt(Ph(o, o->_kx[i], o->_kz[j]) / 2.0f));
+        mul_complex_f(
+            o->_h0_minus[i * o->_N + j], r1r2, sqrt(Ph(o, -o->_kx[i], -o->_kz[j]) / 2.0f));
+        break;
+    }
+  }
+}
+
 bool BKE_ocean_init(Ocean *o,
                     int M,
                     int N,
@@ -906,60 +964,16 @@ bool BKE_ocean_init(Ocean *o,
     }
   }
 
-  RNG *rng = BLI_rng_new(seed);
-
-  for (i = 0; i < o->_M; i++) {
-    for (j = 0; j < o->_N; j++) {
-      /* This ensures we get a value tied to the surface location, avoiding dramatic surface
-       * change with changing resolution.
-       * Explicitly cast to signed int first to ensure consistent behavior on all processors,
-       * since behavior of `float` to `uint` cast is undefined in C. */
-      const int hash_x = o->_kx[i] * 360.0f;
-      const int hash_z = o->_kz[j] * 360.0f;
-      int new_seed = seed + BLI_hash_int_2d(hash_x, hash_z);
-
-      BLI_rng_seed(rng, new_seed);
-      float r1 = gaussRand(rng);
-      float r2 = gaussRand(rng);
-
-      fftw_complex r1r2;
-      init_complex(r1r2, r1, r2);
-      switch (o->_spectrum) {
-        case MOD_OCEAN_SPECTRUM_JONSWAP:
-          mul_complex_f(o->_h0[i * o->_N + j],
-                        r1r2,
-                        sqrt(BLI_ocean_spectrum_jonswap(o, o->_kx[i], o->_kz[j]) / 2.0f));
-          mul_complex_f(o->_h0_minus[i * o->_N + j],
-                        r1r2,
-                        sqrt(BLI_ocean_spectrum_jonswap(o, -o->_kx[i], -o->_kz[j]) / 2.0f));
-          break;
-        case MOD_OCEAN_SPECTRUM_TEXEL_MARSEN_ARSLOE:
-          mul_complex_f(
-              o->_h0[i * o->_N + j],
-              r1r2,
-              sqrt(BLI_ocean_spectrum_texelmarsenarsloe(o, o->_kx[i], o->_kz[j]) / 2.0f));
-          mul_complex_f(
-              o->_h0_minus[i * o->_N + j],
-              r1r2,
-              sqrt(BLI_ocean_spectrum_texelmarsenarsloe(o, -o->_kx[i], -o->_kz[j]) / 2.0f));
-          break;
-        case MOD_OCEAN_SPECTRUM_PIERSON_MOSKOWITZ:
-          mul_complex_f(o->_h0[i * o->_N + j],
-                        r1r2,
-                        sqrt(BLI_ocean_spectrum_piersonmoskowitz(o, o->_kx[i], o->_kz[j]) / 2.0f));
-          mul_complex_f(
-              o->_h0_minus[i * o->_N + j],
-              r1r2,
-              sqrt(BLI_ocean_spectrum_piersonmoskowitz(o, -o->_kx[i], -o->_kz[j]) / 2.0f));
-          break;
-        default:
-          mul_complex_f(o->_h0[i * o->_N + j], r1r2, sqrt(Ph(o, o->_kx[i], o->_kz[j]) / 2.0f));
-          mul_complex_f(
-              o->_h0_minus[i * o->_N + j], r1r2, sqrt(Ph(o, -o->_kx[i], -o->_kz[j]) / 2.0f));
-          break;
-      }
-    }
-  }
+  /* Every cell re-seeds the generator from its wave vector, so rows can be generated on separate
+   * threads (each with its own #RNG) without changing the resulting spectrum. */
+  blender::threading::parallel_for(
+      blender::IndexRange(o->_M), 16, [&](const blender::IndexRange range) {
+        RNG *rng = BLI_rng_new(seed);
+        for (const int row : range) {
+          ocean_init_spectrum_row(o, rng, seed, row);
+        }
+        BLI_rng_free(rng);
+      });
 
   o->_fft_in = MEM_malloc_arrayN<fftw_complex>(size_t(o->_M) * (1 + size_t(o->_N) / 2),
                                                "ocean_fft_in");
@@ -1022,8 +1036,6 @@ bool BKE_ocean_init(Ocean *o,
 
   set_height_normalize_factor(o);
 
-  BLI_rng_free(rng);
-
   return true;
 }
 
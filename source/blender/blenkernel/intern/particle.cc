@@ -45,6 +45,7 @@
 #include "BLI_rand.h"
 #include "BLI_string.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -2780,14 +2781,6 @@ static bool psys_thread_context_init_path(ParticleThreadContext *ctx,
   return true;
 }
 
-static void psys_task_init_path(ParticleTask *task, ParticleSimulationData *sim)
-{
-  /* init random number generator */
-  int seed = 31415926 + sim->psys->seed;
-
-  task->rng_path = BLI_rng_new(seed);
-}
-
 /* NOTE: this function must be thread safe, except for branching! */
 static void psys_thread_create_path(ParticleTask *task,
                                     ChildParticle *cpa,
@@ -3129,9 +3122,8 @@ static void psys_thread_create_path(ParticleTask *task,
   }
 }
 
-static void exec_child_path_cache(TaskPool *__restrict /*pool*/, void *taskdata)
+static void exec_child_path_cache(ParticleTask *task)
 {
-  ParticleTask *task = static_cast<ParticleTask *>(taskdata);
   ParticleThreadContext *ctx = task->ctx;
   ParticleSystem *psys = ctx->sim.psys;
   ParticleCacheKey **cache = psys->childcache;
@@ -3154,13 +3146,11 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
     return;
   }
 
-  /* create a task pool for child path tasks */
   ParticleThreadContext ctx;
   if (!psys_thread_context_init_path(&ctx, sim, sim->scene, cfra, editupdate, use_render_params)) {
     return;
   }
 
-  TaskPool *task_pool = BLI_task_pool_create(&ctx, TASK_PRIORITY_HIGH);
   const int totchild = ctx.totchild;
   const int totparent = ctx.totparent;
 
@@ -3176,28 +3166,26 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
     sim->psys->totchildcache = totchild;
   }
 
+  /* The cost of a path depends on its parent and the child settings, so use small chunks that are
+   * scheduled dynamically instead of one fixed range per task. Paths don't use per-task random
+   * numbers, so the result does not depend on how the range is split. */
+  const auto cache_paths = [&](const blender::IndexRange range) {
+    blender::threading::parallel_for(range, 256, [&](const blender::IndexRange sub_range) {
+      ParticleTask task;
+      task.ctx = &ctx;
+      task.begin = int(sub_range.first());
+      task.end = int(sub_range.one_after_last());
+      exec_child_path_cache(&task);
+    });
+  };
+
   /* cache parent paths */
   ctx.parent_pass = 1;
-  blender::Vector<ParticleTask> tasks_parent = psys_tasks_create(&ctx, 0, totparent);
-  for (ParticleTask &task : tasks_parent) {
-    psys_task_init_path(&task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, &task, false, nullptr);
-  }
-  BLI_task_pool_work_and_wait(task_pool);
+  cache_paths(blender::IndexRange(totparent));
 
   /* cache child paths */
   ctx.parent_pass = 0;
-  blender::Vector<ParticleTask> tasks_child = psys_tasks_create(&ctx, totparent, totchild);
-  for (ParticleTask &task : tasks_child) {
-    psys_task_init_path(&task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, &task, false, nullptr);
-  }
-  BLI_task_pool_work_and_wait(task_pool);
-
-  BLI_task_pool_free(task_pool);
-
-  psys_tasks_free(tasks_parent);
-  psys_tasks_free(tasks_child);
+  cache_paths(blender::IndexRange::from_begin_end(totparent, totchild));
 
   psys_thread_context_free(&ctx);
 }
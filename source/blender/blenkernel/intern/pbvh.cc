@@ -160,6 +160,9 @@ static void build_nodes_recursive_mesh(const Span<int> material_indices,
   if (below_leaf_limit) {
     if (!leaf_needs_material_split(faces, material_indices)) {
       node.flag_ |= Node::Leaf;
+      /* Partitioning scrambles the face order. Sorting gives more coherent memory access when
+       * looping over the node's faces and their vertices. */
+      std::sort(faces.begin(), faces.end());
       node.face_indices_ = faces;
       return;
     }
@@ -320,6 +323,9 @@ static void build_nodes_recursive_grids(const Span<int> material_indices,
   if (below_leaf_limit) {
     if (!leaf_needs_material_split(faces, material_indices)) {
       node.flag_ |= Node::Leaf;
+      /* Partitioning scrambles the face order. Sorting gives more coherent memory access when
+       * looping over the node's faces and their vertices. */
+      std::sort(faces.begin(), faces.end());
       node.prim_indices_ = faces;
       return;
     }
@@ -974,17 +980,24 @@ static void update_normals_mesh(Object &object_orig,
    * Those boundary face and vertex indices are deduplicated with #VectorSet in order to avoid
    * duplicate work recalculation for the same vertex, and to make parallel storage for vertices
    * during recalculation thread-safe. */
+  SharedCache<Vector<float3>> &vert_normals_cache = vert_normals_cache_eval_for_write(object_orig,
+                                                                                      object_eval);
+  SharedCache<Vector<float3>> &face_normals_cache = face_normals_cache_eval_for_write(object_orig,
+                                                                                      object_eval);
+  if (nodes_to_update.is_empty() && !vert_normals_cache.is_dirty() &&
+      !face_normals_cache.is_dirty())
+  {
+    /* This is called for every redraw, avoid making the caches mutable (which may copy them if
+     * they are shared) when nothing changed since the last update. */
+    return;
+  }
+
   Mesh &mesh = *static_cast<Mesh *>(object_orig.data);
   const Span<float3> positions = bke::pbvh::vert_positions_eval_from_eval(object_eval);
   const OffsetIndices faces = mesh.faces();
   const Span<int> corner_verts = mesh.corner_verts();
   const GroupedSpan<int> vert_to_face_map = mesh.vert_to_face_map();
 
-  SharedCache<Vector<float3>> &vert_normals_cache = vert_normals_cache_eval_for_write(object_orig,
-                                                                                      object_eval);
-  SharedCache<Vector<float3>> &face_normals_cache = face_normals_cache_eval_for_write(object_orig,
-                                                                                      object_eval);
-
   VectorSet<int> boundary_faces;
   nodes_to_update.foreach_index([&](const int i) {
     const MeshNode &node = nodes[i];
@@ -2322,18 +2322,22 @@ bool bmesh_update_topology(BMesh &bm,
     }
   }
 
-  /* Go over all changed nodes and check if anything needs to be updated. */
-  for (BMeshNode &node : nodes) {
-    if (node.flag_ & Node::Leaf && node.flag_ & Node::TopologyUpdated) {
-      node.flag_ &= ~Node::TopologyUpdated;
+  /* Go over all changed nodes and check if anything needs to be updated. The topology changes
+   * are done at this point, so the original data of each node can be rebuilt in parallel. */
+  const IndexMask topology_updated = IndexMask::from_predicate(
+      nodes.index_range(), GrainSize(1024), memory, [&](const int i) {
+        return nodes[i].flag_ & Node::Leaf && nodes[i].flag_ & Node::TopologyUpdated;
+      });
+  topology_updated.foreach_index(GrainSize(1), [&](const int i) {
+    BMeshNode &node = nodes[i];
+    node.flag_ &= ~Node::TopologyUpdated;
 
-      if (!node.orig_tris_.is_empty()) {
-        /* Reallocate original triangle data. */
-        pbvh_bmesh_node_drop_orig(&node);
-        BKE_pbvh_bmesh_node_save_orig(&bm, &bm_log, &node, true);
-      }
+    if (!node.orig_tris_.is_empty()) {
+      /* Reallocate original triangle data. */
+      pbvh_bmesh_node_drop_orig(&node);
+      BKE_pbvh_bmesh_node_save_orig(&bm, &bm_log, &node, true);
     }
-  }
+  });
 
 #ifdef USE_VERIFY
   pbvh_bmesh_verify(pbvh);
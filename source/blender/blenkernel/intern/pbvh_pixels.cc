@@ -140,15 +140,17 @@ static void do_encode_pixels(const uv_islands::MeshData &mesh_data,
                              const uv_islands::UVIslandsMask &uv_masks,
                              const UVPrimitiveLookup &uv_prim_lookup,
                              Image &image,
-                             ImageUser &image_user,
+                             const ImageUser &image_user,
                              MeshNode &node)
 {
   NodeData *node_data = static_cast<NodeData *>(node.pixels_);
 
+  /* Nodes are encoded in parallel, so each needs its own image user to select the tile. */
+  ImageUser tile_user = image_user;
   LISTBASE_FOREACH (ImageTile *, tile, &image.tiles) {
     image::ImageTileWrapper image_tile(tile);
-    image_user.tile = image_tile.get_tile_number();
-    ImBuf *image_buffer = BKE_image_acquire_ibuf(&image, &image_user, nullptr);
+    tile_user.tile = image_tile.get_tile_number();
+    ImBuf *image_buffer = BKE_image_acquire_ibuf(&image, &tile_user, nullptr);
     if (image_buffer == nullptr) {
       continue;
     }
@@ -160,7 +162,6 @@ static void do_encode_pixels(const uv_islands::MeshData &mesh_data,
     for (const int face : node.faces()) {
       for (const int tri : bke::mesh::face_triangles_range(mesh_data.faces, face)) {
         for (const UVPrimitiveLookup::Entry &entry : uv_prim_lookup.lookup[tri]) {
-          uv_islands::UVBorder uv_border = entry.uv_primitive->extract_border();
           float2 uvs[3] = {
               entry.uv_primitive->get_uv_vertex(mesh_data, 0)->uv - tile_offset,
               entry.uv_primitive->get_uv_vertex(mesh_data, 1)->uv - tile_offset,
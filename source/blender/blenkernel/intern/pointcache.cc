@@ -85,6 +85,12 @@
 
 #define LZO_OUT_LEN(size) ((size) + (size) / 16 + 64 + 3)
 
+/**
+ * Frames are read and written in many small pieces (one per point and data type). A large stream
+ * buffer turns that into few file system requests, which matters most for network storage.
+ */
+#define PTCACHE_FILE_BUFFER_SIZE (1 << 20)
+
 #ifdef WITH_LZMA
 #  include "LzmaLib.h"
 #endif
@@ -1490,6 +1496,8 @@ static PTCacheFile *ptcache_file_open(PTCacheID *pid, int mode, int cfra)
 
   pf = MEM_mallocN<PTCacheFile>("PTCacheFile");
   pf->fp = fp;
+  pf->fp_buffer = MEM_mallocN(PTCACHE_FILE_BUFFER_SIZE, "PTCacheFile buffer");
+  setvbuf(fp, static_cast<char *>(pf->fp_buffer), _IOFBF, PTCACHE_FILE_BUFFER_SIZE);
   pf->old_format = 0;
   pf->frame = cfra;
 
@@ -1499,6 +1507,7 @@ static void ptcache_file_close(PTCacheFile *pf)
 {
   if (pf) {
     fclose(pf->fp);
+    MEM_freeN(pf->fp_buffer);
     MEM_freeN(pf);
   }
 }
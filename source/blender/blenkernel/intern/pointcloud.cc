@@ -85,6 +85,7 @@ static void pointcloud_copy_data(Main * /*bmain*/,
   pointcloud_dst->runtime->bounds_with_radius_cache =
       pointcloud_src->runtime->bounds_with_radius_cache;
   pointcloud_dst->runtime->bvh_cache = pointcloud_src->runtime->bvh_cache;
+  pointcloud_dst->runtime->kdtree_cache = pointcloud_src->runtime->kdtree_cache;
   if (pointcloud_src->runtime->bake_materials) {
     pointcloud_dst->runtime->bake_materials =
         std::make_unique<blender::bke::bake::BakeMaterialsList>(
@@ -158,7 +159,7 @@ IDTypeInfo IDType_ID_PT = {
     /*name*/ "PointCloud",
     /*name_plural*/ N_("pointclouds"),
     /*translation_context*/ BLT_I18NCONTEXT_ID_POINTCLOUD,
-    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE,
+    /*flags*/ IDTYPE_FLAGS_APPEND_IS_REUSABLE | IDTYPE_FLAGS_THREADSAFE_FOREACH_ID,
     /*asset_type_info*/ nullptr,
 
     /*init_data*/ pointcloud_init_data,
@@ -239,6 +240,7 @@ void BKE_pointcloud_nomain_to_pointcloud(PointCloud *pointcloud_src, PointCloud
   pointcloud_dst->runtime->bounds_with_radius_cache =
       pointcloud_src->runtime->bounds_with_radius_cache;
   pointcloud_dst->runtime->bvh_cache = pointcloud_src->runtime->bvh_cache;
+  pointcloud_dst->runtime->kdtree_cache = pointcloud_src->runtime->kdtree_cache;
   BKE_id_free(nullptr, pointcloud_src);
 }
 
@@ -284,6 +286,20 @@ std::optional<int> PointCloud::material_index_max() const
   return max_material_index;
 }
 
+const KDTree_3d &PointCloud::kdtree() const
+{
+  this->runtime->kdtree_cache.ensure([&](std::unique_ptr<KDTree_3d, KDTree3dDeleter> &r_data) {
+    const Span<float3> positions = this->positions();
+    KDTree_3d *tree = BLI_kdtree_3d_new(positions.size());
+    for (const int i : positions.index_range()) {
+      BLI_kdtree_3d_insert(tree, i, positions[i]);
+    }
+    BLI_kdtree_3d_balance(tree);
+    r_data.reset(tree);
+  });
+  return *this->runtime->kdtree_cache.data();
+}
+
 void PointCloud::count_memory(blender::MemoryCounter &memory) const
 {
   this->attribute_storage.wrap().count_memory(memory);
@@ -407,6 +423,7 @@ void PointCloud::tag_positions_changed()
   this->runtime->bounds_cache.tag_dirty();
   this->runtime->bounds_with_radius_cache.tag_dirty();
   this->runtime->bvh_cache.tag_dirty();
+  this->runtime->kdtree_cache.tag_dirty();
 }
 
 void PointCloud::tag_radii_changed()
@@ -51,6 +51,7 @@
 #include "BKE_scene.hh"
 
 #include "DEG_depsgraph.hh"
+#include "DEG_depsgraph_physics.hh"
 #include "DEG_depsgraph_query.hh"
 
 #ifdef WITH_BULLET
@@ -1947,6 +1948,13 @@ static void rigidbody_update_external_forces(Depsgraph *depsgraph,
                                              Scene *scene,
                                              RigidBodyWorld *rbw)
 {
+  /* This runs for every sub-step, avoid visiting all objects when there are no effectors. */
+  if (rbw->effector_weights == nullptr ||
+      !DEG_get_effector_relations(depsgraph, rbw->effector_weights->group))
+  {
+    return;
+  }
+
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     /* only update if rigid body exists */
     RigidBodyOb *rbo = ob->rigidbody_object;
@@ -2650,7 +2650,9 @@ void BKE_scene_graph_evaluated_ensure(Depsgraph *depsgraph, Main *bmain)
   scene_graph_update_tagged(depsgraph, bmain, true);
 }
 
-void BKE_scene_graph_update_for_newframe_ex(Depsgraph *depsgraph, const bool clear_recalc)
+void BKE_scene_graph_update_for_newframe_ex(Depsgraph *depsgraph,
+                                            const bool clear_recalc,
+                                            const bool skip_evaluated_frame)
 {
   Scene *scene = DEG_get_input_scene(depsgraph);
   Main *bmain = DEG_get_bmain(depsgraph);
@@ -2673,7 +2675,12 @@ void BKE_scene_graph_update_for_newframe_ex(Depsgraph *depsgraph, const bool cle
      * lose any possible unkeyed changes made by the handler. */
     if (pass == 0) {
       const float frame = BKE_scene_frame_get(scene);
-      DEG_evaluate_on_framechange(depsgraph, frame, DEG_EVALUATE_SYNC_WRITEBACK_YES);
+      /* Checked after the frame change pre handlers, which may have tagged data for update. */
+      if (!(skip_evaluated_frame && DEG_get_ctime(depsgraph) == frame &&
+            DEG_is_fully_evaluated(depsgraph)))
+      {
+        DEG_evaluate_on_framechange(depsgraph, frame, DEG_EVALUATE_SYNC_WRITEBACK_YES);
+      }
     }
     else {
       DEG_evaluate_on_refresh(depsgraph, DEG_EVALUATE_SYNC_WRITEBACK_YES);
@@ -1291,6 +1291,18 @@ void BKE_sound_read_waveform(Main *bmain, bSound *sound, bool *stop)
     waveform->length = AUD_readSound(
         sound->playback_handle, waveform->data, length, SOUND_WAVE_SAMPLES_PER_SECOND, &stop_i16);
     *stop = stop_i16 != 0;
+
+    /* The length reported by the sound info is only an estimate for some formats, don't keep the
+     * unused part of the buffer around for the lifetime of the waveform. */
+    if (!*stop && waveform->length < length) {
+      if (waveform->length > 0) {
+        waveform->data = static_cast<float *>(
+            MEM_reallocN(waveform->data, sizeof(float[3]) * size_t(waveform->length)));
+      }
+      else {
+        MEM_SAFE_FREE(waveform->data);
+      }
+    }
   }
   else {
     /* Create an empty waveform here if the sound couldn't be
@@ -11,6 +11,11 @@
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 
+#include "BLI_implicit_sharing.hh"
+#include "BLI_vector.hh"
+
+#include "BKE_customdata.hh"
+#include "BKE_mesh_types.hh"
 #include "BKE_subdiv_modifier.hh"
 
 #include "MEM_guardedalloc.h"
@@ -89,6 +94,125 @@ bool settings_equal(const Settings *settings_a, const Settings *settings_b)
           settings_a->fvar_linear_interpolation == settings_b->fvar_linear_interpolation);
 }
 
+/* --------------------------------------------------------------------
+ * Mesh topology source.
+ */
+
+struct MeshTopologySource {
+  bool use_creases = false;
+  int verts_num = 0;
+  int edges_num = 0;
+  int faces_num = 0;
+  int corners_num = 0;
+  /* Sharing info and its version for every mesh array read by the mesh converter. A weak user is
+   * added to every non-null sharing info, so it can't be freed and reused for other data while it
+   * is referenced here. Optional layers which don't exist are stored as null. */
+  Vector<std::pair<const ImplicitSharingInfo *, int64_t>> arrays;
+
+  ~MeshTopologySource()
+  {
+    for (const auto &[sharing_info, version] : this->arrays) {
+      if (sharing_info != nullptr) {
+        sharing_info->remove_weak_user_and_delete_if_last();
+      }
+    }
+  }
+};
+
+/**
+ * Gather the sharing state of the topology arrays used by #converter_init_for_mesh. Returns false
+ * when some of the arrays aren't shared, in which case their changes can't be detected cheaply.
+ */
+static bool gather_mesh_topology_arrays(
+    const Mesh &mesh,
+    const Settings &settings,
+    Vector<std::pair<const ImplicitSharingInfo *, int64_t>> &r_arrays)
+{
+  const auto add_sharing_info = [&](const ImplicitSharingInfo *sharing_info) {
+    if (sharing_info == nullptr) {
+      return false;
+    }
+    r_arrays.append({sharing_info, sharing_info->version()});
+    return true;
+  };
+  const auto add_layer = [&](const CustomData &data, const StringRef name, const bool optional) {
+    const int layer_index = CustomData_get_named_layer_index_notype(&data, name);
+    if (layer_index == -1) {
+      if (!optional) {
+        return false;
+      }
+      r_arrays.append({nullptr, 0});
+      return true;
+    }
+    return add_sharing_info(data.layers[layer_index].sharing_info);
+  };
+
+  if (mesh.faces_num > 0 && !add_sharing_info(mesh.runtime->face_offsets_sharing_info)) {
+    return false;
+  }
+  if (!add_layer(mesh.edge_data, ".edge_verts", false) ||
+      !add_layer(mesh.corner_data, ".corner_vert", false) ||
+      !add_layer(mesh.corner_data, ".corner_edge", false))
+  {
+    return false;
+  }
+  if (settings.use_creases) {
+    if (!add_layer(mesh.vert_data, "crease_vert", true) ||
+        !add_layer(mesh.edge_data, "crease_edge", true))
+    {
+      return false;
+    }
+  }
+  /* UV maps define the face-varying topology. */
+  for (const CustomDataLayer &layer : Span(mesh.corner_data.layers, mesh.corner_data.totlayer)) {
+    if (layer.type == CD_PROP_FLOAT2 && !add_sharing_info(layer.sharing_info)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool mesh_topology_source_matches(const MeshTopologySource &source,
+                                         const Settings &settings,
+                                         const Mesh &mesh)
+{
+  if (source.use_creases != settings.use_creases || source.verts_num != mesh.verts_num ||
+      source.edges_num != mesh.edges_num || source.faces_num != mesh.faces_num ||
+      source.corners_num != mesh.corners_num)
+  {
+    return false;
+  }
+  Vector<std::pair<const ImplicitSharingInfo *, int64_t>> arrays;
+  if (!gather_mesh_topology_arrays(mesh, settings, arrays)) {
+    return false;
+  }
+  return arrays == source.arrays;
+}
+
+static void mesh_topology_source_update(Subdiv &subdiv, const Settings &settings, const Mesh &mesh)
+{
+  MEM_delete(subdiv.mesh_topology_source);
+  subdiv.mesh_topology_source = nullptr;
+
+  Vector<std::pair<const ImplicitSharingInfo *, int64_t>> arrays;
+  if (!gather_mesh_topology_arrays(mesh, settings, arrays)) {
+    return;
+  }
+  for (const auto &[sharing_info, version] : arrays) {
+    if (sharing_info != nullptr) {
+      sharing_info->add_weak_user();
+    }
+  }
+  MeshTopologySource *source = MEM_new<MeshTopologySource>(__func__);
+  source->use_creases = settings.use_creases;
+  source->verts_num = mesh.verts_num;
+  source->edges_num = mesh.edges_num;
+  source->faces_num = mesh.faces_num;
+  source->corners_num = mesh.corners_num;
+  source->arrays = std::move(arrays);
+  subdiv.mesh_topology_source = source;
+}
+
 /* --------------------------------------------------------------------
  * Construction.
  */
@@ -178,10 +302,21 @@ Subdiv *update_from_converter(Subdiv *subdiv,
 
 Subdiv *update_from_mesh(Subdiv *subdiv, const Settings *settings, const Mesh *mesh)
 {
+  /* When the topology arrays are still the same shared data as last time, the refiner is known
+   * to match the mesh and the more expensive comparison against the converter can be skipped. */
+  if (subdiv != nullptr && subdiv->topology_refiner != nullptr &&
+      subdiv->mesh_topology_source != nullptr && settings_equal(&subdiv->settings, settings) &&
+      mesh_topology_source_matches(*subdiv->mesh_topology_source, *settings, *mesh))
+  {
+    return subdiv;
+  }
   OpenSubdiv_Converter converter;
   converter_init_for_mesh(&converter, settings, mesh);
   subdiv = update_from_converter(subdiv, settings, &converter);
   converter_free(&converter);
+  if (subdiv != nullptr) {
+    mesh_topology_source_update(*subdiv, *settings, *mesh);
+  }
   return subdiv;
 }
 
@@ -200,6 +335,7 @@ void free(Subdiv *subdiv)
     delete subdiv->evaluator;
   }
   delete subdiv->topology_refiner;
+  MEM_delete(subdiv->mesh_topology_source);
   displacement_detach(subdiv);
   if (subdiv->cache_.face_ptex_offset != nullptr) {
     MEM_freeN(subdiv->cache_.face_ptex_offset);
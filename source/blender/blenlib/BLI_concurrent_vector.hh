@@ -0,0 +1,154 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ */
+
+#ifdef WITH_TBB
+/* Quiet top level deprecation message, unrelated to API usage here. */
+#  if defined(WIN32) && !defined(NOMINMAX)
+/* TBB includes Windows.h which will define min/max macros causing issues
+ * when we try to use std::min and std::max later on. */
+#    define NOMINMAX
+#    define TBB_MIN_MAX_CLEANUP
+#  endif
+#  include <tbb/concurrent_vector.h>
+#  ifdef WIN32
+/* We cannot keep this defined, since other parts of the code deal with this on their own, leading
+ * to multiple define warnings unless we un-define this, however we can only undefine this if we
+ * were the ones that made the definition earlier. */
+#    ifdef TBB_MIN_MAX_CLEANUP
+#      undef NOMINMAX
+#    endif
+#  endif
+#else
+#  include <deque>
+#  include <mutex>
+
+#  include "BLI_mutex.hh"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+
+#include "BLI_span.hh"
+#include "BLI_vector.hh"
+
+namespace blender {
+
+/**
+ * A #ConcurrentVector allows appending values from multiple threads concurrently. Appended
+ * elements never move in memory, so references to them stay valid while other threads keep
+ * appending. This can replace thread-local vectors that are concatenated serially afterwards, when
+ * the order of the elements does not matter.
+ *
+ * \note Only appending is thread-safe. Reading elements that are being appended by another thread,
+ * or iterating while appending, is not.
+ *
+ * This is a thin wrapper around #tbb::concurrent_vector that also has a fallback implementation
+ * if TBB is not available. The fallback implementation is not optimized for performance. It mainly
+ * intends to be a simple implementation that can compile whenever the TBB variant can compile.
+ */
+template<typename T> class ConcurrentVector {
+ public:
+  using size_type = int64_t;
+
+ private:
+#ifdef WITH_TBB
+  tbb::concurrent_vector<T> data_;
+#else
+  Mutex mutex_;
+  std::deque<T> data_;
+#endif
+
+ public:
+  /**
+   * Append the value and return a reference to the stored element.
+   */
+  T &append(T value)
+  {
+#ifdef WITH_TBB
+    return *data_.push_back(std::move(value));
+#else
+    std::lock_guard lock(mutex_);
+    return data_.emplace_back(std::move(value));
+#endif
+  }
+
+  /**
+   * Append all values of the span. The appended elements are contiguous in the vector.
+   */
+  void extend(const Span<T> values)
+  {
+#ifdef WITH_TBB
+    if (values.is_empty()) {
+      return;
+    }
+    std::copy(values.begin(), values.end(), data_.grow_by(values.size()));
+#else
+    std::lock_guard lock(mutex_);
+    data_.insert(data_.end(), values.begin(), values.end());
+#endif
+  }
+
+  int64_t size() const
+  {
+    return int64_t(data_.size());
+  }
+
+  bool is_empty() const
+  {
+    return data_.empty();
+  }
+
+  const T &operator[](const int64_t index) const
+  {
+    BLI_assert(index >= 0);
+    BLI_assert(index < this->size());
+    return data_[size_t(index)];
+  }
+
+  T &operator[](const int64_t index)
+  {
+    BLI_assert(index >= 0);
+    BLI_assert(index < this->size());
+    return data_[size_t(index)];
+  }
+
+  auto begin()
+  {
+    return data_.begin();
+  }
+  auto end()
+  {
+    return data_.end();
+  }
+  auto begin() const
+  {
+    return data_.begin();
+  }
+  auto end() const
+  {
+    return data_.end();
+  }
+
+  /**
+   * Move all elements into a contiguous #Vector once no more elements are appended.
+   */
+  Vector<T> extract_vector()
+  {
+    Vector<T> result;
+    result.reserve(this->size());
+    for (T &value : data_) {
+      result.append(std::move(value));
+    }
+    data_.clear();
+    return result;
+  }
+};
+
+}  // namespace blender
@@ -53,6 +53,20 @@ FileReader *BLI_filereader_new_mmap(int filedes) ATTR_WARN_UNUSED_RESULT;
 /** Create #FileReader from a region of memory. */
 FileReader *BLI_filereader_new_memory(const void *data, size_t len) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL();
+/**
+ * Direct access to the data of a #FileReader created by #BLI_filereader_new_memory or
+ * #BLI_filereader_new_mmap, to avoid copying data that is only read once.
+ *
+ * Returns null for other readers, when the range is outside of the data, or for memory-mapped
+ * files on platforms where IO errors can only be caught while copying. After reading from
+ * memory-mapped data, check #BLI_filereader_memory_io_error.
+ */
+const void *BLI_filereader_memory_data(FileReader *reader,
+                                       off64_t offset,
+                                       size_t size) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
+/** Whether an IO error happened while reading a memory-mapped file. */
+bool BLI_filereader_memory_io_error(const FileReader *reader) ATTR_WARN_UNUSED_RESULT
+    ATTR_NONNULL();
 /** Create #FileReader from applying `Zstd` decompression on an underlying file. */
 FileReader *BLI_filereader_new_zstd(FileReader *base) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
 /** Create #FileReader from applying `Gzip` decompression on an underlying file. */
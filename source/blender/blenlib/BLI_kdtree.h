@@ -42,6 +42,14 @@
 #undef KDTreeNearest
 #undef KDTREE_PREFIX_ID
 
+class KDTree3dDeleter {
+ public:
+  void operator()(KDTree_3d *tree)
+  {
+    BLI_kdtree_3d_free(tree);
+  }
+};
+
 /* 4D version */
 #define KD_DIMS 4
 #define KDTREE_PREFIX_ID BLI_kdtree_4d
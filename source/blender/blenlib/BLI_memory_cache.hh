@@ -50,6 +50,27 @@ std::shared_ptr<CachedValue> get_base(const GenericKey &key,
  */
 void set_approximate_size_limit(int64_t limit_in_bytes);
 
+/**
+ * Get the approximate amount of memory used by all cached values.
+ */
+int64_t get_approximate_size();
+
+/**
+ * Get the number of values that are currently cached.
+ */
+int64_t get_values_num();
+
+/**
+ * Free the least recently used values until the cache uses approximately the given amount of
+ * memory, independent of the limit set with #set_approximate_size_limit. This can be used to
+ * release memory when the system is running low on it, without forgetting the configured limit.
+ *
+ * Like the configured limit, this is not an exact bound: usually the cache is shrunk to about
+ * 75% of the given size, but up to 10% more than the given size may be kept to avoid recounting
+ * the memory of the kept values.
+ */
+void shrink_to_approximate_size(int64_t size_in_bytes);
+
 /**
  * Remove all elements from the cache. Note that this does not guarantee that no elements are in
  * the cache after the function returned. This is because another thread may have added a new
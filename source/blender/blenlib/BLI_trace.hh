@@ -0,0 +1,113 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ *
+ * Lightweight recording of trace events (scoped zones and counters) from any thread. Recorded
+ * traces are written in the Chrome trace event format, which can be opened in Perfetto
+ * (https://ui.perfetto.dev) or `chrome://tracing`.
+ *
+ * When no trace is being recorded, a zone or counter only costs a relaxed atomic load, so they
+ * can be left in hot code paths.
+ *
+ * \code{.cc}
+ * void update()
+ * {
+ *   TRACE_ZONE("update");
+ *   ...
+ *   trace::counter("elements", elements_num);
+ * }
+ * \endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+
+#include "BLI_string_ref.hh"
+#include "BLI_utility_mixins.hh"
+
+namespace blender::trace {
+
+using Clock = std::chrono::steady_clock;
+using TimePoint = Clock::time_point;
+
+namespace detail {
+extern std::atomic<bool> is_recording;
+void add_zone(const char *name, TimePoint start, TimePoint end);
+void add_counter(const char *name, double value);
+}  // namespace detail
+
+/** Start recording trace events. Events recorded before are kept. */
+void start();
+/** Stop recording trace events. Zones that are still open are recorded when they end. */
+void stop();
+/** Remove all recorded events. */
+void clear();
+
+inline bool is_recording()
+{
+  return detail::is_recording.load(std::memory_order_relaxed);
+}
+
+/**
+ * Name the calling thread in the written trace. Does not have to be called for every thread,
+ * unnamed threads are shown with their index.
+ */
+void set_thread_name(StringRef name);
+
+/**
+ * Record the value of a counter at the current time.
+ * \param name: Must be a string literal or otherwise outlive the recorded trace.
+ */
+inline void counter(const char *name, const double value)
+{
+  if (is_recording()) {
+    detail::add_counter(name, value);
+  }
+}
+
+/** Write all recorded events in the Chrome trace event JSON format. */
+void write_json(std::ostream &stream);
+/** Write all recorded events to a file, returns false when the file could not be written. */
+bool write_json_file(const char *filepath);
+
+/**
+ * Records the time between its construction and destruction as a zone. Use #TRACE_ZONE instead
+ * of constructing it directly.
+ */
+class ScopedZone : NonCopyable, NonMovable {
+ private:
+  const char *name_;
+  TimePoint start_;
+  bool is_recording_;
+
+ public:
+  /** \param name: Must be a string literal or otherwise outlive the recorded trace. */
+  ScopedZone(const char *name) : name_(name), is_recording_(is_recording())
+  {
+    if (is_recording_) {
+      start_ = Clock::now();
+    }
+  }
+
+  ~ScopedZone()
+  {
+    if (is_recording_) {
+      detail::add_zone(name_, start_, Clock::now());
+    }
+  }
+};
+
+}  // namespace blender::trace
+
+#define TRACE_ZONE_CONCAT_(a, b) a##b
+#define TRACE_ZONE_CONCAT(a, b) TRACE_ZONE_CONCAT_(a, b)
+
+/** Record the remainder of the enclosing scope as a zone with the given name. */
+#define TRACE_ZONE(name) \
+  blender::trace::ScopedZone TRACE_ZONE_CONCAT(trace_zone_, __LINE__)(name)
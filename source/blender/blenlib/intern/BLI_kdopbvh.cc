@@ -1014,17 +1014,53 @@ bool BLI_bvhtree_update_node(
   return true;
 }
 
+static void bvhtree_update_tree_task_cb(void *__restrict userdata,
+                                        const int j,
+                                        const TaskParallelTLS *__restrict /*tls*/)
+{
+  BVHTree *tree = static_cast<BVHTree *>(userdata);
+  node_join(tree, tree->nodes[tree->leaf_num + j]);
+}
+
 void BLI_bvhtree_update_tree(BVHTree *tree)
 {
   /* Update bottom=>top
    * TRICKY: the way we build the tree all the children have an index greater than the parent
    * This allows us todo a bottom up update by starting on the bigger numbered branch. */
 
-  BVHNode **root = tree->nodes + tree->leaf_num;
-  BVHNode **index = tree->nodes + tree->leaf_num + tree->branch_num - 1;
+  if (tree->leaf_num <= KDOPBVH_THREAD_LEAF_THRESHOLD) {
+    BVHNode **root = tree->nodes + tree->leaf_num;
+    BVHNode **index = tree->nodes + tree->leaf_num + tree->branch_num - 1;
+
+    for (; index >= root; index--) {
+      node_join(tree, *index);
+    }
+    return;
+  }
 
-  for (; index >= root; index--) {
-    node_join(tree, *index);
+  /* The branches are stored as the implicit tree built by #non_recursive_bvh_div_nodes, so the
+   * children of a level only live on deeper levels. Join the levels deepest first, all branches
+   * of one level in parallel. */
+  const int tree_type = tree->tree_type;
+  const int tree_offset = 2 - tree_type;
+  int level_starts[32];
+  int levels_num = 0;
+  for (int i = 1; i <= tree->branch_num; i = i * tree_type + tree_offset) {
+    BLI_assert(levels_num < int(ARRAY_SIZE(level_starts)) - 1);
+    level_starts[levels_num++] = i;
+  }
+  level_starts[levels_num] = tree->branch_num + 1;
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 256;
+  for (int level = levels_num - 1; level >= 0; level--) {
+    /* Implicit index `i` is stored at `tree->nodes[tree->leaf_num + i - 1]`. */
+    BLI_task_parallel_range(level_starts[level] - 1,
+                            level_starts[level + 1] - 1,
+                            tree,
+                            bvhtree_update_tree_task_cb,
+                            &settings);
   }
 }
 int BLI_bvhtree_get_len(const BVHTree *tree)
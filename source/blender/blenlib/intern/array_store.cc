@@ -96,6 +96,7 @@
 #include "BLI_assert.h"
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLI_array_store.h" /* Own include. */
@@ -199,6 +200,11 @@ struct BChunkList;
  */
 #define BCHUNK_HASH_TABLE_MUL 3
 
+/**
+ * Calculate hashes for arrays of at least this many elements using multiple threads.
+ */
+#define BCHUNK_HASH_THREADED_MIN_LEN 65536
+
 /**
  * Merge too small/large chunks:
  *
@@ -820,17 +826,25 @@ static void hash_array_from_data(const BArrayInfo *info,
                                  const size_t data_slice_len,
                                  hash_key *hash_array)
 {
-  if (info->chunk_stride != 1) {
-    for (size_t i = 0, i_step = 0; i_step < data_slice_len; i++, i_step += info->chunk_stride) {
-      hash_array[i] = hash_data(&data_slice[i_step], info->chunk_stride);
-    }
-  }
-  else {
-    /* Fast-path for bytes. */
-    for (size_t i = 0; i < data_slice_len; i++) {
-      hash_array[i] = hash_data_single(data_slice[i]);
-    }
-  }
+  const size_t chunk_stride = info->chunk_stride;
+  const size_t hash_array_len = (data_slice_len + chunk_stride - 1) / chunk_stride;
+  /* Each element is hashed independently, small arrays are handled on the calling thread. */
+  blender::threading::parallel_for(
+      blender::IndexRange(int64_t(hash_array_len)),
+      BCHUNK_HASH_THREADED_MIN_LEN,
+      [&](const blender::IndexRange range) {
+        if (chunk_stride != 1) {
+          for (const int64_t i : range) {
+            hash_array[i] = hash_data(&data_slice[size_t(i) * chunk_stride], chunk_stride);
+          }
+        }
+        else {
+          /* Fast-path for bytes. */
+          for (const int64_t i : range) {
+            hash_array[i] = hash_data_single(data_slice[i]);
+          }
+        }
+      });
 }
 
 /**
@@ -878,13 +892,47 @@ static void hash_accum(hash_key *hash_array, const size_t hash_array_len, size_t
   }
 
   const size_t hash_array_search_len = hash_array_len - iter_steps;
+  if (hash_array_search_len < BCHUNK_HASH_THREADED_MIN_LEN) {
+    while (iter_steps != 0) {
+      const size_t hash_offset = iter_steps;
+      for (size_t i = 0; i < hash_array_search_len; i++) {
+        hash_accum_impl(hash_array, i, i + hash_offset);
+      }
+      iter_steps -= 1;
+    }
+    return;
+  }
+
+  /* Each step reads values ahead of the one it writes, which the serial loop above has not
+   * written yet. To split a step between threads, read the previous step's values from a second
+   * array instead, swapping the arrays after each step. Values past the search length never
+   * change, so they only need to be copied once. */
+  hash_key *hash_array_other = MEM_malloc_arrayN<hash_key>(hash_array_len, __func__);
+  memcpy(&hash_array_other[hash_array_search_len],
+         &hash_array[hash_array_search_len],
+         sizeof(hash_key) * (hash_array_len - hash_array_search_len));
+
+  hash_key *hash_src = hash_array;
+  hash_key *hash_dst = hash_array_other;
   while (iter_steps != 0) {
     const size_t hash_offset = iter_steps;
-    for (size_t i = 0; i < hash_array_search_len; i++) {
-      hash_accum_impl(hash_array, i, i + hash_offset);
-    }
+    blender::threading::parallel_for(
+        blender::IndexRange(int64_t(hash_array_search_len)),
+        BCHUNK_HASH_THREADED_MIN_LEN,
+        [&](const blender::IndexRange range) {
+          for (const int64_t i : range) {
+            hash_dst[i] = hash_src[i] +
+                          ((hash_src[size_t(i) + hash_offset] << 3) ^ (hash_src[i] >> 1));
+          }
+        });
+    std::swap(hash_src, hash_dst);
     iter_steps -= 1;
   }
+
+  if (hash_src != hash_array) {
+    memcpy(hash_array, hash_src, sizeof(hash_key) * hash_array_search_len);
+  }
+  MEM_freeN(hash_array_other);
 }
 
 /**
@@ -14,14 +14,14 @@
  *  - Literals:
  *      floating point and decimal integer.
  *  - Constants:
- *      pi, True, False
+ *      pi, e, tau, True, False
  *  - Operators:
  *      +, -, *, /, ==, !=, <, <=, >, >=, and, or, not, ternary if
  *  - Functions:
  *      min, max, radians, degrees,
  *      abs, fabs, floor, ceil, trunc, int,
  *      sin, cos, tan, asin, acos, atan, atan2,
- *      exp, log, sqrt, pow, fmod
+ *      exp, log, sqrt, pow, fmod, hypot, copysign
  *
  * The implementation has no global state and can be used multi-threaded.
  */
@@ -378,7 +378,12 @@ struct BuiltinConstDef {
 };
 
 static BuiltinConstDef builtin_consts[] = {
-    {"pi", M_PI}, {"True", 1.0}, {"False", 0.0}, {nullptr, 0.0}};
+    {"pi", M_PI},
+    {"e", M_E},
+    {"tau", 2.0 * M_PI},
+    {"True", 1.0},
+    {"False", 0.0},
+    {nullptr, 0.0}};
 
 struct BuiltinOpDef {
   const char *name;
@@ -432,6 +437,8 @@ static BuiltinOpDef builtin_ops[] = {
     {"sqrt", UnaryOpFunc(sqrt)},
     {"pow", BinaryOpFunc(pow)},
     {"fmod", BinaryOpFunc(fmod)},
+    {"hypot", BinaryOpFunc(hypot)},
+    {"copysign", BinaryOpFunc(copysign)},
     {"lerp", TernaryOpFunc(op_lerp)},
     {"clamp", UnaryOpFunc(op_clamp)},
     {"clamp", TernaryOpFunc(op_clamp3)},
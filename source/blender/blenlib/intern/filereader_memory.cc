@@ -129,3 +129,37 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   return (FileReader *)mem;
 }
+
+const void *BLI_filereader_memory_data(FileReader *reader, off64_t offset, size_t size)
+{
+  MemoryReader *mem = (MemoryReader *)reader;
+
+  const char *data;
+  if (reader->read == memory_read_raw) {
+    data = mem->data;
+  }
+#ifndef WIN32
+  /* IO errors are caught by a signal handler, which replaces the mapping with zeroes. */
+  else if (reader->read == memory_read_mmap) {
+    data = static_cast<const char *>(BLI_mmap_get_pointer(mem->mmap));
+  }
+#endif
+  else {
+    return nullptr;
+  }
+
+  if (offset < 0 || size_t(offset) + size > mem->length) {
+    return nullptr;
+  }
+
+  return data + offset;
+}
+
+bool BLI_filereader_memory_io_error(const FileReader *reader)
+{
+  if (reader->read != memory_read_mmap) {
+    return false;
+  }
+  const MemoryReader *mem = (const MemoryReader *)reader;
+  return BLI_mmap_any_io_error(mem->mmap);
+}
@@ -7,11 +7,13 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <zstd.h>
 
 #include "BLI_fileops.hh"
 #include "BLI_filereader.h"
+#include "BLI_task.hh"
 
 #include "MEM_guardedalloc.h"
 
@@ -29,11 +31,19 @@ struct ZstdReader {
     size_t *compressed_ofs;
     size_t *uncompressed_ofs;
 
+    /* Uncompressed content of the frames `cached_frame` to `cached_frame + cached_frames_num`,
+     * stored contiguously. */
     char *cached_content;
     int cached_frame;
+    int cached_frames_num;
   } seek;
 };
 
+/* Limits for the frames that are decompressed together, in parallel. The memory limit keeps the
+ * cache small for files written with large frames, at least one frame is always decompressed. */
+#define ZSTD_BATCH_FRAMES_MAX 8
+#define ZSTD_BATCH_UNCOMPRESSED_SIZE_MAX (16 * 1024 * 1024)
+
 static bool zstd_read_u32(FileReader *base, uint32_t *val)
 {
   if (base->read(base, val, sizeof(uint32_t)) != sizeof(uint32_t)) {
@@ -126,6 +136,7 @@ static bool zstd_read_seek_table(ZstdReader *zstd)
   }
 
   zstd->seek.cached_frame = -1;
+  zstd->seek.cached_frames_num = 0;
 
   return true;
 }
@@ -153,24 +164,43 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
-/* Ensure that the currently loaded frame is the correct one. */
+/* Ensure that the given frame is loaded, and return its content.
+ *
+ * Reading is mostly sequential, so on a cache miss the following frames are loaded as well.
+ * Their compressed data is read with a single call to the base reader, and the frames are
+ * decompressed in parallel since they are independent. */
 static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
 {
-  if (zstd->seek.cached_frame == frame) {
-    /* Cached frame matches, so just return it. */
-    return zstd->seek.cached_content;
+  const size_t *uncompressed_ofs = zstd->seek.uncompressed_ofs;
+  const size_t *compressed_ofs = zstd->seek.compressed_ofs;
+
+  if (zstd->seek.cached_content && frame >= zstd->seek.cached_frame &&
+      frame < zstd->seek.cached_frame + zstd->seek.cached_frames_num)
+  {
+    /* Cached frames include the wanted one, so just return it. */
+    return zstd->seek.cached_content + (uncompressed_ofs[frame] -
+                                        uncompressed_ofs[zstd->seek.cached_frame]);
   }
 
-  /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
+  /* Cached frames don't match, so discard them and cache the wanted ones instead. */
   MEM_SAFE_FREE(zstd->seek.cached_content);
 
-  size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
-  size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
-                             zstd->seek.uncompressed_ofs[frame];
+  const int max_frames_num = std::min(ZSTD_BATCH_FRAMES_MAX, zstd->seek.frames_num - frame);
+  int frames_num = 1;
+  while (frames_num < max_frames_num) {
+    const size_t batch_size = uncompressed_ofs[frame + frames_num + 1] - uncompressed_ofs[frame];
+    if (batch_size > ZSTD_BATCH_UNCOMPRESSED_SIZE_MAX) {
+      break;
+    }
+    frames_num++;
+  }
+  const int last_frame = frame + frames_num;
+  const size_t compressed_size = compressed_ofs[last_frame] - compressed_ofs[frame];
+  const size_t uncompressed_size = uncompressed_ofs[last_frame] - uncompressed_ofs[frame];
 
   char *uncompressed_data = MEM_malloc_arrayN<char>(uncompressed_size, __func__);
   char *compressed_data = MEM_malloc_arrayN<char>(compressed_size, __func__);
-  if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
+  if (zstd->base->seek(zstd->base, compressed_ofs[frame], SEEK_SET) < 0 ||
       zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
   {
     MEM_freeN(compressed_data);
@@ -178,15 +208,47 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
     return nullptr;
   }
 
-  size_t res = ZSTD_decompressDCtx(
-      zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
+  auto decompress_frame = [&](ZSTD_DCtx *ctx, const int i) {
+    const size_t frame_compressed_size = compressed_ofs[i + 1] - compressed_ofs[i];
+    const size_t frame_uncompressed_size = uncompressed_ofs[i + 1] - uncompressed_ofs[i];
+    const size_t res = ZSTD_decompressDCtx(ctx,
+                                           uncompressed_data + (uncompressed_ofs[i] -
+                                                                uncompressed_ofs[frame]),
+                                           frame_uncompressed_size,
+                                           compressed_data + (compressed_ofs[i] -
+                                                              compressed_ofs[frame]),
+                                           frame_compressed_size);
+    return !ZSTD_isError(res) && res >= frame_uncompressed_size;
+  };
+
+  bool success = true;
+  if (frames_num == 1) {
+    success = decompress_frame(zstd->ctx, frame);
+  }
+  else {
+    std::atomic<bool> any_error = false;
+    blender::threading::parallel_for(
+        blender::IndexRange(frame, frames_num), 1, [&](const blender::IndexRange range) {
+          ZSTD_DCtx *ctx = ZSTD_createDCtx();
+          for (const int64_t i : range) {
+            if (any_error || !decompress_frame(ctx, int(i))) {
+              any_error = true;
+              break;
+            }
+          }
+          ZSTD_freeDCtx(ctx);
+        });
+    success = !any_error;
+  }
+
   MEM_freeN(compressed_data);
-  if (ZSTD_isError(res) || res < uncompressed_size) {
+  if (!success) {
     MEM_freeN(uncompressed_data);
     return nullptr;
   }
 
   zstd->seek.cached_frame = frame;
+  zstd->seek.cached_frames_num = frames_num;
   zstd->seek.cached_content = uncompressed_data;
   return uncompressed_data;
 }
@@ -8,8 +8,10 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_kdtree_impl.h"
 #include "BLI_math_base.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -194,9 +196,19 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
   node = &nodes[median];
   node->d = axis;
   axis = (axis + 1) % KD_DIMS;
-  node->left = kdtree_balance(nodes, median, axis, ofs);
-  node->right = kdtree_balance(
-      nodes + median + 1, (nodes_len - (median + 1)), axis, (median + 1) + ofs);
+  const auto balance_left = [&]() { node->left = kdtree_balance(nodes, median, axis, ofs); };
+  const auto balance_right = [&]() {
+    node->right = kdtree_balance(
+        nodes + median + 1, (nodes_len - (median + 1)), axis, (median + 1) + ofs);
+  };
+  /* Both halves are independent sub-arrays, so large ones can be balanced in parallel. */
+  if (nodes_len > 8192) {
+    blender::threading::parallel_invoke(balance_left, balance_right);
+  }
+  else {
+    balance_left();
+    balance_right();
+  }
 
   return median + ofs;
 }
@@ -861,6 +873,32 @@ static void deduplicate_recursive(const DeDuplicateParams *p, uint i)
   }
 }
 
+/**
+ * Check if there is any other point in range, using the same traversal as
+ * #deduplicate_recursive. Doesn't write anything, so it can run for many points in parallel.
+ */
+static bool has_neighbor_recursive(const DeDuplicateParams *p,
+                                   const float search_co[KD_DIMS],
+                                   const int search,
+                                   uint i)
+{
+  const KDTreeNode *node = &p->nodes[i];
+  if (search_co[node->d] + p->range <= node->co[node->d]) {
+    return node->left != KD_NODE_UNSET && has_neighbor_recursive(p, search_co, search, node->left);
+  }
+  if (search_co[node->d] - p->range >= node->co[node->d]) {
+    return node->right != KD_NODE_UNSET &&
+           has_neighbor_recursive(p, search_co, search, node->right);
+  }
+  if ((search != node->index) && (len_squared_vnvn(node->co, search_co) <= p->range_sq)) {
+    return true;
+  }
+  return (node->left != KD_NODE_UNSET &&
+          has_neighbor_recursive(p, search_co, search, node->left)) ||
+         (node->right != KD_NODE_UNSET &&
+          has_neighbor_recursive(p, search_co, search, node->right));
+}
+
 /**
  * Find duplicate points in \a range.
  * Favors speed over quality since it doesn't find the best target vertex for merging.
@@ -893,11 +931,22 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
   p.duplicates = duplicates;
   p.duplicates_found = &found;
 
+  /* Usually most points have no other point in range. Finding them in parallel first allows
+   * skipping their search in the order dependent loops below, without changing the result. */
+  blender::Array<bool> has_neighbor(int64_t(tree->nodes_len));
+  blender::threading::parallel_for(
+      has_neighbor.index_range(), 1024, [&](const blender::IndexRange nodes_range) {
+        for (const int64_t node_index : nodes_range) {
+          const KDTreeNode &node = tree->nodes[node_index];
+          has_neighbor[node_index] = has_neighbor_recursive(&p, node.co, node.index, tree->root);
+        }
+      });
+
   if (use_index_order) {
     blender::Vector<int> order = kdtree_order(tree);
     for (int i = 0; i < tree->max_node_index + 1; i++) {
       const int node_index = order[i];
-      if (node_index == -1) {
+      if (node_index == -1 || !has_neighbor[node_index]) {
         continue;
       }
       const int index = i;
@@ -916,6 +965,9 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
   else {
     for (uint i = 0; i < tree->nodes_len; i++) {
       const uint node_index = i;
+      if (!has_neighbor[node_index]) {
+        continue;
+      }
       const int index = p.nodes[node_index].index;
       if (ELEM(duplicates[index], -1, index)) {
         p.search = index;
@@ -60,6 +60,7 @@ static Cache &get_cache()
 }
 
 static void try_enforce_limit();
+static void try_enforce_limit(int64_t approximate_limit);
 
 static void set_new_logical_time(const StoredValue &stored_value, const int64_t new_time)
 {
@@ -136,6 +137,23 @@ void set_approximate_size_limit(const int64_t limit_in_bytes)
   try_enforce_limit();
 }
 
+int64_t get_approximate_size()
+{
+  return get_cache().size_in_bytes.load(std::memory_order_relaxed);
+}
+
+int64_t get_values_num()
+{
+  Cache &cache = get_cache();
+  std::lock_guard lock{cache.global_mutex};
+  return cache.keys.size();
+}
+
+void shrink_to_approximate_size(const int64_t size_in_bytes)
+{
+  try_enforce_limit(size_in_bytes);
+}
+
 void clear()
 {
   memory_cache::remove_if([](const GenericKey &) { return true; });
@@ -182,10 +200,14 @@ void remove_if(const FunctionRef<bool(const GenericKey &)> predicate)
 }
 
 static void try_enforce_limit()
+{
+  try_enforce_limit(get_cache().approximate_limit.load(std::memory_order_relaxed));
+}
+
+static void try_enforce_limit(const int64_t approximate_limit)
 {
   Cache &cache = get_cache();
   const int64_t old_size = cache.size_in_bytes.load(std::memory_order_relaxed);
-  const int64_t approximate_limit = cache.approximate_limit.load(std::memory_order_relaxed);
   if (old_size < approximate_limit) {
     /* Nothing to do, the current cache size is still within the right limits. */
     return;
@@ -2944,10 +2944,15 @@ IMesh trimesh_nary_intersect(const IMesh &tm_in,
   std::cout << "subdivided non-cluster tris found, time = " << subdivided_tris_time - itt_time
             << "\n";
 #  endif
+  /* The CDTs of the clusters are independent of each other. Only the extraction of the new faces
+   * in #calc_cluster_tris has to be done serially, to keep the result repeatable. */
   Array<CDT_data> cluster_subdivided(clinfo.tot_cluster());
-  for (int c : clinfo.index_range()) {
-    cluster_subdivided[c] = calc_cluster_subdivided(clinfo, c, *tm_clean, tri_ov, itt_map, arena);
-  }
+  threading::parallel_for(clinfo.index_range(), 1, [&](IndexRange range) {
+    for (int c : range) {
+      cluster_subdivided[c] = calc_cluster_subdivided(
+          clinfo, c, *tm_clean, tri_ov, itt_map, arena);
+    }
+  });
 #  ifdef PERFDEBUG
   double cluster_subdivide_time = BLI_time_now_seconds();
   std::cout << "subdivided clusters found, time = "
@@ -31,6 +31,12 @@ static int task_scheduler_num_threads = 1;
 static tbb::global_control *task_scheduler_global_control = nullptr;
 #endif
 
+/* NOTE: All work runs in the single default TBB arena, which spans every NUMA node of the
+ * machine. NUMA-constrained arenas would need every caller to pick an arena and allocate its
+ * memory from within it (first-touch), which the task API does not expose. On multi-socket
+ * machines, restricting Blender to one node (e.g. `numactl --cpunodebind=0 --membind=0`) and
+ * running one instance per node avoids cross-socket traffic entirely. */
+
 void BLI_task_scheduler_init()
 {
 #ifdef WITH_TBB_GLOBAL_CONTROL
@@ -0,0 +1,196 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "BLI_fileops.hh"
+#include "BLI_mutex.hh"
+#include "BLI_serialize.hh"
+#include "BLI_trace.hh"
+#include "BLI_vector.hh"
+
+namespace blender::trace {
+
+namespace detail {
+std::atomic<bool> is_recording = false;
+}
+
+namespace {
+
+struct Event {
+  enum class Type : int8_t {
+    Zone,
+    Counter,
+  };
+  Type type;
+  const char *name;
+  TimePoint start;
+  /** Zone duration, unused for counters. */
+  Clock::duration duration;
+  /** Counter value, unused for zones. */
+  double value;
+};
+
+/**
+ * Events are recorded into a buffer owned by the recording thread, so that threads only contend
+ * for the lock while a trace is written or cleared.
+ */
+struct ThreadEvents {
+  Mutex mutex;
+  int index;
+  std::string name;
+  Vector<Event> events;
+};
+
+struct Registry {
+  Mutex mutex;
+  /** Buffers are never freed, because all threads keep a pointer to their own buffer. */
+  Vector<std::unique_ptr<ThreadEvents>> threads;
+  /** Time stamps in the written trace are relative to this time. */
+  TimePoint origin = Clock::now();
+};
+
+}  // namespace
+
+static Registry &get_registry()
+{
+  static Registry registry;
+  return registry;
+}
+
+static ThreadEvents &get_thread_events()
+{
+  thread_local ThreadEvents *thread_events = nullptr;
+  if (thread_events == nullptr) {
+    Registry &registry = get_registry();
+    std::scoped_lock lock(registry.mutex);
+    std::unique_ptr<ThreadEvents> new_events = std::make_unique<ThreadEvents>();
+    new_events->index = int(registry.threads.size()) + 1;
+    thread_events = new_events.get();
+    registry.threads.append(std::move(new_events));
+  }
+  return *thread_events;
+}
+
+static void add_event(const Event &event)
+{
+  ThreadEvents &thread_events = get_thread_events();
+  std::scoped_lock lock(thread_events.mutex);
+  thread_events.events.append(event);
+}
+
+namespace detail {
+
+void add_zone(const char *name, const TimePoint start, const TimePoint end)
+{
+  add_event({Event::Type::Zone, name, start, end - start, 0.0});
+}
+
+void add_counter(const char *name, const double value)
+{
+  add_event({Event::Type::Counter, name, Clock::now(), Clock::duration(), value});
+}
+
+}  // namespace detail
+
+void start()
+{
+  /* Make sure the time origin is set before the first event. */
+  get_registry();
+  detail::is_recording.store(true, std::memory_order_relaxed);
+}
+
+void stop()
+{
+  detail::is_recording.store(false, std::memory_order_relaxed);
+}
+
+void clear()
+{
+  Registry &registry = get_registry();
+  std::scoped_lock lock(registry.mutex);
+  for (std::unique_ptr<ThreadEvents> &thread_events : registry.threads) {
+    std::scoped_lock thread_lock(thread_events->mutex);
+    thread_events->events.clear_and_shrink();
+  }
+}
+
+void set_thread_name(const StringRef name)
+{
+  ThreadEvents &thread_events = get_thread_events();
+  std::scoped_lock lock(thread_events.mutex);
+  thread_events.name = name;
+}
+
+static double to_microseconds(const Clock::duration duration)
+{
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void write_json(std::ostream &stream)
+{
+  using namespace io::serialize;
+
+  Registry &registry = get_registry();
+  DictionaryValue root;
+  ArrayValue &trace_events = *root.append_array("traceEvents");
+
+  {
+    std::scoped_lock lock(registry.mutex);
+    for (const std::unique_ptr<ThreadEvents> &thread_events : registry.threads) {
+      std::scoped_lock thread_lock(thread_events->mutex);
+      const int tid = thread_events->index;
+
+      if (!thread_events->name.empty()) {
+        DictionaryValue &metadata = *trace_events.append_dict();
+        metadata.append_str("name", "thread_name");
+        metadata.append_str("ph", "M");
+        metadata.append_int("pid", 1);
+        metadata.append_int("tid", tid);
+        metadata.append_dict("args")->append_str("name", thread_events->name);
+      }
+
+      for (const Event &event : thread_events->events) {
+        DictionaryValue &value = *trace_events.append_dict();
+        value.append_str("name", event.name);
+        value.append_int("pid", 1);
+        value.append_int("tid", tid);
+        value.append_double("ts", to_microseconds(event.start - registry.origin));
+        switch (event.type) {
+          case Event::Type::Zone:
+            value.append_str("ph", "X");
+            value.append_double("dur", to_microseconds(event.duration));
+            break;
+          case Event::Type::Counter:
+            value.append_str("ph", "C");
+            value.append_dict("args")->append_double(event.name, event.value);
+            break;
+        }
+      }
+    }
+  }
+
+  root.append_str("displayTimeUnit", "ms");
+
+  JsonFormatter formatter;
+  formatter.serialize(stream, root);
+}
+
+bool write_json_file(const char *filepath)
+{
+  blender::fstream stream(filepath, std::ios::out | std::ios::trunc);
+  if (!stream.is_open()) {
+    return false;
+  }
+  write_json(stream);
+  return !stream.fail();
+}
+
+}  // namespace blender::trace
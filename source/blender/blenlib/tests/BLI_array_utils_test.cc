@@ -6,6 +6,7 @@
 
 #include "BLI_array_utils.h"
 #include "BLI_array_utils.hh"
+#include "BLI_timeit.hh"
 #include "BLI_utildefines.h"
 #include "BLI_utildefines_stack.h"
 
@@ -291,3 +292,70 @@ TEST(array_utils, FindAllRanges5)
   const std::array data_cmp = {IndexRange(0, 1), IndexRange(3, 2), IndexRange(6, 1)};
   find_all_ranges_test(data, data_cmp);
 }
+
+TEST(array_utils, GatherIndicesMaskAndVArray)
+{
+  using namespace blender;
+  Array<float> src(100);
+  for (const int64_t i : src.index_range()) {
+    src[i] = float(i);
+  }
+  /* Every other index, so that the mask can not be reduced to ranges. */
+  Array<int> indices(src.size() / 2);
+  for (const int64_t i : indices.index_range()) {
+    indices[i] = int(i * 2);
+  }
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_indices(indices.as_span(), memory);
+
+  Array<float> dst_indices(indices.size());
+  Array<float> dst_mask(indices.size());
+  Array<float> dst_varray(indices.size());
+  array_utils::gather(src.as_span(), indices.as_span(), dst_indices.as_mutable_span());
+  array_utils::gather(src.as_span(), mask, dst_mask.as_mutable_span());
+  array_utils::gather(VArray<float>::ForSpan(src), mask, dst_varray.as_mutable_span());
+  for (const int64_t i : indices.index_range()) {
+    EXPECT_EQ(dst_indices[i], src[indices[i]]);
+    EXPECT_EQ(dst_mask[i], src[indices[i]]);
+    EXPECT_EQ(dst_varray[i], src[indices[i]]);
+  }
+}
+
+/**
+ * Set this to 1 to activate the benchmark. It is disabled by default, because it prints a lot.
+ */
+#if 0
+TEST(array_utils, GatherBenchmark)
+{
+  using namespace blender;
+  const int64_t size = 10'000'000;
+  Array<float> src(size);
+  for (const int64_t i : src.index_range()) {
+    src[i] = float(i);
+  }
+  /* Every other index, so that the mask can not be reduced to ranges. */
+  Array<int> indices(size / 2);
+  for (const int64_t i : indices.index_range()) {
+    indices[i] = int(i * 2);
+  }
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_indices(indices.as_span(), memory);
+
+  Array<float> dst(indices.size());
+  for ([[maybe_unused]] const int64_t i : IndexRange(5)) {
+    {
+      SCOPED_TIMER("Gather Indices");
+      array_utils::gather(src.as_span(), indices.as_span(), dst.as_mutable_span());
+    }
+    {
+      SCOPED_TIMER("Gather IndexMask");
+      array_utils::gather(src.as_span(), mask, dst.as_mutable_span());
+    }
+    {
+      SCOPED_TIMER("Gather VArray");
+      array_utils::gather(VArray<float>::ForSpan(src), mask, dst.as_mutable_span());
+    }
+  }
+  EXPECT_EQ(dst.last(), src[indices.last()]);
+}
+#endif /* Benchmark */
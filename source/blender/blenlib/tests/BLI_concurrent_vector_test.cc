@@ -0,0 +1,54 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <algorithm>
+
+#include "testing/testing.h"
+
+#include "BLI_concurrent_vector.hh"
+#include "BLI_task.hh"
+
+#include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
+
+namespace blender::tests {
+
+TEST(concurrent_vector, DefaultConstructor)
+{
+  ConcurrentVector<int> vec;
+  EXPECT_EQ(vec.size(), 0);
+  EXPECT_TRUE(vec.is_empty());
+}
+
+TEST(concurrent_vector, AppendAndExtend)
+{
+  ConcurrentVector<int> vec;
+  int &first = vec.append(3);
+  vec.append(5);
+  vec.extend({7, 9, 11});
+  EXPECT_EQ(vec.size(), 5);
+  EXPECT_FALSE(vec.is_empty());
+  EXPECT_EQ(&first, &vec[0]);
+  EXPECT_EQ(vec[1], 5);
+  EXPECT_EQ(vec[4], 11);
+}
+
+TEST(concurrent_vector, ParallelAppend)
+{
+  ConcurrentVector<int> vec;
+  threading::parallel_for(IndexRange(10000), 64, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      vec.append(int(i));
+    }
+  });
+  EXPECT_EQ(vec.size(), 10000);
+
+  Vector<int> values = vec.extract_vector();
+  EXPECT_TRUE(vec.is_empty());
+  std::sort(values.begin(), values.end());
+  for (const int64_t i : values.index_range()) {
+    EXPECT_EQ(values[i], int(i));
+  }
+}
+
+}  // namespace blender::tests
@@ -103,6 +103,7 @@ TEST_PARSE_FAIL(BadArgCount2, "sqrt(1,2)")
 TEST_PARSE_FAIL(BadArgCount3, "pi()")
 TEST_PARSE_FAIL(BadArgCount4, "max()")
 TEST_PARSE_FAIL(BadArgCount5, "min()")
+TEST_PARSE_FAIL(MathModule, "math.sqrt(4)")
 
 TEST_PARSE_FAIL(Truncated1, "(1+2")
 TEST_PARSE_FAIL(Truncated2, "1 if 2")
@@ -146,6 +147,8 @@ TEST_CONST(TenE, "1.e+1", 10.0)
 TEST_CONST(Half, ".5", 0.5)
 
 TEST_CONST(Pi, "pi", M_PI)
+TEST_CONST(E, "e", M_E)
+TEST_CONST(Tau, "tau", 2.0 * M_PI)
 TEST_CONST(True, "True", TRUE_VAL)
 TEST_CONST(False, "False", FALSE_VAL)
 
@@ -160,6 +163,9 @@ TEST_EVAL(Pow, "pow(4, x)", 0.5, 2.0)
 
 TEST_CONST(Log2_1, "log(4, 2)", 2.0)
 
+TEST_CONST(Hypot, "hypot(3, 4)", 5.0)
+TEST_CONST(CopySign, "copysign(2, -1)", -2.0)
+
 TEST_CONST(Round1, "round(-0.5)", -1.0)
 TEST_CONST(Round2, "round(-0.4)", 0.0)
 TEST_CONST(Round3, "round(0.4)", 0.0)
@@ -134,3 +134,44 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+TEST(kdopbvh, UpdateTree)
+{
+  /* Enough points for the branches to be joined in parallel. */
+  const int points_len = 10000;
+  const float offset[3] = {0.5f, -2.0f, 3.0f};
+  RNG *rng = BLI_rng_new(4321);
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 4, 8);
+
+  void *mem = MEM_malloc_arrayN<float[3]>(size_t(points_len), __func__);
+  float(*points)[3] = (float(*)[3])mem;
+
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(points[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, points[i], 1);
+  }
+  BLI_bvhtree_balance(tree);
+
+  for (int i = 0; i < points_len; i++) {
+    add_v3_v3(points[i], offset);
+    BLI_bvhtree_update_node(tree, i, points[i], nullptr, 1);
+  }
+  BLI_bvhtree_update_tree(tree);
+
+  float bb_min[3], bb_max[3];
+  BLI_bvhtree_get_bounding_box(tree, bb_min, bb_max);
+  for (int i = 0; i < points_len; i++) {
+    for (int axis = 0; axis < 3; axis++) {
+      EXPECT_LE(bb_min[axis], points[i][axis]);
+      EXPECT_GE(bb_max[axis], points[i][axis]);
+    }
+    const int j = BLI_bvhtree_find_nearest(tree, points[i], nullptr, nullptr, nullptr);
+    EXPECT_GE(j, 0);
+    EXPECT_LT(j, points_len);
+    EXPECT_EQ_ARRAY(points[i], points[j], 3);
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+}
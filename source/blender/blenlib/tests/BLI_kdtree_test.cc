@@ -54,6 +54,24 @@ static void deduplicate_test()
   }
 }
 
+static void find_nearest_large_test()
+{
+  /* Large enough for the sub-trees to be balanced on multiple threads. */
+  const int tree_size = 100000;
+  KDTree_3d *tree = BLI_kdtree_3d_new(tree_size);
+  for (int i = 0; i < tree_size; i++) {
+    const float co[3] = {float(i % 100), float((i / 100) % 100), float(i / 10000)};
+    BLI_kdtree_3d_insert(tree, i, co);
+  }
+  BLI_kdtree_3d_balance(tree);
+  for (int i = 0; i < tree_size; i += 997) {
+    const float co[3] = {float(i % 100) + 0.1f, float((i / 100) % 100), float(i / 10000)};
+    KDTreeNearest_3d nearest;
+    EXPECT_EQ(BLI_kdtree_3d_find_nearest(tree, co, &nearest), i);
+  }
+  BLI_kdtree_3d_free(tree);
+}
+
 TEST(kdtree, Standard)
 {
   standard_test();
@@ -63,3 +81,8 @@ TEST(kdtree, Deduplicate)
 {
   deduplicate_test();
 }
+
+TEST(kdtree, FindNearestLarge)
+{
+  find_nearest_large_test();
+}
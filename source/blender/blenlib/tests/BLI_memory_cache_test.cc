@@ -105,4 +105,40 @@ TEST(memory_cache, RemoveIf)
                })->value);
 }
 
+TEST(memory_cache, ShrinkToApproximateSize)
+{
+  memory_cache::clear();
+  EXPECT_EQ(memory_cache::get_values_num(), 0);
+  EXPECT_EQ(memory_cache::get_approximate_size(), 0);
+
+  for (int i = 0; i < 100; i++) {
+    memory_cache::get<CachedInt>(GenericIntKey(i),
+                                 [&]() { return std::make_unique<CachedInt>(i); });
+  }
+  EXPECT_EQ(memory_cache::get_values_num(), 100);
+  const int64_t full_size = memory_cache::get_approximate_size();
+  EXPECT_GT(full_size, 0);
+
+  /* The least recently used values are freed first. */
+  memory_cache::shrink_to_approximate_size(full_size / 2);
+  EXPECT_GT(memory_cache::get_values_num(), 0);
+  EXPECT_LT(memory_cache::get_values_num(), 100);
+  EXPECT_LE(memory_cache::get_approximate_size(), full_size / 2);
+  EXPECT_EQ(99, memory_cache::get<CachedInt>(GenericIntKey(99), [&]() {
+                  return std::make_unique<CachedInt>(-1);
+                })->value);
+  EXPECT_EQ(-1, memory_cache::get<CachedInt>(GenericIntKey(0), [&]() {
+                  return std::make_unique<CachedInt>(-1);
+                })->value);
+
+  memory_cache::shrink_to_approximate_size(0);
+  EXPECT_EQ(memory_cache::get_values_num(), 0);
+  EXPECT_EQ(memory_cache::get_approximate_size(), 0);
+
+  /* The configured limit is unchanged, so new values are cached again. */
+  memory_cache::get<CachedInt>(GenericIntKey(1), []() { return std::make_unique<CachedInt>(1); });
+  EXPECT_EQ(memory_cache::get_values_num(), 1);
+  memory_cache::clear();
+}
+
 }  // namespace blender::memory_cache::tests
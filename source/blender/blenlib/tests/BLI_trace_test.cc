@@ -0,0 +1,96 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <sstream>
+
+#include "testing/testing.h"
+
+#include "BLI_serialize.hh"
+#include "BLI_task.hh"
+#include "BLI_trace.hh"
+
+#include "BLI_strict_flags.h" /* IWYU pragma: keep. Keep last. */
+
+namespace blender::tests {
+
+static std::unique_ptr<io::serialize::Value> write_and_parse_trace()
+{
+  std::stringstream stream;
+  trace::write_json(stream);
+  io::serialize::JsonFormatter formatter;
+  return formatter.deserialize(stream);
+}
+
+static int count_events(const io::serialize::Value &root, const StringRef name)
+{
+  const io::serialize::ArrayValue &events =
+      *(*root.as_dictionary_value()->lookup("traceEvents"))->as_array_value();
+  int count = 0;
+  for (const std::shared_ptr<io::serialize::Value> &event : events.elements()) {
+    if (event->as_dictionary_value()->lookup_str("name") == name) {
+      count++;
+    }
+  }
+  return count;
+}
+
+TEST(trace, NotRecording)
+{
+  trace::clear();
+  {
+    TRACE_ZONE("zone_not_recorded");
+    trace::counter("counter_not_recorded", 1.0);
+  }
+  const std::unique_ptr<io::serialize::Value> root = write_and_parse_trace();
+  EXPECT_EQ(count_events(*root, "zone_not_recorded"), 0);
+  EXPECT_EQ(count_events(*root, "counter_not_recorded"), 0);
+}
+
+TEST(trace, ZonesAndCounters)
+{
+  trace::clear();
+  trace::start();
+  {
+    TRACE_ZONE("outer_zone");
+    {
+      TRACE_ZONE("inner_zone");
+      trace::counter("test_counter", 5.0);
+    }
+  }
+  trace::stop();
+
+  const std::unique_ptr<io::serialize::Value> root = write_and_parse_trace();
+  EXPECT_EQ(count_events(*root, "outer_zone"), 1);
+  EXPECT_EQ(count_events(*root, "inner_zone"), 1);
+  EXPECT_EQ(count_events(*root, "test_counter"), 1);
+
+  trace::clear();
+  EXPECT_EQ(count_events(*write_and_parse_trace(), "outer_zone"), 0);
+}
+
+TEST(trace, ThreadName)
+{
+  trace::clear();
+  trace::set_thread_name("test_thread");
+  const std::unique_ptr<io::serialize::Value> root = write_and_parse_trace();
+  EXPECT_EQ(count_events(*root, "thread_name"), 1);
+}
+
+TEST(trace, ParallelZones)
+{
+  trace::clear();
+  trace::start();
+  threading::parallel_for(IndexRange(1000), 1, [&](const IndexRange range) {
+    for ([[maybe_unused]] const int64_t i : range) {
+      TRACE_ZONE("parallel_zone");
+    }
+  });
+  trace::stop();
+
+  const std::unique_ptr<io::serialize::Value> root = write_and_parse_trace();
+  EXPECT_EQ(count_events(*root, "parallel_zone"), 1000);
+  trace::clear();
+}
+
+}  // namespace blender::tests
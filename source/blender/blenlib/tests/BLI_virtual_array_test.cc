@@ -4,6 +4,7 @@
 
 #include "BLI_array.hh"
 #include "BLI_generic_virtual_array.hh"
+#include "BLI_timeit.hh"
 #include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
 #include "BLI_virtual_array.hh"
@@ -285,4 +286,101 @@ TEST(virtual_array, EmptySpanWrapper)
   }
 }
 
+static int64_t varray_sum(const VArray<int> &varray)
+{
+  int64_t sum = 0;
+  for (const int64_t i : varray.index_range()) {
+    sum += varray[i];
+  }
+  return sum;
+}
+
+static int64_t varray_sum_devirtualized(const VArray<int> &varray)
+{
+  int64_t sum = 0;
+  devirtualize_varray(varray, [&](const auto values) {
+    for (const int64_t i : IndexRange(varray.size())) {
+      sum += values[i];
+    }
+  });
+  return sum;
+}
+
+TEST(virtual_array, DevirtualizedSum)
+{
+  const int64_t size = 1000;
+  Array<int> values(size);
+  for (const int64_t i : values.index_range()) {
+    values[i] = int(i % 100);
+  }
+  const VArray<int> span_varray = VArray<int>::ForSpan(values);
+  const VArray<int> single_varray = VArray<int>::ForSingle(7, size);
+  const VArray<int> func_varray = VArray<int>::ForFunc(size, [](const int64_t i) {
+    return int(i % 100);
+  });
+  EXPECT_EQ(varray_sum(span_varray), 49500);
+  EXPECT_EQ(varray_sum_devirtualized(span_varray), 49500);
+  EXPECT_EQ(varray_sum(single_varray), 7000);
+  EXPECT_EQ(varray_sum_devirtualized(single_varray), 7000);
+  EXPECT_EQ(varray_sum(func_varray), 49500);
+  EXPECT_EQ(varray_sum_devirtualized(func_varray), 49500);
+}
+
+/**
+ * Set this to 1 to activate the benchmark. It is disabled by default, because it prints a lot.
+ */
+#if 0
+static BLI_NOINLINE int64_t benchmark_varray_sum(const VArray<int> &varray)
+{
+  int64_t sum = 0;
+  for (const int64_t i : varray.index_range()) {
+    sum += varray[i];
+  }
+  return sum;
+}
+
+static BLI_NOINLINE int64_t benchmark_varray_sum_devirtualized(const VArray<int> &varray)
+{
+  int64_t sum = 0;
+  devirtualize_varray(varray, [&](const auto values) {
+    for (const int64_t i : IndexRange(varray.size())) {
+      sum += values[i];
+    }
+  });
+  return sum;
+}
+
+static void benchmark_varray(StringRef name, const VArray<int> &varray)
+{
+  int64_t sum = 0;
+  for ([[maybe_unused]] const int64_t i : IndexRange(5)) {
+    {
+      SCOPED_TIMER(name + " Virtual");
+      sum += benchmark_varray_sum(varray);
+    }
+    {
+      SCOPED_TIMER(name + " Devirtualized");
+      sum += benchmark_varray_sum_devirtualized(varray);
+    }
+  }
+  /* Print the value for simple error checking and to avoid some compiler optimizations. */
+  std::cout << "Sum: " << sum << "\n";
+}
+
+TEST(virtual_array, Benchmark)
+{
+  const int64_t size = 10'000'000;
+  Array<int> values(size);
+  for (const int64_t i : values.index_range()) {
+    values[i] = int(i % 1000);
+  }
+  benchmark_varray("Span  ", VArray<int>::ForSpan(values));
+  benchmark_varray("Single", VArray<int>::ForSingle(7, size));
+  benchmark_varray("Func  ", VArray<int>::ForFunc(size, [](const int64_t i) {
+                     return int(i % 1000);
+                   }));
+}
+
+#endif /* Benchmark */
+
 }  // namespace blender::tests
@@ -93,7 +93,7 @@ struct BlendFileReadWMSetupData {
 };
 
 struct BlendFileReadParams {
-  uint skip_flags : 3; /* #eBLOReadSkip */
+  uint skip_flags : 4; /* #eBLOReadSkip */
   uint is_startup : 1;
   uint is_factory_settings : 1;
 
@@ -155,8 +155,14 @@ enum eBLOReadSkip {
   BLO_READ_SKIP_DATA = (1 << 1),
   /** Do not attempt to re-use IDs from old bmain for unchanged ones in case of undo. */
   BLO_READ_SKIP_UNDO_OLD_MAIN = (1 << 2),
+  /**
+   * Only read the active scene and the IDs it uses (directly or indirectly), other local IDs and
+   * the linked IDs they use are skipped. Meant for rendering a single scene of a large file.
+   * Ignored for undo.
+   */
+  BLO_READ_SKIP_UNUSED_BY_SCENE = (1 << 3),
 };
-ENUM_OPERATORS(eBLOReadSkip, BLO_READ_SKIP_UNDO_OLD_MAIN)
+ENUM_OPERATORS(eBLOReadSkip, BLO_READ_SKIP_UNUSED_BY_SCENE)
 #define BLO_READ_SKIP_ALL (BLO_READ_SKIP_USERDEF | BLO_READ_SKIP_DATA)
 
 /**
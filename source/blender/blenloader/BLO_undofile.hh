@@ -42,6 +42,9 @@ struct MemFileChunk {
   /** Session UID of the ID being currently written (MAIN_ID_SESSION_UID_UNSET when not writing
    * ID-related data). Used to find matching chunks in previous memundo step. */
   uint id_session_uid;
+  /** Hash of the content, only computed when needed, see #has_hash. */
+  uint64_t hash;
+  bool has_hash;
 };
 
 struct MemFile {
@@ -60,6 +63,12 @@ struct MemFileWriteData {
 
   uint current_id_session_uid;
   MemFileChunk *reference_current_chunk;
+  /**
+   * First reference chunk that was not matched since the last matching chunk. Searching for a
+   * matching chunk starts from here, so that the reference chunks skipped after data was inserted
+   * can still be found.
+   */
+  MemFileChunk *reference_unmatched_chunk;
 
   /** Maps an ID session uid to its first reference MemFileChunk, if existing. */
   blender::Map<uint, MemFileChunk *> id_session_uid_mapping;
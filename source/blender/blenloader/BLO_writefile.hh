@@ -44,6 +44,17 @@ struct BlendFileWriteParams {
   /** On write, restore paths after editing them (see #BLO_WRITE_PATH_REMAP_RELATIVE). */
   uint use_save_as_copy : 1;
   uint use_userdef : 1;
+  /**
+   * Keep the compressed data of this write in memory, so that unchanged data does not need to be
+   * compressed again by the next write using this option (used for auto-save).
+   */
+  uint use_frame_cache : 1;
+  /**
+   * Only serialize the data on the calling thread, the file is written to disk and moved into
+   * place by a background thread. Errors of that part are only logged.
+   * Not supported with #use_save_versions.
+   */
+  uint use_background_write : 1;
   const BlendThumbnail *thumb;
 };
 
@@ -61,4 +72,9 @@ extern bool BLO_write_file(Main *mainvar,
  */
 extern bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, int write_flags);
 
+/**
+ * Wait for a file write started with #BlendFileWriteParams.use_background_write to finish.
+ */
+extern void BLO_write_file_background_wait();
+
 /** \} */
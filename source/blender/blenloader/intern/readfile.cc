@@ -21,10 +21,12 @@
 #else
 #  include "BLI_winstuff.h"
 #  include "winsock2.h"
-#  include <io.h> /* for open close read */
+#  include <io.h>      /* for open close read */
+#  include <process.h> /* for getpid */
 #endif
 
 #include <fmt/format.h>
+#include <xxhash.h>
 
 #include "CLG_log.h"
 
@@ -51,14 +53,17 @@
 #include "BLI_ghash.h"
 #include "BLI_map.hh"
 #include "BLI_memarena.h"
+#include "BLI_path_utils.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -185,6 +190,7 @@ static CLG_LogRef LOG_UNDO = {"blo.readfile.undo"};
 static void read_libraries(FileData *basefd, ListBase *mainlist);
 static void *read_struct(FileData *fd, BHead *bh, const char *blockname, const int id_type_index);
 static BHead *find_bhead_from_code_name(FileData *fd, const short idcode, const char *name);
+static void read_file_scene_closure(FileData *fd, BlendFileData *bfd);
 
 struct BHeadN {
   BHeadN *next, *prev;
@@ -1327,6 +1333,116 @@ FileData *blo_filedata_from_file(const char *filepath, BlendFileReadReport *repo
   return nullptr;
 }
 
+/* Optional cache of decompressed library files, enabled by setting the
+ * `BLENDER_LIBRARY_CACHE_DIR` environment variable to a directory. Compressed libraries linked by
+ * many files (e.g. when rendering many shots on a farm) are then only decompressed once per
+ * machine, later reads memory-map the cached copy, which also shares its pages between
+ * processes. */
+
+static bool library_cache_filepath_get(const char *filepath, char r_cache_filepath[FILE_MAX])
+{
+  const char *cache_dir = BLI_getenv("BLENDER_LIBRARY_CACHE_DIR");
+  if (cache_dir == nullptr || cache_dir[0] == '\0') {
+    return false;
+  }
+  BLI_stat_t st;
+  if (BLI_stat(filepath, &st) != 0) {
+    return false;
+  }
+  /* Identify the file by its path, size and modification time, so that the cached copy is not
+   * used anymore once the library is saved again. */
+  const std::string key = fmt::format(
+      "{}|{}|{}", filepath, int64_t(st.st_size), int64_t(st.st_mtime));
+  const XXH128_hash_t hash = XXH3_128bits(key.data(), key.size());
+  const std::string filename = fmt::format("{:016x}{:016x}.blend", hash.high64, hash.low64);
+  BLI_path_join(r_cache_filepath, FILE_MAX, cache_dir, filename.c_str());
+  return true;
+}
+
+/**
+ * Write the decompressed content of the library at \a filepath to \a cache_filepath.
+ * \return false if the library is not compressed or writing failed.
+ */
+static bool library_cache_write(const char *filepath, const char *cache_filepath)
+{
+  /* Uncompressed files are memory-mapped directly, caching them would not help. */
+  const int file = BLI_open(filepath, O_BINARY | O_RDONLY, 0);
+  if (file == -1) {
+    return false;
+  }
+  char header[7];
+  const bool is_compressed = (read(file, header, sizeof(header)) == int64_t(sizeof(header))) &&
+                             (BLI_file_magic_is_zstd(header) || BLI_file_magic_is_gzip(header));
+  close(file);
+  if (!is_compressed) {
+    return false;
+  }
+
+  BlendFileReadReport read_report{};
+  FileData *fd = blo_filedata_from_file_open(filepath, &read_report);
+  if (fd == nullptr) {
+    return false;
+  }
+
+  /* Write to a temporary file first, other processes may try to use the cache at the same time. */
+  const std::string temp_filepath = fmt::format("{}@{}", cache_filepath, int(getpid()));
+  const int temp_file = BLI_open(
+      temp_filepath.c_str(), O_BINARY | O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  bool success = (temp_file != -1);
+  if (success) {
+    const size_t buffer_size = size_t(1) << 20;
+    char *buffer = MEM_malloc_arrayN<char>(buffer_size, __func__);
+    while (true) {
+      const int64_t read_len = fd->file->read(fd->file, buffer, buffer_size);
+      if (read_len <= 0) {
+        success = (read_len == 0);
+        break;
+      }
+      if (write(temp_file, buffer, size_t(read_len)) != read_len) {
+        success = false;
+        break;
+      }
+    }
+    MEM_freeN(buffer);
+    success &= (close(temp_file) == 0);
+  }
+  blo_filedata_free(fd);
+
+  if (success) {
+    success = (BLI_rename_overwrite(temp_filepath.c_str(), cache_filepath) == 0);
+  }
+  if (!success && temp_file != -1) {
+    BLI_delete(temp_filepath.c_str(), false, false);
+  }
+  return success;
+}
+
+/**
+ * Same as #blo_filedata_from_file, but reads the decompressed copy of the library from the
+ * library cache when enabled, creating it when needed.
+ */
+static FileData *blo_filedata_from_library_file(const char *filepath,
+                                                BlendFileReadReport *reports)
+{
+  char cache_filepath[FILE_MAX];
+  if (library_cache_filepath_get(filepath, cache_filepath)) {
+    if (BLI_exists(cache_filepath) || library_cache_write(filepath, cache_filepath)) {
+      FileData *fd = blo_filedata_from_file_open(cache_filepath, reports);
+      if (fd != nullptr) {
+        /* Relative paths are relative to the library, not to its cached copy. */
+        STRNCPY(fd->relabase, filepath);
+        fd = blo_decode_and_check(fd, reports->reports);
+        if (fd != nullptr) {
+          return fd;
+        }
+        /* The cached copy is invalid, remove it and read the library itself. */
+        BLI_delete(cache_filepath, false, false);
+      }
+    }
+  }
+  return blo_filedata_from_file(filepath, reports);
+}
+
 /**
  * Same as blo_filedata_from_file(), but does not reads DNA data, only header.
  * Use it for light access (e.g. thumbnail reading).
@@ -1884,17 +2000,30 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname, const i
     if (fd->compflags[bh->SDNAnr] != SDNA_CMP_REMOVED) {
       const char *alloc_name = get_alloc_name(fd, bh, blockname, id_type_index);
       if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
+        const void *data = (bh + 1);
 #ifdef USE_BHEAD_READ_ON_DEMAND
         if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
-          bh = blo_bhead_read_full(fd, bh);
-          if (UNLIKELY(bh == nullptr)) {
-            fd->flags &= ~FD_FLAGS_FILE_OK;
-            return nullptr;
+          /* When the file is in memory (typically memory-mapped), reconstruct straight from it
+           * instead of copying the whole block into a temporary allocation first. */
+          data = BLI_filereader_memory_data(
+              fd->file, BHEADN_FROM_BHEAD(bh)->file_offset, size_t(bh->len));
+          if (data == nullptr) {
+            bh = blo_bhead_read_full(fd, bh);
+            if (UNLIKELY(bh == nullptr)) {
+              fd->flags &= ~FD_FLAGS_FILE_OK;
+              return nullptr;
+            }
+            data = (bh + 1);
           }
         }
 #endif
-        temp = DNA_struct_reconstruct(
-            fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1), alloc_name);
+        temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, data, alloc_name);
+#ifdef USE_BHEAD_READ_ON_DEMAND
+        if (UNLIKELY(BLI_filereader_memory_io_error(fd->file))) {
+          fd->flags &= ~FD_FLAGS_FILE_OK;
+          MEM_SAFE_FREE(temp);
+        }
+#endif
       }
       else {
         /* SDNA_CMP_EQUAL */
@@ -3450,10 +3579,50 @@ static int lib_link_cb(LibraryIDLinkCallbackData *cb_data)
   return IDWALK_RET_NOP;
 }
 
+static LibraryForeachIDFlag lib_link_foreach_id_flag(const FileData *fd)
+{
+  /* Not all original pointer values can be considered as valid.
+   * Handling of DNA deprecated data should never be needed in undo case. */
+  return IDWALK_NO_ORIG_POINTERS_ACCESS | IDWALK_INCLUDE_UI |
+         ((fd->flags & FD_FLAGS_IS_MEMFILE) ? IDWALK_NOP : IDWALK_DO_DEPRECATED_POINTERS);
+}
+
+static bool lib_link_id_is_threadsafe(const ID *id)
+{
+  const IDTypeInfo *id_type = BKE_idtype_get_info_from_id(id);
+  return (id_type->flags & IDTYPE_FLAGS_THREADSAFE_FOREACH_ID) != 0;
+}
+
+/**
+ * Remap the ID pointers of all IDs whose type supports it in parallel, since it is the most
+ * expensive part of #lib_link_all for files with many IDs. The lookups in the lib-map are
+ * read-only, and each task only writes into the data of the ID it processes.
+ */
+static void lib_link_all_threadsafe_ids(BlendLibReader *reader, Main *bmain)
+{
+  blender::Vector<ID *> ids;
+  ID *id;
+  FOREACH_MAIN_ID_BEGIN (bmain, id) {
+    if (BLO_readfile_id_runtime_tags(*id).needs_linking && lib_link_id_is_threadsafe(id)) {
+      ids.append(id);
+    }
+  }
+  FOREACH_MAIN_ID_END;
+
+  const LibraryForeachIDFlag flag = lib_link_foreach_id_flag(reader->fd);
+  blender::threading::parallel_for(ids.index_range(), 256, [&](const blender::IndexRange range) {
+    for (const int64_t i : range) {
+      BKE_library_foreach_ID_link(bmain, ids[i], lib_link_cb, reader, flag);
+    }
+  });
+}
+
 static void lib_link_all(FileData *fd, Main *bmain)
 {
   BlendLibReader reader = {fd, bmain};
 
+  lib_link_all_threadsafe_ids(&reader, bmain);
+
   ID *id;
   FOREACH_MAIN_ID_BEGIN (bmain, id) {
     const IDTypeInfo *id_type = BKE_idtype_get_info_from_id(id);
@@ -3479,13 +3648,11 @@ static void lib_link_all(FileData *fd, Main *bmain)
     }
 
     if (BLO_readfile_id_runtime_tags(*id).needs_linking) {
-      /* Not all original pointer values can be considered as valid.
-       * Handling of DNA deprecated data should never be needed in undo case. */
-      const LibraryForeachIDFlag flag = IDWALK_NO_ORIG_POINTERS_ACCESS | IDWALK_INCLUDE_UI |
-                                        ((fd->flags & FD_FLAGS_IS_MEMFILE) ?
-                                             IDWALK_NOP :
-                                             IDWALK_DO_DEPRECATED_POINTERS);
-      BKE_library_foreach_ID_link(bmain, id, lib_link_cb, &reader, flag);
+      /* Thread-safe IDs had their pointers remapped already, see
+       * #lib_link_all_threadsafe_ids. The 'after liblink' callbacks can access other IDs. */
+      if (!lib_link_id_is_threadsafe(id)) {
+        BKE_library_foreach_ID_link(bmain, id, lib_link_cb, &reader, lib_link_foreach_id_flag(fd));
+      }
 
       after_liblink_id_process(&reader, id);
 
@@ -3783,6 +3950,10 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
     }
   }
 
+  /* Only read IDs when they are found to be used by the active scene, after the main loop. */
+  const bool use_scene_closure = !is_undo && (fd->skip_flags & BLO_READ_SKIP_DATA) == 0 &&
+                                 (fd->skip_flags & BLO_READ_SKIP_UNUSED_BY_SCENE) != 0;
+
   if (is_undo) {
     /* This idmap will store UIDs of all IDs ending up in the new main, whether they are newly
      * read, or re-used from the old main. */
@@ -3817,7 +3988,7 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
         break;
 
       case ID_LINK_PLACEHOLDER:
-        if (fd->skip_flags & BLO_READ_SKIP_DATA) {
+        if ((fd->skip_flags & BLO_READ_SKIP_DATA) || use_scene_closure) {
           bhead = blo_bhead_next(fd, bhead);
         }
         else {
@@ -3838,7 +4009,9 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
         if (blo_bhead_is_id_valid_type(bhead)) {
           /* BHead is a valid known ID type one, read the whole ID and its sub-data, unless reading
            * actual data is skipped. */
-          if (fd->skip_flags & BLO_READ_SKIP_DATA) {
+          if ((fd->skip_flags & BLO_READ_SKIP_DATA) ||
+              (use_scene_closure && bhead->code != ID_LI))
+          {
             bhead = blo_bhead_next(fd, bhead);
           }
           else {
@@ -3857,6 +4030,13 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
     }
   }
 
+  if (use_scene_closure) {
+    read_file_scene_closure(fd, bfd);
+    if (bfd->main->is_read_invalid) {
+      return bfd;
+    }
+  }
+
   if (is_undo) {
     /* Move the remaining Library IDs and their linked data to the new main.
      *
@@ -4448,6 +4628,94 @@ void BLO_expand_main(void *fdhandle, Main *mainvar, BLOExpandDoitCallback callba
   }
 }
 
+/**
+ * #BLOExpandDoitCallback reading the not yet read IDs of the main file, and the placeholders of
+ * linked IDs, used by already read IDs. See #read_file_scene_closure.
+ */
+static void expand_doit_local(void *fdhandle, Main *mainvar, void *old)
+{
+  FileData *fd = static_cast<FileData *>(fdhandle);
+
+  if (mainvar->is_read_invalid) {
+    return;
+  }
+
+  BHead *bhead = find_bhead(fd, old);
+  if (bhead == nullptr) {
+    return;
+  }
+  /* In 2.50+ file identifier for screens is patched, forward compatibility. */
+  if (bhead->code == ID_SCRN) {
+    bhead->code = ID_SCR;
+  }
+  if (!blo_bhead_is_id_valid_type(bhead) || !blo_bhead_id_name(fd, bhead)) {
+    return;
+  }
+
+  if (bhead->code == ID_LINK_PLACEHOLDER) {
+    /* Add link placeholder to the main of the library it belongs to, it is read later by
+     * #read_libraries like in the regular case. */
+    BHead *bheadlib = find_previous_lib(fd, bhead);
+    if (bheadlib == nullptr) {
+      return;
+    }
+    Library *lib = reinterpret_cast<Library *>(
+        read_id_struct(fd, bheadlib, "Data for Library ID type", INDEX_ID_NULL));
+    Main *libmain = blo_find_main(fd, lib->filepath, fd->relabase);
+    MEM_freeN(lib);
+
+    if (libmain->curlib != nullptr && library_id_is_yet_read(fd, libmain, bhead) == nullptr) {
+      ID *id = nullptr;
+      read_libblock(fd, libmain, bhead, 0, {}, true, &id);
+      if (id != nullptr) {
+        id_sort_by_name(which_libbase(libmain, GS(id->name)), id, static_cast<ID *>(id->prev));
+      }
+    }
+    return;
+  }
+
+  if (library_id_is_yet_read(fd, mainvar, bhead) == nullptr) {
+    ID_Readfile_Data::Tags id_read_tags{};
+    id_read_tags.needs_expanding = true;
+    ID *id = nullptr;
+    read_libblock(fd, mainvar, bhead, ID_TAG_LOCAL, id_read_tags, false, &id);
+    if (id != nullptr) {
+      id_sort_by_name(which_libbase(mainvar, GS(id->name)), id, static_cast<ID *>(id->prev));
+    }
+  }
+}
+
+/**
+ * Read the active scene of the file and all the IDs it uses, directly or indirectly, see
+ * #BLO_READ_SKIP_UNUSED_BY_SCENE. All scenes are used when the file has no active scene.
+ */
+static void read_file_scene_closure(FileData *fd, BlendFileData *bfd)
+{
+  Main *bmain = bfd->main;
+
+  BHead *bhead_scene = find_bhead(fd, bfd->curscene);
+  if (bhead_scene != nullptr && bhead_scene->code == ID_SCE) {
+    expand_doit_local(fd, bmain, const_cast<void *>(bhead_scene->old));
+  }
+  else {
+    for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+      if (bhead->code == ID_SCE) {
+        expand_doit_local(fd, bmain, const_cast<void *>(bhead->old));
+      }
+    }
+  }
+
+  BLO_expand_main(fd, bmain, expand_doit_local);
+
+  /* The name maps are only valid while expanding, later steps remove IDs from these mains. */
+  LISTBASE_FOREACH (Main *, mainvar, fd->mainlist) {
+    if (mainvar->id_map != nullptr) {
+      BKE_main_idmap_destroy(mainvar->id_map);
+      mainvar->id_map = nullptr;
+    }
+  }
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -4991,7 +5259,8 @@ static FileData *read_library_file_data(FileData *basefd,
                      mainptr->curlib->runtime->filepath_abs,
                      mainptr->curlib->filepath,
                      library_parent_filepath(mainptr->curlib));
-    fd = blo_filedata_from_file(mainptr->curlib->runtime->filepath_abs, basefd->reports);
+    fd = blo_filedata_from_library_file(mainptr->curlib->runtime->filepath_abs,
+                                        basefd->reports);
   }
 
   if (fd) {
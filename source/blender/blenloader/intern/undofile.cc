@@ -18,6 +18,8 @@
 #  include <io.h>
 #endif
 
+#include <xxhash.h>
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_listBase.h"
@@ -103,6 +105,7 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
   mem_data->reference_current_chunk = reference_memfile ? static_cast<MemFileChunk *>(
                                                               reference_memfile->chunks.first) :
                                                           nullptr;
+  mem_data->reference_unmatched_chunk = nullptr;
 
   /* If we have a reference memfile, we generate a mapping between the session_uid's of the
    * IDs stored in that previous undo step, and its first matching memchunk. This will allow
@@ -125,6 +128,56 @@ void BLO_memfile_write_finalize(MemFileWriteData *mem_data)
   mem_data->id_session_uid_mapping.clear();
 }
 
+/**
+ * How many chunks of the same ID are searched past the expected one, when it does not match the
+ * written data. This handles data being inserted or removed in the middle of an ID (e.g. adding
+ * an item to a list), which would otherwise shift all following chunks of that ID and prevent
+ * them from being shared with the previous step.
+ */
+#define MEMFILE_CHUNK_RESYNC_LOOKAHEAD 64
+
+static uint64_t memfile_chunk_hash(MemFileChunk *chunk)
+{
+  if (!chunk->has_hash) {
+    chunk->hash = XXH3_64bits(chunk->buf, chunk->size);
+    chunk->has_hash = true;
+  }
+  return chunk->hash;
+}
+
+/**
+ * Find a chunk identical to the data stored in \a curchunk, starting at \a first_chunk and
+ * belonging to the same ID.
+ */
+static MemFileChunk *memfile_chunk_find_ahead(MemFileChunk *first_chunk,
+                                              MemFileChunk *curchunk,
+                                              const char *buf)
+{
+  if (curchunk->id_session_uid == MAIN_ID_SESSION_UID_UNSET) {
+    return nullptr;
+  }
+  MemFileChunk *chunk = first_chunk;
+  for (int i = 0; chunk != nullptr && i < MEMFILE_CHUNK_RESYNC_LOOKAHEAD;
+       i++, chunk = static_cast<MemFileChunk *>(chunk->next))
+  {
+    if (chunk->id_session_uid != curchunk->id_session_uid) {
+      break;
+    }
+    if (chunk->size != curchunk->size) {
+      continue;
+    }
+    if (!curchunk->has_hash) {
+      curchunk->hash = XXH3_64bits(buf, curchunk->size);
+      curchunk->has_hash = true;
+    }
+    if (memfile_chunk_hash(chunk) == curchunk->hash && memcmp(chunk->buf, buf, chunk->size) == 0)
+    {
+      return chunk;
+    }
+  }
+  return nullptr;
+}
+
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size)
 {
   MemFile *memfile = mem_data->written_memfile;
@@ -139,6 +192,8 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
    * will then not be undo. Though it's not entirely clear that is wrong behavior. */
   curchunk->is_identical_future = true;
   curchunk->id_session_uid = mem_data->current_id_session_uid;
+  curchunk->hash = 0;
+  curchunk->has_hash = false;
   BLI_addtail(&memfile->chunks, curchunk);
 
   /* we compare compchunk with buf */
@@ -151,6 +206,31 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
         compchunk->is_identical_future = true;
       }
     }
+    if (curchunk->buf == nullptr) {
+      /* Try to re-synchronize with the previous step, in case data was inserted or removed, so
+       * that the following chunks can be shared again. The matching chunk itself is still copied,
+       * so that the ID is not considered unchanged when only data was removed from it.
+       *
+       * After an insertion, the reference chunks expected at the position of the inserted data
+       * were skipped, so the search starts from the first skipped chunk of the same ID. */
+      MemFileChunk *unmatched = mem_data->reference_unmatched_chunk;
+      if (unmatched != nullptr && unmatched->id_session_uid != curchunk->id_session_uid) {
+        unmatched = nullptr;
+      }
+      MemFileChunk *first_chunk = unmatched ? unmatched :
+                                              static_cast<MemFileChunk *>(compchunk->next);
+      if (MemFileChunk *match = memfile_chunk_find_ahead(first_chunk, curchunk, buf)) {
+        compchunk = match;
+        unmatched = nullptr;
+      }
+      else if (unmatched == nullptr) {
+        unmatched = compchunk;
+      }
+      mem_data->reference_unmatched_chunk = unmatched;
+    }
+    else {
+      mem_data->reference_unmatched_chunk = nullptr;
+    }
     *compchunk_step = static_cast<MemFileChunk *>(compchunk->next);
   }
 
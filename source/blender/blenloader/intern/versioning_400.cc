@@ -503,9 +503,7 @@ static void versioning_remove_microfacet_sharp_distribution(bNodeTree *ntree)
 
 static void version_mesh_crease_generic(Main &bmain)
 {
-  LISTBASE_FOREACH (Mesh *, mesh, &bmain.meshes) {
-    BKE_mesh_legacy_crease_to_generic(mesh);
-  }
+  version_meshes_parallel(&bmain, [](Mesh &mesh) { BKE_mesh_legacy_crease_to_generic(&mesh); });
 
   LISTBASE_FOREACH (bNodeTree *, ntree, &bmain.nodetrees) {
     if (ntree->type == NTREE_GEOMETRY) {
@@ -1182,16 +1180,13 @@ static void enable_geometry_nodes_is_modifier(Main &bmain)
 void blo_do_versions_400(FileData *fd, Library * /*lib*/, Main *bmain)
 {
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 400, 1)) {
-    LISTBASE_FOREACH (Mesh *, mesh, &bmain->meshes) {
-      version_mesh_legacy_to_struct_of_array_format(*mesh);
-    }
+    version_meshes_parallel(bmain, version_mesh_legacy_to_struct_of_array_format);
     version_movieclips_legacy_camera_object(bmain);
   }
 
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 400, 2)) {
-    LISTBASE_FOREACH (Mesh *, mesh, &bmain->meshes) {
-      BKE_mesh_legacy_bevel_weight_to_generic(mesh);
-    }
+    version_meshes_parallel(bmain,
+                            [](Mesh &mesh) { BKE_mesh_legacy_bevel_weight_to_generic(&mesh); });
   }
 
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 400, 5)) {
@@ -1028,11 +1028,11 @@ void blo_do_versions_500(FileData * /*fd*/, Library * /*lib*/, Main *bmain)
 {
   using namespace blender;
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 500, 1)) {
-    LISTBASE_FOREACH (Mesh *, mesh, &bmain->meshes) {
-      bke::mesh_sculpt_mask_to_generic(*mesh);
-      bke::mesh_custom_normals_to_generic(*mesh);
-      rename_mesh_uv_seam_attribute(*mesh);
-    }
+    version_meshes_parallel(bmain, [](Mesh &mesh) {
+      bke::mesh_sculpt_mask_to_generic(mesh);
+      bke::mesh_custom_normals_to_generic(mesh);
+      rename_mesh_uv_seam_attribute(mesh);
+    });
   }
 
   if (!MAIN_VERSION_FILE_ATLEAST(bmain, 500, 2)) {
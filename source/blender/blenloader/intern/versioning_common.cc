@@ -19,6 +19,8 @@
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_animsys.h"
 #include "BKE_grease_pencil_legacy_convert.hh"
@@ -658,6 +660,22 @@ bool all_scenes_use(Main *bmain, const blender::Span<const char *> engines)
   return true;
 }
 
+void version_meshes_parallel(Main *bmain, FunctionRef<void(Mesh &mesh)> fn)
+{
+  using namespace blender;
+  Vector<Mesh *> meshes;
+  LISTBASE_FOREACH (Mesh *, mesh, &bmain->meshes) {
+    meshes.append(mesh);
+  }
+  /* Meshes of old files are converted one by one, a grain size of one balances large and small
+   * meshes best. */
+  threading::parallel_for(meshes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      fn(*meshes[i]);
+    }
+  });
+}
+
 static bool blendfile_or_libraries_versions_atleast(Main *bmain,
                                                     const short versionfile,
                                                     const short subversionfile)
@@ -27,6 +27,7 @@ struct ID;
 struct IDProperty;
 struct ListBase;
 struct Main;
+struct Mesh;
 struct ViewLayer;
 struct SceneRenderLayer;
 
@@ -213,6 +214,12 @@ void version_system_idprops_generate(Main *bmain);
 
 bool all_scenes_use(Main *bmain, const blender::Span<const char *> engines);
 
+/**
+ * Call \a fn for all meshes of \a bmain in parallel. Only meant for versioning code which reads
+ * and modifies nothing but the given mesh, like conversions of its legacy data layers.
+ */
+void version_meshes_parallel(Main *bmain, FunctionRef<void(Mesh &mesh)> fn);
+
 /**
  * Adjust the values of the given FCurve key frames by applying the given function. The function is
  * expected to get and return a float representing the value of the key frame. The FCurve is
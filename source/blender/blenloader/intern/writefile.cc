@@ -67,6 +67,9 @@
 #include <fcntl.h>
 #include <iomanip>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
 
 #ifdef WIN32
 #  include "BLI_winstuff.h"
@@ -77,6 +80,7 @@
 #endif
 
 #include <fmt/format.h>
+#include <xxhash.h>
 
 #include "BLI_utildefines.h"
 
@@ -92,6 +96,7 @@
 #include "DNA_sdna_types.h"
 #include "DNA_userdef_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_endian_defines.h"
 #include "BLI_fileops.hh"
 #include "BLI_implicit_sharing.hh"
@@ -101,6 +106,7 @@
 #include "BLI_set.hh"
 #include "BLI_string.h"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "MEM_guardedalloc.h" /* MEM_freeN */
 
@@ -156,6 +162,15 @@
 
 #define ZSTD_COMPRESSION_LEVEL 3
 
+/**
+ * When re-using compressed frames, the buffer is flushed at the end of an ID once it holds at
+ * least this much data, so that frame boundaries follow IDs and a change in one ID does not
+ * shift the content of all following frames.
+ */
+#define ZSTD_FRAME_CACHE_ID_FLUSH_SIZE (1 << 18) /* 256kb */
+/** Maximum total size of compressed frames kept for re-use by the next write. */
+#define ZSTD_FRAME_CACHE_MAX_SIZE (size_t(1) << 28) /* 256mb */
+
 static CLG_LogRef LOG = {"blo.writefile"};
 
 /** Use if we want to store how many bytes have been written to the file. */
@@ -180,8 +195,57 @@ class WriteWrap {
 
   /** Buffer output (we only want when output isn't already buffered). */
   bool use_buf = true;
+  /** Flush the buffer at the end of IDs, see #ZSTD_FRAME_CACHE_ID_FLUSH_SIZE. */
+  bool use_id_aligned_flush = false;
+
+  /** Replace `filepath` by the written temporary file `tempname`. */
+  virtual bool move_into_place(const char *tempname, const char *filepath)
+  {
+    return BLI_rename_overwrite(tempname, filepath) == 0;
+  }
 };
 
+/**
+ * Compressed frames of the previous write using the cache, identified by a hash of their
+ * uncompressed content. Frames with the same content in the next write are copied instead of
+ * compressed again, which makes repeated writes of mostly unchanged data (auto-save) faster.
+ */
+struct ZstdFrameCache {
+  struct Key {
+    uint64_t hash_low;
+    uint64_t hash_high;
+    size_t size;
+
+    struct Hash {
+      size_t operator()(const Key &key) const
+      {
+        return size_t(key.hash_low);
+      }
+    };
+    friend bool operator==(const Key &a, const Key &b)
+    {
+      return a.hash_low == b.hash_low && a.hash_high == b.hash_high && a.size == b.size;
+    }
+  };
+
+  static Key key_from_data(const void *data, const size_t size)
+  {
+    const XXH128_hash_t hash = XXH3_128bits(data, size);
+    return {hash.low64, hash.high64, size};
+  }
+
+  /* Not using guarded allocations, since the cache is kept until exit. */
+  std::unordered_map<Key, std::string, Key::Hash> frames;
+  size_t total_size = 0;
+};
+
+/** Cache shared by all writes that request it, see #BlendFileWriteParams.use_frame_cache. */
+static ZstdFrameCache &zstd_frame_cache()
+{
+  static ZstdFrameCache cache;
+  return cache;
+}
+
 class RawWriteWrap : public WriteWrap {
  public:
   bool open(const char *filepath) override;
@@ -214,6 +278,77 @@ bool RawWriteWrap::write(const void *buf, size_t buf_len)
   return ::write(file_handle, buf, buf_len) == buf_len;
 }
 
+/**
+ * Keeps all written data in memory, the file itself is written and moved into place by a
+ * background thread, so that slow storage does not block the caller.
+ * Only one background write runs at a time, see #BLO_write_file_background_wait.
+ */
+class BackgroundWriteWrap : public WriteWrap {
+ public:
+  bool open(const char * /*filepath*/) override
+  {
+    return true;
+  }
+  bool close() override
+  {
+    return true;
+  }
+  bool write(const void *buf, size_t buf_len) override;
+  bool move_into_place(const char *tempname, const char *filepath) override;
+
+ private:
+  blender::Vector<blender::Array<char, 0>> chunks;
+};
+
+static std::thread &background_write_thread()
+{
+  static std::thread thread;
+  return thread;
+}
+
+bool BackgroundWriteWrap::write(const void *buf, size_t buf_len)
+{
+  chunks.append(blender::Array<char, 0>(
+      blender::Span<char>(static_cast<const char *>(buf), int64_t(buf_len))));
+  return true;
+}
+
+bool BackgroundWriteWrap::move_into_place(const char *tempname, const char *filepath)
+{
+  BLO_write_file_background_wait();
+
+  background_write_thread() = std::thread([chunks = std::move(chunks),
+                                           tempname = std::string(tempname),
+                                           filepath = std::string(filepath)]() {
+    RawWriteWrap raw_wrap;
+    if (!raw_wrap.open(tempname.c_str())) {
+      CLOG_ERROR(
+          &LOG, "Cannot open file %s for writing: %s", tempname.c_str(), strerror(errno));
+      return;
+    }
+    /* Closing the file may change `errno`, keep the one of the failed write. */
+    int write_errno = 0;
+    for (const blender::Array<char, 0> &chunk : chunks) {
+      if (!raw_wrap.write(chunk.data(), size_t(chunk.size()))) {
+        write_errno = errno ? errno : EIO;
+        break;
+      }
+    }
+    if (!raw_wrap.close() && write_errno == 0) {
+      write_errno = errno ? errno : EIO;
+    }
+    if (write_errno != 0) {
+      CLOG_ERROR(&LOG, "Cannot write file %s: %s", tempname.c_str(), strerror(write_errno));
+      remove(tempname.c_str());
+      return;
+    }
+    if (!raw_wrap.move_into_place(tempname.c_str(), filepath.c_str())) {
+      CLOG_ERROR(&LOG, "Cannot change old file %s (file saved with @)", filepath.c_str());
+    }
+  });
+  return true;
+}
+
 class ZstdWriteWrap : public WriteWrap {
   WriteWrap &base_wrap;
 
@@ -226,14 +361,27 @@ class ZstdWriteWrap : public WriteWrap {
 
   ListBase frames = {};
 
+  /** Frames of the previous write, read-only while writing. */
+  ZstdFrameCache *frame_cache = nullptr;
+  /** Frames of the current write, replacing #frame_cache on close. */
+  ZstdFrameCache new_frame_cache;
+
   bool write_error = false;
 
  public:
-  ZstdWriteWrap(WriteWrap &base_wrap) : base_wrap(base_wrap) {}
+  ZstdWriteWrap(WriteWrap &base_wrap, ZstdFrameCache *frame_cache = nullptr)
+      : base_wrap(base_wrap), frame_cache(frame_cache)
+  {
+    use_id_aligned_flush = (frame_cache != nullptr);
+  }
 
   bool open(const char *filepath) override;
   bool close() override;
   bool write(const void *buf, size_t buf_len) override;
+  bool move_into_place(const char *tempname, const char *filepath) override
+  {
+    return base_wrap.move_into_place(tempname, filepath);
+  }
 
  private:
   struct ZstdWriteBlockTask;
@@ -259,10 +407,30 @@ struct ZstdWriteWrap::ZstdWriteBlockTask {
 
 void ZstdWriteWrap::write_task(ZstdWriteBlockTask *task)
 {
-  size_t out_buf_len = ZSTD_compressBound(task->size);
-  void *out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
-  size_t out_size = ZSTD_compress(
-      out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
+  ZstdFrameCache::Key cache_key = {};
+  const std::string *cached_frame = nullptr;
+  if (frame_cache) {
+    cache_key = ZstdFrameCache::key_from_data(task->data, task->size);
+    const auto it = frame_cache->frames.find(cache_key);
+    if (it != frame_cache->frames.end()) {
+      cached_frame = &it->second;
+    }
+  }
+
+  size_t out_buf_len = 0;
+  void *out_buf = nullptr;
+  size_t out_size;
+  const void *out_data;
+  if (cached_frame) {
+    out_data = cached_frame->data();
+    out_size = cached_frame->size();
+  }
+  else {
+    out_buf_len = ZSTD_compressBound(task->size);
+    out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
+    out_size = ZSTD_compress(out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
+    out_data = out_buf;
+  }
 
   MEM_freeN(task->data);
 
@@ -276,7 +444,16 @@ void ZstdWriteWrap::write_task(ZstdWriteBlockTask *task)
     write_error = true;
   }
   else {
-    if (base_wrap.write(out_buf, out_size)) {
+    if (frame_cache && new_frame_cache.total_size + out_size <= ZSTD_FRAME_CACHE_MAX_SIZE) {
+      if (new_frame_cache.frames
+              .try_emplace(cache_key, static_cast<const char *>(out_data), out_size)
+              .second)
+      {
+        new_frame_cache.total_size += out_size;
+      }
+    }
+
+    if (base_wrap.write(out_data, out_size)) {
       ZstdFrame *frameinfo = MEM_mallocN<ZstdFrame>("zstd frameinfo");
       frameinfo->uncompressed_size = task->size;
       frameinfo->compressed_size = out_size;
@@ -292,7 +469,9 @@ void ZstdWriteWrap::write_task(ZstdWriteBlockTask *task)
   BLI_mutex_unlock(&mutex);
   BLI_condition_notify_all(&condition);
 
-  MEM_freeN(out_buf);
+  if (out_buf) {
+    MEM_freeN(out_buf);
+  }
 }
 
 bool ZstdWriteWrap::open(const char *filepath)
@@ -362,6 +541,12 @@ bool ZstdWriteWrap::close()
   write_seekable_frames();
   BLI_freelistN(&frames);
 
+  if (frame_cache) {
+    /* Only keep the frames of this write, frames which were not re-used are unlikely to be
+     * needed again. */
+    *frame_cache = std::move(new_frame_cache);
+  }
+
   return base_wrap.close() && !write_error;
 }
 
@@ -689,6 +874,11 @@ static void mywrite_id_end(WriteData *wd, ID * /*id*/)
     mywrite_flush(wd);
     wd->mem.current_id_session_uid = MAIN_ID_SESSION_UID_UNSET;
   }
+  else if (wd->ww->use_id_aligned_flush &&
+           wd->buffer.used_len >= ZSTD_FRAME_CACHE_ID_FLUSH_SIZE)
+  {
+    mywrite_flush(wd);
+  }
 
   wd->validation_data.per_id_addresses_set.clear();
   wd->per_id_written_shared_addresses.clear();
@@ -1835,7 +2025,7 @@ static bool BLO_write_file_impl(Main *mainvar,
     }
   }
 
-  if (BLI_rename_overwrite(tempname, filepath) != 0) {
+  if (!ww.move_into_place(tempname, filepath)) {
     BKE_report(reports, RPT_ERROR, "Cannot change old file (file saved with @)");
     return false;
   }
@@ -1861,13 +2051,31 @@ bool BLO_write_file(Main *mainvar,
                     ReportList *reports)
 {
   RawWriteWrap raw_wrap;
+  BackgroundWriteWrap background_wrap;
+  /* History of file versions is handled before the new file is moved into place, which could
+   * happen while the background write is still running. Write on the calling thread then. */
+  const bool use_background_write = params->use_background_write && !params->use_save_versions;
+  if (params->use_background_write && !use_background_write) {
+    CLOG_WARN(&LOG, "Saving file versions is not supported by background writes, writing %s now",
+              filepath);
+  }
+  WriteWrap &base_wrap = use_background_write ? static_cast<WriteWrap &>(background_wrap) :
+                                                static_cast<WriteWrap &>(raw_wrap);
 
   if (write_flags & G_FILE_COMPRESS) {
-    ZstdWriteWrap zstd_wrap(raw_wrap);
+    ZstdWriteWrap zstd_wrap(base_wrap, params->use_frame_cache ? &zstd_frame_cache() : nullptr);
     return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, zstd_wrap);
   }
 
-  return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, raw_wrap);
+  return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, base_wrap);
+}
+
+void BLO_write_file_background_wait()
+{
+  std::thread &thread = background_write_thread();
+  if (thread.joinable()) {
+    thread.join();
+  }
 }
 
 bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, const int write_flags)
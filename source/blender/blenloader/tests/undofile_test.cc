@@ -0,0 +1,80 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "BLI_span.hh"
+#include "BLI_string_ref.hh"
+#include "BLI_vector.hh"
+
+#include "BLO_undofile.hh"
+
+namespace blender::blenloader::tests {
+
+static constexpr uint test_id_session_uid = 1;
+
+/** Write one chunk per string, all belonging to the same ID. */
+static void write_memfile(MemFile &written, MemFile *reference, const Span<StringRef> chunks)
+{
+  MemFileWriteData mem_data;
+  BLO_memfile_write_init(&mem_data, &written, reference);
+  mem_data.current_id_session_uid = test_id_session_uid;
+  for (const StringRef chunk : chunks) {
+    BLO_memfile_chunk_add(&mem_data, chunk.data(), size_t(chunk.size()));
+  }
+  BLO_memfile_write_finalize(&mem_data);
+}
+
+static Vector<bool> chunks_identical(const MemFile &memfile)
+{
+  Vector<bool> result;
+  LISTBASE_FOREACH (const MemFileChunk *, chunk, &memfile.chunks) {
+    result.append(chunk->is_identical);
+  }
+  return result;
+}
+
+TEST(undofile, ChunkResyncAfterInsertion)
+{
+  MemFile reference = {};
+  write_memfile(reference, nullptr, {"chunk_a", "chunk_b", "chunk_c", "chunk_d"});
+
+  MemFile written = {};
+  write_memfile(written, &reference, {"chunk_a", "chunk_x", "chunk_b", "chunk_c", "chunk_d"});
+  /* The chunk that was inserted is new, the chunk after it is copied when re-synchronizing, and
+   * the remaining chunks are shared again. */
+  EXPECT_EQ(chunks_identical(written), Vector<bool>({true, false, false, true, true}));
+
+  BLO_memfile_free(&written);
+  BLO_memfile_free(&reference);
+}
+
+TEST(undofile, ChunkResyncAfterRemoval)
+{
+  MemFile reference = {};
+  write_memfile(reference, nullptr, {"chunk_a", "chunk_b", "chunk_c", "chunk_d"});
+
+  MemFile written = {};
+  write_memfile(written, &reference, {"chunk_a", "chunk_c", "chunk_d"});
+  /* The ID must not be considered unchanged, so the chunk after the removed one is copied. */
+  EXPECT_EQ(chunks_identical(written), Vector<bool>({true, false, true}));
+
+  BLO_memfile_free(&written);
+  BLO_memfile_free(&reference);
+}
+
+TEST(undofile, ChunkModifiedInPlace)
+{
+  MemFile reference = {};
+  write_memfile(reference, nullptr, {"chunk_a", "chunk_b", "chunk_c", "chunk_d"});
+
+  MemFile written = {};
+  write_memfile(written, &reference, {"chunk_a", "chunk_x", "chunk_c", "chunk_d"});
+  EXPECT_EQ(chunks_identical(written), Vector<bool>({true, false, true, true}));
+
+  BLO_memfile_free(&written);
+  BLO_memfile_free(&reference);
+}
+
+}  // namespace blender::blenloader::tests
@@ -191,12 +191,14 @@ static Vector<MeshToBMeshLayerInfo> mesh_to_bm_copy_info_calc(const CustomData &
   return infos;
 }
 
-static void mesh_attributes_copy_to_bmesh_block(CustomData &data,
-                                                const Span<MeshToBMeshLayerInfo> copy_info,
+/**
+ * Copy attribute values into an element's custom data block, which must already be allocated.
+ * Doesn't access the BMesh's memory pools, so it can be called for different elements in parallel.
+ */
+static void mesh_attributes_copy_to_bmesh_block(const Span<MeshToBMeshLayerInfo> copy_info,
                                                 const int mesh_index,
                                                 BMHeader &header)
 {
-  CustomData_bmesh_alloc_block(&data, &header.data);
   for (const MeshToBMeshLayerInfo &info : copy_info) {
     if (info.mesh_data) {
       CustomData_data_copy_value(info.type,
@@ -450,25 +452,34 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *mesh, const BMeshFromMeshParams *
       copy_v3_v3(v->no, vert_normals[i]);
     }
 
-    mesh_attributes_copy_to_bmesh_block(bm->vdata, vert_info, i, v->head);
-
-    /* Set shape key original index. */
-    if (cd_shape_keyindex_offset != -1) {
-      BM_ELEM_CD_SET_INT(v, cd_shape_keyindex_offset, i);
-    }
-
-    /* Set shape-key data. */
-    if (tot_shape_keys) {
-      float(*co_dst)[3] = (float(*)[3])BM_ELEM_CD_GET_VOID_P(v, cd_shape_key_offset);
-      for (int j = 0; j < tot_shape_keys; j++, co_dst++) {
-        copy_v3_v3(*co_dst, shape_key_table[j][i]);
-      }
-    }
+    CustomData_bmesh_alloc_block(&bm->vdata, &v->head.data);
   }
   if (is_new) {
     bm->elem_index_dirty &= ~BM_VERT; /* Added in order, clear dirty flag. */
   }
 
+  /* Element and custom data block allocation above has to be single threaded because of the
+   * memory pools, but filling in the attribute values can be done in parallel. */
+  threading::parallel_for(vtable.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      BMVert *v = vtable[i];
+      mesh_attributes_copy_to_bmesh_block(vert_info, i, v->head);
+
+      /* Set shape key original index. */
+      if (cd_shape_keyindex_offset != -1) {
+        BM_ELEM_CD_SET_INT(v, cd_shape_keyindex_offset, i);
+      }
+
+      /* Set shape-key data. */
+      if (tot_shape_keys) {
+        float(*co_dst)[3] = (float(*)[3])BM_ELEM_CD_GET_VOID_P(v, cd_shape_key_offset);
+        for (int j = 0; j < tot_shape_keys; j++, co_dst++) {
+          copy_v3_v3(*co_dst, shape_key_table[j][i]);
+        }
+      }
+    }
+  });
+
   const Span<blender::int2> edges = mesh->edges();
   Array<BMEdge *> etable(mesh->edges_num);
   for (const int i : edges.index_range()) {
@@ -490,31 +501,31 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *mesh, const BMeshFromMeshParams *
       BM_elem_flag_enable(e, BM_ELEM_SMOOTH);
     }
 
-    mesh_attributes_copy_to_bmesh_block(bm->edata, edge_info, i, e->head);
+    CustomData_bmesh_alloc_block(&bm->edata, &e->head.data);
   }
   if (is_new) {
     bm->elem_index_dirty &= ~BM_EDGE; /* Added in order, clear dirty flag. */
   }
 
+  threading::parallel_for(etable.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      mesh_attributes_copy_to_bmesh_block(edge_info, i, etable[i]->head);
+    }
+  });
+
   const blender::OffsetIndices faces = mesh->faces();
   const Span<int> corner_verts = mesh->corner_verts();
   const Span<int> corner_edges = mesh->corner_edges();
 
-  /* Only needed for selection. */
-
-  Array<BMFace *> ftable;
-  if (mesh->mselect && mesh->totselect != 0) {
-    ftable.reinitialize(mesh->faces_num);
-  }
+  /* Faces which couldn't be created are null. */
+  Array<BMFace *> ftable(mesh->faces_num);
 
   int totloops = 0;
   for (const int i : faces.index_range()) {
     const IndexRange face = faces[i];
     BMFace *f = bm_face_create_from_mpoly(
         *bm, corner_verts.slice(face), corner_edges.slice(face), vtable, etable);
-    if (!ftable.is_empty()) {
-      ftable[i] = f;
-    }
+    ftable[i] = f;
 
     if (UNLIKELY(f == nullptr)) {
       printf(
@@ -545,27 +556,43 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *mesh, const BMeshFromMeshParams *
       bm->act_face = f;
     }
 
-    int j = face.start();
     BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
     BMLoop *l_iter = l_first;
     do {
-      /* Don't use 'j' since we may have skipped some faces, hence some loops. */
+      /* Don't use the mesh corner index since we may have skipped some faces, hence some loops. */
       BM_elem_index_set(l_iter, totloops++); /* set_ok */
 
-      mesh_attributes_copy_to_bmesh_block(bm->ldata, loop_info, j, l_iter->head);
-      j++;
+      CustomData_bmesh_alloc_block(&bm->ldata, &l_iter->head.data);
     } while ((l_iter = l_iter->next) != l_first);
 
-    mesh_attributes_copy_to_bmesh_block(bm->pdata, poly_info, i, f->head);
-
-    if (params->calc_face_normal) {
-      BM_face_normal_update(f);
-    }
+    CustomData_bmesh_alloc_block(&bm->pdata, &f->head.data);
   }
   if (is_new) {
     bm->elem_index_dirty &= ~(BM_FACE | BM_LOOP); /* Added in order, clear dirty flag. */
   }
 
+  threading::parallel_for(ftable.index_range(), 512, [&](const IndexRange range) {
+    for (const int i : range) {
+      BMFace *f = ftable[i];
+      if (f == nullptr) {
+        continue;
+      }
+      int j = faces[i].start();
+      BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
+      BMLoop *l_iter = l_first;
+      do {
+        mesh_attributes_copy_to_bmesh_block(loop_info, j, l_iter->head);
+        j++;
+      } while ((l_iter = l_iter->next) != l_first);
+
+      mesh_attributes_copy_to_bmesh_block(poly_info, i, f->head);
+
+      if (params->calc_face_normal) {
+        BM_face_normal_update(f);
+      }
+    }
+  });
+
   /* -------------------------------------------------------------------- */
   /* MSelect clears the array elements (to avoid adding multiple times).
    *
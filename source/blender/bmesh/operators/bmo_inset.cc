@@ -16,6 +16,8 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
+#include "BLI_offset_indices.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines_stack.h"
 
 #include "DNA_modifier_enums.h"
@@ -256,27 +258,96 @@ static void bm_loop_customdata_merge(BMesh *bm,
  * Each face has a smaller face created inside it (simple logic).
  * \{ */
 
+/**
+ * Calculate the inset positions of the face corners (aligned with face loops).
+ *
+ * This only reads the geometry of the face itself, which isn't changed by insetting other faces,
+ * so it can be done for all faces in parallel before any of them is modified.
+ */
+static void bmo_face_inset_individual_coords_calc(const BMFace *f,
+                                                  const float thickness,
+                                                  const float depth,
+                                                  const bool use_even_offset,
+                                                  const bool use_relative_offset,
+                                                  float (*r_coords)[3])
+{
+  /* store edge normals (aligned with face-loop-edges) */
+  float(*edge_nors)[3] = BLI_array_alloca(edge_nors, f->len);
+
+  BMLoop *l_iter, *l_first;
+  uint i;
+  float e_length_prev;
+
+  l_first = BM_FACE_FIRST_LOOP(f);
+
+  l_iter = l_first;
+  i = 0;
+  do {
+    BM_edge_calc_face_tangent(l_iter->e, l_iter, edge_nors[i]);
+  } while ((void)i++, ((l_iter = l_iter->next) != l_first));
+
+  /* Calculate translation vector for new */
+  l_iter = l_first;
+  i = 0;
+
+  if (depth != 0.0f) {
+    e_length_prev = BM_edge_calc_length(l_iter->prev->e);
+  }
+
+  do {
+    const float *eno_prev = edge_nors[(i ? i : f->len) - 1];
+    const float *eno_next = edge_nors[i];
+    float tvec[3];
+    float v_new_co[3];
+
+    add_v3_v3v3(tvec, eno_prev, eno_next);
+    normalize_v3(tvec);
+
+    copy_v3_v3(v_new_co, l_iter->v->co);
+
+    if (use_even_offset) {
+      mul_v3_fl(tvec, shell_v3v3_mid_normalized_to_dist(eno_prev, eno_next));
+    }
+
+    /* Modify vertices and their normals */
+    if (use_relative_offset) {
+      mul_v3_fl(tvec,
+                (BM_edge_calc_length(l_iter->e) + BM_edge_calc_length(l_iter->prev->e)) / 2.0f);
+    }
+
+    madd_v3_v3fl(v_new_co, tvec, thickness);
+
+    /* Add depth. */
+    if (depth != 0.0f) {
+      const float e_length = BM_edge_calc_length(l_iter->e);
+      const float fac = depth * (use_relative_offset ? ((e_length_prev + e_length) * 0.5f) : 1.0f);
+      e_length_prev = e_length;
+
+      madd_v3_v3fl(v_new_co, f->no, fac);
+    }
+
+    copy_v3_v3(r_coords[i], v_new_co);
+  } while ((void)i++, ((l_iter = l_iter->next) != l_first));
+}
+
+/**
+ * \param coords: The new positions of the face corners,
+ * from #bmo_face_inset_individual_coords_calc.
+ */
 static void bmo_face_inset_individual(BMesh *bm,
                                       BMFace *f,
                                       MemArena *interp_arena,
-                                      const float thickness,
-                                      const float depth,
-                                      const bool use_even_offset,
-                                      const bool use_relative_offset,
+                                      const float (*coords)[3],
                                       const bool use_interpolate)
 {
   InterpFace *iface = nullptr;
 
   /* stores verts split away from the face (aligned with face verts) */
   BMVert **verts = BLI_array_alloca(verts, f->len);
-  /* store edge normals (aligned with face-loop-edges) */
-  float(*edge_nors)[3] = BLI_array_alloca(edge_nors, f->len);
-  float(*coords)[3] = BLI_array_alloca(coords, f->len);
 
   BMLoop *l_iter, *l_first;
   BMLoop *l_other;
   uint i;
-  float e_length_prev;
 
   l_first = BM_FACE_FIRST_LOOP(f);
 
@@ -290,9 +361,6 @@ static void bmo_face_inset_individual(BMesh *bm,
       v_other = BM_vert_create(bm, l_iter->v->co, l_iter->v, BM_CREATE_NOP);
     }
     verts[i] = v_other;
-
-    /* unrelated to splitting, but calc here */
-    BM_edge_calc_face_tangent(l_iter->e, l_iter, edge_nors[i]);
   } while ((void)i++, ((l_iter = l_iter->next) != l_first));
 
   /* build rim faces */
@@ -327,55 +395,11 @@ static void bmo_face_inset_individual(BMesh *bm,
     bm_interp_face_store(iface, bm, f, interp_arena);
   }
 
-  /* Calculate translation vector for new */
+  /* Set normals and update the coords. */
   l_iter = l_first;
   i = 0;
-
-  if (depth != 0.0f) {
-    e_length_prev = BM_edge_calc_length(l_iter->prev->e);
-  }
-
   do {
-    const float *eno_prev = edge_nors[(i ? i : f->len) - 1];
-    const float *eno_next = edge_nors[i];
-    float tvec[3];
-    float v_new_co[3];
-
-    add_v3_v3v3(tvec, eno_prev, eno_next);
-    normalize_v3(tvec);
-
-    copy_v3_v3(v_new_co, l_iter->v->co);
-
-    if (use_even_offset) {
-      mul_v3_fl(tvec, shell_v3v3_mid_normalized_to_dist(eno_prev, eno_next));
-    }
-
-    /* Modify vertices and their normals */
-    if (use_relative_offset) {
-      mul_v3_fl(tvec,
-                (BM_edge_calc_length(l_iter->e) + BM_edge_calc_length(l_iter->prev->e)) / 2.0f);
-    }
-
-    madd_v3_v3fl(v_new_co, tvec, thickness);
-
-    /* Set normal, add depth and write new vertex position. */
     copy_v3_v3(l_iter->v->no, f->no);
-
-    if (depth != 0.0f) {
-      const float e_length = BM_edge_calc_length(l_iter->e);
-      const float fac = depth * (use_relative_offset ? ((e_length_prev + e_length) * 0.5f) : 1.0f);
-      e_length_prev = e_length;
-
-      madd_v3_v3fl(v_new_co, f->no, fac);
-    }
-
-    copy_v3_v3(coords[i], v_new_co);
-  } while ((void)i++, ((l_iter = l_iter->next) != l_first));
-
-  /* update the coords */
-  l_iter = l_first;
-  i = 0;
-  do {
     copy_v3_v3(l_iter->v->co, coords[i]);
   } while ((void)i++, ((l_iter = l_iter->next) != l_first));
 
@@ -411,9 +435,7 @@ static void bmo_face_inset_individual(BMesh *bm,
  */
 void bmo_inset_individual_exec(BMesh *bm, BMOperator *op)
 {
-  BMFace *f;
-
-  BMOIter oiter;
+  using namespace blender;
   MemArena *interp_arena = nullptr;
 
   const float thickness = BMO_slot_float_get(op->slots_in, "thickness");
@@ -431,15 +453,38 @@ void bmo_inset_individual_exec(BMesh *bm, BMOperator *op)
     interp_arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
   }
 
-  BMO_ITER (f, &oiter, op->slots_in, "faces", BM_FACE) {
-    bmo_face_inset_individual(bm,
-                              f,
-                              interp_arena,
-                              thickness,
-                              depth,
-                              use_even_offset,
-                              use_relative_offset,
-                              use_interpolate);
+  BMOpSlot *slot_faces = BMO_slot_get(op->slots_in, "faces");
+  const Span<BMFace *> faces(reinterpret_cast<BMFace **>(slot_faces->data.buf), slot_faces->len);
+
+  Array<int> face_offset_data(faces.size() + 1);
+  for (const int i : faces.index_range()) {
+    face_offset_data[i] = faces[i]->len;
+  }
+  const OffsetIndices face_offsets = offset_indices::accumulate_counts_to_offsets(
+      face_offset_data);
+
+  /* Insetting a face never moves the vertices of other faces, so the new positions can be
+   * calculated in parallel up front, leaving only the topology changes single threaded. */
+  Array<float3> coords(face_offsets.total_size());
+  threading::parallel_for(faces.index_range(), 256, [&](const IndexRange range) {
+    for (const int i : range) {
+      bmo_face_inset_individual_coords_calc(
+          faces[i],
+          thickness,
+          depth,
+          use_even_offset,
+          use_relative_offset,
+          reinterpret_cast<float(*)[3]>(coords.as_mutable_span().slice(face_offsets[i]).data()));
+    }
+  });
+
+  for (const int i : faces.index_range()) {
+    bmo_face_inset_individual(
+        bm,
+        faces[i],
+        interp_arena,
+        reinterpret_cast<const float(*)[3]>(coords.as_span().slice(face_offsets[i]).data()),
+        use_interpolate);
 
     if (use_interpolate) {
       BLI_memarena_clear(interp_arena);
@@ -79,10 +79,13 @@ DOutputSocket find_preview_output_socket(const DNode &node);
  */
 
 /* Executes the given function in parallel over the given 2D range. The given function gets the
- * texel coordinates of the element of the range as an argument. */
+ * texel coordinates of the element of the range as an argument. Rows are grouped such that each
+ * task processes at least a thousand or so texels, which avoids the scheduling overhead of one
+ * task per row for narrow ranges. */
 template<typename Function> inline void parallel_for(const int2 range, const Function &function)
 {
-  threading::parallel_for(IndexRange(range.y), 1, [&](const IndexRange sub_y_range) {
+  const int64_t grain_size = std::max<int64_t>(1, 1024 / std::max(range.x, 1));
+  threading::parallel_for(IndexRange(range.y), grain_size, [&](const IndexRange sub_y_range) {
     for (const int64_t y : sub_y_range) {
       for (const int64_t x : IndexRange(range.x)) {
         function(int2(x, y));
@@ -2,6 +2,7 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <algorithm>
 #include <complex>
 #include <cstdint>
 #include <memory>
@@ -17,6 +18,7 @@
 #include "BLI_math_base.h"
 #include "BLI_math_base.hh"
 #include "BLI_math_numbers.hh"
+#include "BLI_math_vector.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_task.hh"
 
@@ -91,11 +93,20 @@ FogGlowKernel::FogGlowKernel(int kernel_size, int2 spatial_size)
   /* Use a double to sum the kernel since floats are not stable with threaded summation. */
   threading::EnumerableThreadSpecific<double> sum_by_thread([]() { return 0.0; });
 
-  /* Compute the kernel while zero padding to match the padded image size. */
+  /* Zero pad the kernel to match the padded image size. */
   threading::parallel_for(IndexRange(spatial_size.y), 1, [&](const IndexRange sub_y_range) {
+    for (const int64_t y : sub_y_range) {
+      std::fill_n(kernel_spatial_domain + y * spatial_size.x, spatial_size.x, 0.0f);
+    }
+  });
+
+  /* Compute the kernel, only a small corner of the padded domain is non zero, so only go over
+   * that region. */
+  const int2 kernel_region = math::min(int2(kernel_size), spatial_size);
+  threading::parallel_for(IndexRange(kernel_region.y), 1, [&](const IndexRange sub_y_range) {
     double &sum = sum_by_thread.local();
     for (const int64_t y : sub_y_range) {
-      for (const int64_t x : IndexRange(spatial_size.x)) {
+      for (const int64_t x : IndexRange(kernel_region.x)) {
         /* We offset the computed kernel with wrap around such that it is centered at the zero
          * point, which is the expected format for doing circular convolutions in the frequency
          * domain. */
@@ -103,15 +114,9 @@ FogGlowKernel::FogGlowKernel(int kernel_size, int2 spatial_size)
         int64_t output_x = mod_i(x - half_kernel_size, spatial_size.x);
         int64_t output_y = mod_i(y - half_kernel_size, spatial_size.y);
 
-        const bool is_inside_kernel = x < kernel_size && y < kernel_size;
-        if (is_inside_kernel) {
-          const float kernel_value = compute_fog_glow_kernel_value(x, y, kernel_size);
-          kernel_spatial_domain[output_x + output_y * spatial_size.x] = kernel_value;
-          sum += kernel_value;
-        }
-        else {
-          kernel_spatial_domain[output_x + output_y * spatial_size.x] = 0.0f;
-        }
+        const float kernel_value = compute_fog_glow_kernel_value(x, y, kernel_size);
+        kernel_spatial_domain[output_x + output_y * spatial_size.x] = kernel_value;
+        sum += kernel_value;
       }
     }
   });
@@ -53,6 +53,13 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/**
+ * Write the operations of the last evaluation as a timeline in the Chrome trace event format,
+ * which can be opened in `chrome://tracing` or Perfetto. Only operations timed while
+ * `--debug-depsgraph-time` was enabled are written.
+ */
+void DEG_debug_stats_chrome_trace(const Depsgraph *graph, FILE *fp);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
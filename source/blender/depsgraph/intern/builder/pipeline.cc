@@ -93,6 +93,8 @@ void AbstractBuilderPipeline::build_step_finalize()
 #endif
   /* Relations are up to date. */
   deg_graph_->need_update_relations = false;
+  /* Use the timings of the next evaluation to order the evaluations after it. */
+  deg_graph_->need_update_critical_path_times = true;
 }
 
 std::unique_ptr<DepsgraphNodeBuilder> AbstractBuilderPipeline::construct_node_builder()
@@ -23,6 +23,12 @@ class DepsgraphDebug {
   void begin_graph_evaluation();
   void end_graph_evaluation();
 
+  /* Time when the last graph evaluation began, only valid when time debug is enabled. */
+  double graph_evaluation_start_time() const
+  {
+    return graph_evaluation_start_time_;
+  }
+
   /* NOTE: Corresponds to G_DEBUG_DEPSGRAPH_* flags. */
   int flags;
 
@@ -0,0 +1,85 @@
+/* SPDX-FileCopyrightText: 2025 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Export of the last evaluation as a timeline in the Chrome trace event format.
+ */
+
+#include "DEG_depsgraph_debug.hh"
+
+#include <algorithm>
+#include <sstream>
+
+#include "BLI_map.hh"
+#include "BLI_serialize.hh"
+#include "BLI_vector.hh"
+
+#include "intern/depsgraph.hh"
+#include "intern/node/deg_node_component.hh"
+#include "intern/node/deg_node_id.hh"
+#include "intern/node/deg_node_operation.hh"
+
+#include "DNA_ID.h"
+
+namespace deg = blender::deg;
+
+namespace blender::deg {
+namespace {
+
+bool operation_start_time_comparator(const OperationNode *a, const OperationNode *b)
+{
+  return a->stats_start_time < b->stats_start_time;
+}
+
+void deg_debug_stats_chrome_trace(const Depsgraph &graph, FILE *fp)
+{
+  /* Operations which were not evaluated by the last update still have the timings of an older
+   * update, which started before the last one. */
+  const double graph_start_time = graph.debug.graph_evaluation_start_time();
+  Vector<const OperationNode *> operations;
+  for (const OperationNode *op_node : graph.operations) {
+    if (op_node->stats_start_time >= graph_start_time && graph_start_time != 0.0) {
+      operations.append(op_node);
+    }
+  }
+  std::sort(operations.begin(), operations.end(), operation_start_time_comparator);
+
+  /* Use small consecutive numbers for threads, in the order they started evaluating. */
+  Map<size_t, int> thread_indices;
+
+  io::serialize::DictionaryValue root;
+  io::serialize::ArrayValue &trace_events = *root.append_array("traceEvents");
+  for (const OperationNode *op_node : operations) {
+    const IDNode *id_node = op_node->owner->owner;
+    const int thread_index = thread_indices.lookup_or_add(op_node->stats_thread_id,
+                                                          thread_indices.size());
+    io::serialize::DictionaryValue &event = *trace_events.append_dict();
+    event.append_str("name", op_node->full_identifier());
+    event.append_str("cat", std::string(id_node->id_orig->name, 2));
+    event.append_str("ph", "X");
+    event.append_double("ts", (op_node->stats_start_time - graph_start_time) * 1e6);
+    event.append_double("dur", double(op_node->eval_time) * 1e6);
+    event.append_int("pid", 0);
+    event.append_int("tid", thread_index);
+  }
+
+  std::stringstream stream;
+  io::serialize::JsonFormatter formatter;
+  formatter.serialize(stream, root);
+  const std::string json = stream.str();
+  fwrite(json.data(), 1, json.size(), fp);
+}
+
+}  // namespace
+}  // namespace blender::deg
+
+void DEG_debug_stats_chrome_trace(const Depsgraph *depsgraph, FILE *fp)
+{
+  if (depsgraph == nullptr) {
+    return;
+  }
+  deg::deg_debug_stats_chrome_trace(*reinterpret_cast<const deg::Depsgraph *>(depsgraph), fp);
+}
@@ -44,6 +44,7 @@ Depsgraph::Depsgraph(Main *bmain, Scene *scene, ViewLayer *view_layer, eEvaluati
       has_animated_visibility(false),
       need_update_relations(true),
       need_update_nodes_visibility(true),
+      need_update_critical_path_times(true),
       need_tag_id_on_graph_visibility_update(true),
       need_tag_id_on_graph_visibility_time_update(false),
       bmain(bmain),
@@ -206,6 +207,22 @@ Relation *Depsgraph::check_nodes_connected(const Node *from,
                                            const Node *to,
                                            const char *description)
 {
+  /* Scan whichever side of the relation has fewer links: nodes such as the copy-on-evaluation
+   * or parameters components of a heavily driven ID can have thousands of outgoing relations,
+   * which made the duplicate check quadratic while building relations. */
+  if (to->inlinks.size() < from->outlinks.size()) {
+    for (Relation *rel : to->inlinks) {
+      BLI_assert(rel->to == to);
+      if (rel->from != from) {
+        continue;
+      }
+      if (description != nullptr && !STREQ(rel->name, description)) {
+        continue;
+      }
+      return rel;
+    }
+    return nullptr;
+  }
   for (Relation *rel : from->outlinks) {
     BLI_assert(rel->from == from);
     if (rel->to != to) {
@@ -8,8 +8,11 @@
  * Evaluation engine entry-points for Depsgraph Engine.
  */
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <functional>
+#include <thread>
 
 #include "intern/eval/deg_eval.h"
 
@@ -17,6 +20,8 @@
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
 #include "BLI_time.h"
+#include "BLI_trace.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 
@@ -90,14 +95,15 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
-  /* Perform operation. */
+  /* Perform operation. The timing is always needed for the critical path estimation. */
+  const double start_time = BLI_time_now_seconds();
+  operation_node->evaluate(depsgraph);
+  const double eval_time = BLI_time_now_seconds() - start_time;
+  operation_node->eval_time = float(eval_time);
   if (state->do_stats) {
-    const double start_time = BLI_time_now_seconds();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
-  }
-  else {
-    operation_node->evaluate(depsgraph);
+    operation_node->stats.current_time += eval_time;
+    operation_node->stats_start_time = start_time;
+    operation_node->stats_thread_id = std::hash<std::thread::id>()(std::this_thread::get_id());
   }
 
   /* Clear the flag early on, allowing partial updates without re-evaluating the same node multiple
@@ -112,14 +118,26 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  while (operation_node != nullptr) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    /* Schedule children. The child on the longest path is evaluated right away by this thread,
+     * instead of waiting behind operations which are less critical for the total time. */
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      if (next_node == nullptr) {
+        next_node = node;
+        return;
+      }
+      if (node->critical_path_time > next_node->critical_path_time) {
+        std::swap(node, next_node);
+      }
+      BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+    });
+    operation_node = next_node;
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -350,6 +368,57 @@ void evaluate_graph_single_threaded_if_needed(DepsgraphEvalState *state)
   BLI_gsqueue_free(evaluation_queue);
 }
 
+/* Update #OperationNode::critical_path_time of all operations from their last evaluation times.
+ * Cyclic relations are ignored, so the relations form a DAG which is traversed depth-first. */
+void update_critical_path_times(Depsgraph *graph)
+{
+  constexpr float not_visited = -1.0f;
+  constexpr float in_progress = -2.0f;
+
+  for (OperationNode *node : graph->operations) {
+    node->critical_path_time = not_visited;
+  }
+
+  struct StackItem {
+    OperationNode *node;
+    int64_t next_link;
+  };
+  Vector<StackItem> stack;
+  for (OperationNode *root : graph->operations) {
+    if (root->critical_path_time != not_visited) {
+      continue;
+    }
+    root->critical_path_time = in_progress;
+    stack.append({root, 0});
+    while (!stack.is_empty()) {
+      StackItem &item = stack.last();
+      OperationNode *node = item.node;
+      if (item.next_link < node->outlinks.size()) {
+        Relation *rel = node->outlinks[item.next_link++];
+        if (rel->flag & RELATION_FLAG_CYCLIC) {
+          continue;
+        }
+        OperationNode *child = static_cast<OperationNode *>(rel->to);
+        if (child->critical_path_time == not_visited) {
+          child->critical_path_time = in_progress;
+          stack.append({child, 0});
+        }
+        continue;
+      }
+      float children_time = 0.0f;
+      for (Relation *rel : node->outlinks) {
+        if (rel->flag & RELATION_FLAG_CYCLIC) {
+          continue;
+        }
+        const OperationNode *child = static_cast<const OperationNode *>(rel->to);
+        children_time = std::max(children_time, child->critical_path_time);
+      }
+      node->critical_path_time = node->eval_time + children_time;
+      stack.remove_last();
+    }
+  }
+}
+
 void depsgraph_ensure_view_layer(Depsgraph *graph)
 {
   /* We update evaluated scene in the following cases:
@@ -385,6 +454,8 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
     return;
   }
 
+  TRACE_ZONE("Depsgraph Evaluate");
+
   /* The update counts can be used to check if the Depsgraph was changed since the last time it was
    * cached by comparing its current update count with the one stored at the moment the Depsgraph
    * data were cached.
@@ -458,6 +529,14 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
 
   evaluate_graph_single_threaded_if_needed(&state);
 
+  /* Prepare the order of the next evaluations based on the timings of this one. This is only done
+   * after the relations changed, usually the first evaluation after that evaluates everything. The
+   * timings are also kept up to date while gathering statistics. */
+  if (graph->need_update_critical_path_times || state.do_stats) {
+    update_critical_path_times(graph);
+    graph->need_update_critical_path_times = false;
+  }
+
   /* Finalize statistics gathering. This is because we only gather single
    * operation timing here, without aggregating anything to avoid any extra
    * synchronization. */
@@ -18,9 +18,11 @@
 
 #include "intern/eval/deg_eval_copy_on_write.h"
 
+#include <cinttypes>
 #include <cstring>
 
 #include "BLI_listbase.h"
+#include "BLI_time.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_curve.hh"
@@ -31,6 +33,7 @@
 #include "BKE_scene.hh"
 
 #include "DEG_depsgraph.hh"
+#include "DEG_depsgraph_debug.hh"
 #include "DEG_depsgraph_query.hh"
 
 #include "MEM_guardedalloc.h"
@@ -1000,7 +1003,29 @@ void deg_create_eval_copy(::Depsgraph *graph, const IDNode *id_node)
      * ensures scene and view layer pointers are valid. */
     return;
   }
+  if (!depsgraph->debug.do_time_debug()) {
+    deg_update_eval_copy_datablock(depsgraph, id_node);
+    return;
+  }
+  /* Report the cost of the copy. The memory difference is only meaningful when nothing else is
+   * evaluated at the same time, so it is only reported for single threaded evaluation. */
+  const double start_time = BLI_time_now_seconds();
+  const int64_t start_memory = int64_t(MEM_get_memory_in_use());
   deg_update_eval_copy_datablock(depsgraph, id_node);
+  const double time_ms = (BLI_time_now_seconds() - start_time) * 1000.0;
+  if (G.debug & G_DEBUG_DEPSGRAPH_NO_THREADS) {
+    const int64_t memory_delta = int64_t(MEM_get_memory_in_use()) - start_memory;
+    DEG_DEBUG_PRINTF(graph,
+                     TIME,
+                     "Copy-on-evaluation of %s took %f ms, memory changed by %" PRId64 " bytes\n",
+                     id_node->id_orig->name,
+                     time_ms,
+                     memory_delta);
+  }
+  else {
+    DEG_DEBUG_PRINTF(
+        graph, TIME, "Copy-on-evaluation of %s took %f ms\n", id_node->id_orig->name, time_ms);
+  }
 }
 
 bool deg_validate_eval_copy_datablock(ID *id_cow)
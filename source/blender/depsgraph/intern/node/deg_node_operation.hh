@@ -294,6 +294,17 @@ struct OperationNode : public Node {
   /* (OperationFlag) extra settings affecting evaluation. */
   int flag;
 
+  /* Time in seconds the last evaluation of this operation took. */
+  float eval_time = 0.0f;
+  /* Start time and thread of the last evaluation, only stored when time statistics are gathered.
+   * Used for exporting an evaluation timeline. */
+  double stats_start_time = 0.0;
+  size_t stats_thread_id = 0;
+  /* Estimated time in seconds from the start of this operation until all operations depending on
+   * it are evaluated, based on the last evaluation times. Used to evaluate the longest chains of
+   * operations first. */
+  float critical_path_time = 0.0f;
+
   DEG_DEPSNODE_DECLARE;
 };
 
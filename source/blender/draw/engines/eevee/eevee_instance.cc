@@ -375,13 +375,19 @@ void Instance::object_sync(ObjectRef &ob_ref, Manager & /*manager*/)
                                        OB_VOLUME,
                                        OB_LAMP,
                                        OB_LIGHTPROBE);
+  if (!is_renderable_type) {
+    /* Early out before querying the visibility, most scenes contain many empties, cameras and
+     * armatures which EEVEE never draws. */
+    return;
+  }
+
   const int ob_visibility = DRW_object_visibility_in_active_context(ob);
   const bool partsys_is_visible = (ob_visibility & OB_VISIBLE_PARTICLES) != 0 &&
                                   (ob->type == OB_MESH);
   const bool object_is_visible = DRW_object_is_renderable(ob) &&
                                  (ob_visibility & OB_VISIBLE_SELF) != 0;
 
-  if (!is_renderable_type || (!partsys_is_visible && !object_is_visible)) {
+  if (!partsys_is_visible && !object_is_visible) {
     return;
   }
 
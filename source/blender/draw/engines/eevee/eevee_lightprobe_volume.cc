@@ -7,6 +7,8 @@
 #include "BKE_global.hh"
 #include "BKE_lightprobe.h"
 
+#include "BLI_task.hh"
+
 #include "GPU_capabilities.hh"
 
 #include "GPU_debug.hh"
@@ -1341,19 +1343,21 @@ LightProbeGridCacheFrame *IrradianceBake::read_result_packed()
   cache_frame->visibility.L1_c = (float *)MEM_mallocN(visibility_texture_size, __func__);
 
   /* TODO(fclem): This could be done on GPU if that's faster. */
-  for (auto i : IndexRange(sample_count)) {
-    copy_v3_v3(cache_frame->irradiance.L0[i], cache_frame->baking.L0[i]);
-    copy_v3_v3(cache_frame->irradiance.L1_a[i], cache_frame->baking.L1_a[i]);
-    copy_v3_v3(cache_frame->irradiance.L1_b[i], cache_frame->baking.L1_b[i]);
-    copy_v3_v3(cache_frame->irradiance.L1_c[i], cache_frame->baking.L1_c[i]);
-
-    cache_frame->visibility.L0[i] = cache_frame->baking.L0[i][3];
-    cache_frame->visibility.L1_a[i] = cache_frame->baking.L1_a[i][3];
-    cache_frame->visibility.L1_b[i] = cache_frame->baking.L1_b[i][3];
-    cache_frame->visibility.L1_c[i] = cache_frame->baking.L1_c[i][3];
-    cache_frame->connectivity.validity[i] = unit_float_to_uchar_clamp(
-        cache_frame->baking.validity[i]);
-  }
+  threading::parallel_for(IndexRange(sample_count), 4096, [&](const IndexRange range) {
+    for (auto i : range) {
+      copy_v3_v3(cache_frame->irradiance.L0[i], cache_frame->baking.L0[i]);
+      copy_v3_v3(cache_frame->irradiance.L1_a[i], cache_frame->baking.L1_a[i]);
+      copy_v3_v3(cache_frame->irradiance.L1_b[i], cache_frame->baking.L1_b[i]);
+      copy_v3_v3(cache_frame->irradiance.L1_c[i], cache_frame->baking.L1_c[i]);
+
+      cache_frame->visibility.L0[i] = cache_frame->baking.L0[i][3];
+      cache_frame->visibility.L1_a[i] = cache_frame->baking.L1_a[i][3];
+      cache_frame->visibility.L1_b[i] = cache_frame->baking.L1_b[i][3];
+      cache_frame->visibility.L1_c[i] = cache_frame->baking.L1_c[i][3];
+      cache_frame->connectivity.validity[i] = unit_float_to_uchar_clamp(
+          cache_frame->baking.validity[i]);
+    }
+  });
 
   MEM_SAFE_FREE(cache_frame->baking.L0);
   MEM_SAFE_FREE(cache_frame->baking.L1_a);
@@ -484,8 +484,13 @@ RayTraceResult RayTraceModule::render(RayTraceBuffer &rt_buffer,
 
   data_.trace_refraction = screen_radiance_back_tx != nullptr;
 
+  /* Upper bound of the closure count of any material in this layer. Closures past this count are
+   * never written to the G-buffer, so there is no need to trace or denoise them. */
+  const int active_closure_count = min_ii(closure_count, count_bits_i(active_closures));
+
   for (int i = 0; i < 3; i++) {
-    result.closures[i] = trace(i, (closure_count > i), options, rt_buffer, main_view, render_view);
+    result.closures[i] = trace(
+        i, (active_closure_count > i), options, rt_buffer, main_view, render_view);
   }
 
   if (has_active_closure) {
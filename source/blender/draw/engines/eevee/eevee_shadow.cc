@@ -1242,8 +1242,9 @@ void ShadowModule::ShadowView::compute_visibility(ObjectBoundsBuf &bounds,
   /* Switch between tightly packed and set of whole word per instance. */
   uint words_len = (view_len_ == 1) ? divide_ceil_u(resource_len, 32) :
                                       resource_len * word_per_draw;
-  words_len = ceil_to_multiple_u(max_ii(1, words_len), 4);
-  /* TODO(fclem): Resize to nearest pow2 to reduce fragmentation. */
+  /* Resize to the nearest power of 2 so that small changes of the resource count between
+   * redraws do not reallocate the buffer every time. */
+  words_len = power_of_2_max_u(ceil_to_multiple_u(max_ii(1, words_len), 4));
   visibility_buf_.resize(words_len);
 
   const uint32_t data = 0xFFFFFFFFu;
@@ -11,6 +11,7 @@
 #include "BLI_array.hh"
 #include "BLI_array_utils.hh"
 #include "BLI_enumerable_thread_specific.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_math_geom.h"
 #include "BLI_task.hh"
 #include "BLI_virtual_array.hh"
@@ -75,46 +76,28 @@ static void mesh_render_data_loose_verts_bm(const MeshRenderData &mr,
                                             MeshBufferCache &cache,
                                             BMesh &bm)
 {
-  int i;
-  BMIter iter;
-  BMVert *vert;
-  int count = 0;
-  Array<int> loose_verts(mr.verts_num);
-  BM_ITER_MESH_INDEX (vert, &iter, &bm, BM_VERTS_OF_MESH, i) {
-    if (vert->e == nullptr) {
-      loose_verts[count] = i;
-      count++;
-    }
-  }
-  if (count < mr.verts_num) {
-    cache.loose_geom.verts = loose_verts.as_span().take_front(count);
-  }
-  else {
-    cache.loose_geom.verts = std::move(loose_verts);
-  }
+  /* Use the element table rather than iterating over the memory pool so the elements can be
+   * checked in parallel. */
+  IndexMaskMemory memory;
+  const IndexMask loose_verts = IndexMask::from_predicate(
+      IndexRange(mr.verts_num), GrainSize(4096), memory, [&](const int i) {
+        return BM_vert_at_index(&bm, i)->e == nullptr;
+      });
+  cache.loose_geom.verts.reinitialize(loose_verts.size());
+  loose_verts.to_indices<int>(cache.loose_geom.verts);
 }
 
 static void mesh_render_data_loose_edges_bm(const MeshRenderData &mr,
                                             MeshBufferCache &cache,
                                             BMesh &bm)
 {
-  int i;
-  BMIter iter;
-  BMEdge *edge;
-  int count = 0;
-  Array<int> loose_edges(mr.edges_num);
-  BM_ITER_MESH_INDEX (edge, &iter, &bm, BM_EDGES_OF_MESH, i) {
-    if (edge->l == nullptr) {
-      loose_edges[count] = i;
-      count++;
-    }
-  }
-  if (count < mr.edges_num) {
-    cache.loose_geom.edges = loose_edges.as_span().take_front(count);
-  }
-  else {
-    cache.loose_geom.edges = std::move(loose_edges);
-  }
+  IndexMaskMemory memory;
+  const IndexMask loose_edges = IndexMask::from_predicate(
+      IndexRange(mr.edges_num), GrainSize(4096), memory, [&](const int i) {
+        return BM_edge_at_index(&bm, i)->l == nullptr;
+      });
+  cache.loose_geom.edges.reinitialize(loose_edges.size());
+  loose_edges.to_indices<int>(cache.loose_geom.edges);
 }
 
 static void mesh_render_data_loose_geom_build(const MeshRenderData &mr, MeshBufferCache &cache)
@@ -1103,35 +1103,24 @@ static void grease_pencil_geom_batch_ensure(Object &object,
   int v_offset = 0;
   Vector<Array<int>> verts_start_offsets_per_visible_drawing;
   Vector<Array<int>> tris_start_offsets_per_visible_drawing;
+  Vector<Array<int>> ibo_start_offsets_per_visible_drawing;
   for (const ed::greasepencil::DrawingInfo &info : drawings) {
     const bke::CurvesGeometry &curves = info.drawing.strokes();
     const OffsetIndices<int> points_by_curve = curves.evaluated_points_by_curve();
+    const OffsetIndices<int> triangle_offsets = info.drawing.triangle_offsets();
     const VArray<bool> cyclic = curves.cyclic();
     IndexMaskMemory memory;
     const IndexMask visible_strokes = ed::greasepencil::retrieve_visible_strokes(
         object, info.drawing, memory);
 
     const int num_curves = visible_strokes.size();
-    const int verts_start_offsets_size = num_curves;
-    const int tris_start_offsets_size = num_curves;
-    Array<int> verts_start_offsets(verts_start_offsets_size);
-    Array<int> tris_start_offsets(tris_start_offsets_size);
-
-    /* Calculate the triangle offsets for all the visible curves. */
-    int t_offset = 0;
-    int pos = 0;
-    for (const int curve_i : curves.curves_range()) {
-      IndexRange points = points_by_curve[curve_i];
-      if (visible_strokes.contains(curve_i)) {
-        tris_start_offsets[pos] = t_offset;
-        pos++;
-      }
-      if (points.size() >= 3) {
-        t_offset += points.size() - 2;
-      }
-    }
+    Array<int> verts_start_offsets(num_curves);
+    Array<int> tris_start_offsets(num_curves);
+    /* Where the triangles of each visible stroke start in the index buffer, so that the buffers
+     * can be filled for all strokes in parallel. */
+    Array<int> ibo_start_offsets(num_curves);
 
-    /* Calculate the vertex offsets for all the visible curves. */
+    /* Calculate the vertex and triangle offsets for all the visible curves. */
     int num_cyclic = 0;
     int num_points = 0;
     visible_strokes.foreach_index([&](const int curve_i, const int pos) {
@@ -1145,15 +1134,20 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       verts_start_offsets[pos] = v_offset;
       v_offset += 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
       num_points += points.size();
+
+      tris_start_offsets[pos] = triangle_offsets[curve_i].start();
+      ibo_start_offsets[pos] = total_triangles_num;
+      /* Fill triangles, and a quad made of two triangles for each point. */
+      total_triangles_num += triangle_offsets[curve_i].size() +
+                             (points.size() + (is_cyclic ? 1 : 0)) * 2;
     });
 
     /* One vertex is stored before and after as padding. Cyclic strokes have one extra vertex. */
     total_verts_num += num_points + num_cyclic + num_curves * 2;
-    total_triangles_num += (num_points + num_cyclic) * 2;
-    total_triangles_num += info.drawing.triangles().size();
 
     verts_start_offsets_per_visible_drawing.append(std::move(verts_start_offsets));
     tris_start_offsets_per_visible_drawing.append(std::move(tris_start_offsets));
+    ibo_start_offsets_per_visible_drawing.append(std::move(ibo_start_offsets));
   }
 
   GPUUsageType vbo_flag = GPU_USAGE_STATIC | GPU_USAGE_FLAG_BUFFER_TEXTURE_ONLY;
@@ -1172,7 +1166,6 @@ static void grease_pencil_geom_batch_ensure(Object &object,
   GPUIndexBufBuilder ibo;
   GPU_indexbuf_init(&ibo, GPU_PRIM_TRIS, total_triangles_num, INT_MAX);
   MutableSpan<uint3> triangle_ibo_data = GPU_indexbuf_get_data(&ibo).cast<uint3>();
-  int triangle_ibo_index = 0;
 
   /* Fill buffers with data. */
   for (const int drawing_i : drawings.index_range()) {
@@ -1226,6 +1219,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
     const Span<float4x2> texture_matrices = info.drawing.texture_matrices();
     const Span<int> verts_start_offsets = verts_start_offsets_per_visible_drawing[drawing_i];
     const Span<int> tris_start_offsets = tris_start_offsets_per_visible_drawing[drawing_i];
+    const Span<int> ibo_start_offsets = ibo_start_offsets_per_visible_drawing[drawing_i];
     IndexMaskMemory memory;
     const IndexMask visible_strokes = ed::greasepencil::retrieve_visible_strokes(
         object, info.drawing, memory);
@@ -1241,7 +1235,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                               float u_stroke,
                               const float4x2 &texture_matrix,
                               GreasePencilStrokeVert &s_vert,
-                              GreasePencilColorVert &c_vert) {
+                              GreasePencilColorVert &c_vert,
+                              int &triangle_ibo_index) {
       const float3 pos = math::transform_point(layer_space_to_object_space, positions[point_i]);
       copy_v3_v3(s_vert.pos, pos);
       /* GP data itself does not constrain radii to be positive, but drawing code expects it, and
@@ -1272,11 +1267,12 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       triangle_ibo_index++;
     };
 
-    visible_strokes.foreach_index([&](const int curve_i, const int pos) {
+    visible_strokes.foreach_index(GrainSize(512), [&](const int curve_i, const int pos) {
       const IndexRange points = points_by_curve[curve_i];
       const bool is_cyclic = cyclic[curve_i] && (points.size() > 2);
       const int verts_start_offset = verts_start_offsets[pos];
       const int tris_start_offset = tris_start_offsets[pos];
+      int triangle_ibo_index = ibo_start_offsets[pos];
       const int num_verts = 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
       const IndexRange verts_range = IndexRange(verts_start_offset, num_verts);
       MutableSpan<GreasePencilStrokeVert> verts_slice = verts.slice(verts_range);
@@ -1315,7 +1311,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                        u_stroke,
                        texture_matrix,
                        verts_slice[idx],
-                       cols_slice[idx]);
+                       cols_slice[idx],
+                       triangle_ibo_index);
       }
 
       if (is_cyclic) {
@@ -1331,7 +1328,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                        u_stroke,
                        texture_matrix,
                        verts_slice[idx],
-                       cols_slice[idx]);
+                       cols_slice[idx],
+                       triangle_ibo_index);
       }
 
       /* Last vertex is not drawn. */
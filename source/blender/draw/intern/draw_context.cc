@@ -17,6 +17,7 @@
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
+#include "BLI_trace.hh"
 
 #include "BLF_api.hh"
 
@@ -738,6 +739,8 @@ static void drw_engines_cache_populate(blender::draw::ObjectRef &ref,
 
 void DRWContext::sync(iter_callback_t iter_callback)
 {
+  TRACE_ZONE("Draw Sync");
+
   /* Enable modules and init for next sync. */
   data->modules_begin_sync();
 
@@ -770,6 +773,8 @@ void DRWContext::engines_init_and_sync(iter_callback_t iter_callback)
 
 void DRWContext::engines_draw_scene()
 {
+  TRACE_ZONE("Draw Scene");
+
   /* Start Drawing */
   blender::draw::command::StateSet::set();
 
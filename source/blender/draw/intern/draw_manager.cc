@@ -120,7 +120,11 @@ void Manager::end_sync()
   matrix_buf.current().push_update();
   bounds_buf.current().push_update();
   infos_buf.current().push_update();
-  attributes_buf.push_update();
+  /* Most scenes don't use object attributes in their materials. Nothing reads the buffer then, so
+   * avoid uploading it for every sync. */
+  if (attribute_len_ > 0) {
+    attributes_buf.push_update();
+  }
   layer_attributes_buf.push_update();
 
   /* Useful for debugging the following resource finalize. But will trigger the drawing of the GPU
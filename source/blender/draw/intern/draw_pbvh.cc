@@ -9,6 +9,7 @@
  * Embeds GPU meshes inside of bke::pbvh::Tree nodes, used by mesh sculpt mode.
  */
 
+#include "BLI_bit_span_ops.hh"
 #include "BLI_map.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector_types.hh"
@@ -1774,9 +1775,12 @@ Span<gpu::VertBufPtr> DrawCacheImpl::ensure_attribute_data(const Object &object,
     }
   }
 
-  /* TODO: It would be good to deallocate the bit vector if all of the bits have been reset to
-   * avoid unnecessary processing in subsequent redraws. */
   dirty_mask.foreach_index_optimized<int>([&](const int i) { data.dirty_nodes[i].reset(); });
+  /* Reset the bit vector once all nodes are up to date to avoid unnecessary processing in
+   * subsequent redraws. */
+  if (!dirty_mask.is_empty() && !bits::any_bit_set(data.dirty_nodes)) {
+    data.dirty_nodes.clear();
+  }
 
   flush_vbo_data(vbos, mask);
 
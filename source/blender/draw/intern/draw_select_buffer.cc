@@ -158,10 +158,17 @@ uint *DRW_select_buffer_bitmap_from_rect(
 
   BLI_bitmap *bitmap_buf = BLI_BITMAP_NEW(bitmap_len, __func__);
   const uint *buf_iter = buf;
+  /* Neighboring pixels often share the same ID, only the first pixel of a run needs to be
+   * handled. Start with zero since it is never a valid index anyway. */
+  uint id_prev = 0;
   while (buf_len--) {
-    const uint index = *buf_iter - 1;
-    if (index < bitmap_len) {
-      BLI_BITMAP_ENABLE(bitmap_buf, index);
+    const uint id = *buf_iter;
+    if (id != id_prev) {
+      id_prev = id;
+      const uint index = id - 1;
+      if (index < bitmap_len) {
+        BLI_BITMAP_ENABLE(bitmap_buf, index);
+      }
     }
     buf_iter++;
   }
@@ -141,48 +141,49 @@ static void extract_uv_stretch_angle_mesh(const MeshRenderData &mr,
   const StringRef name = CustomData_get_active_layer_name(&mesh.corner_data, CD_PROP_FLOAT2);
   const VArraySpan uv_map = *attributes.lookup<float2>(name, bke::AttrDomain::Corner);
 
-  float auv[2][2], last_auv[2];
-  float av[2][3], last_av[3];
-
-  for (const int face_index : faces.index_range()) {
-    const IndexRange face = faces[face_index];
-    const int corner_end = face.start() + face.size();
-    for (int corner = face.start(); corner < corner_end; corner += 1) {
-      int l_next = corner + 1;
-      if (corner == face.start()) {
-        /* First loop in face. */
-        const int corner_last = corner_end - 1;
-        const int l_next_tmp = face.start();
-        compute_normalize_edge_vectors(auv,
-                                       av,
-                                       uv_map[corner_last],
-                                       uv_map[l_next_tmp],
-                                       positions[corner_verts[corner_last]],
-                                       positions[corner_verts[l_next_tmp]]);
-        /* Save last edge. */
-        copy_v2_v2(last_auv, auv[1]);
-        copy_v3_v3(last_av, av[1]);
+  threading::parallel_for(faces.index_range(), 2048, [&](const IndexRange range) {
+    float auv[2][2], last_auv[2];
+    float av[2][3], last_av[3];
+    for (const int face_index : range) {
+      const IndexRange face = faces[face_index];
+      const int corner_end = face.start() + face.size();
+      for (int corner = face.start(); corner < corner_end; corner += 1) {
+        int l_next = corner + 1;
+        if (corner == face.start()) {
+          /* First loop in face. */
+          const int corner_last = corner_end - 1;
+          const int l_next_tmp = face.start();
+          compute_normalize_edge_vectors(auv,
+                                         av,
+                                         uv_map[corner_last],
+                                         uv_map[l_next_tmp],
+                                         positions[corner_verts[corner_last]],
+                                         positions[corner_verts[l_next_tmp]]);
+          /* Save last edge. */
+          copy_v2_v2(last_auv, auv[1]);
+          copy_v3_v3(last_av, av[1]);
+        }
+        if (l_next == corner_end) {
+          l_next = face.start();
+          /* Move previous edge. */
+          copy_v2_v2(auv[0], auv[1]);
+          copy_v3_v3(av[0], av[1]);
+          /* Copy already calculated last edge. */
+          copy_v2_v2(auv[1], last_auv);
+          copy_v3_v3(av[1], last_av);
+        }
+        else {
+          compute_normalize_edge_vectors(auv,
+                                         av,
+                                         uv_map[corner],
+                                         uv_map[l_next],
+                                         positions[corner_verts[corner]],
+                                         positions[corner_verts[l_next]]);
+        }
+        edituv_get_edituv_stretch_angle(auv, av, &vbo_data[corner]);
       }
-      if (l_next == corner_end) {
-        l_next = face.start();
-        /* Move previous edge. */
-        copy_v2_v2(auv[0], auv[1]);
-        copy_v3_v3(av[0], av[1]);
-        /* Copy already calculated last edge. */
-        copy_v2_v2(auv[1], last_auv);
-        copy_v3_v3(av[1], last_av);
-      }
-      else {
-        compute_normalize_edge_vectors(auv,
-                                       av,
-                                       uv_map[corner],
-                                       uv_map[l_next],
-                                       positions[corner_verts[corner]],
-                                       positions[corner_verts[l_next]]);
-      }
-      edituv_get_edituv_stretch_angle(auv, av, &vbo_data[corner]);
     }
-  }
+  });
 }
 
 gpu::VertBufPtr extract_edituv_stretch_angle(const MeshRenderData &mr)
@@ -287,6 +287,12 @@ static int init_indexer_entries_from_value(FileIndexerEntries &indexer_entries,
 struct AssetLibraryIndex {
   struct PreexistingFileIndexInfo {
     bool is_used = false;
+    /**
+     * File status from listing the indices directory, so that it doesn't have to be queried again
+     * from the file system for every index.
+     */
+    size_t file_size = 0;
+    std::time_t modification_time = 0;
   };
 
   /**
@@ -370,7 +376,10 @@ struct AssetLibraryIndex {
     for (int i = 0; i < dir_entries_num; i++) {
       direntry *entry = &dir_entries[i];
       if (BLI_str_endswith(entry->relname, ".index.json")) {
-        this->preexisting_file_indices.add_as(std::string(entry->path));
+        PreexistingFileIndexInfo info;
+        info.file_size = size_t(entry->s.st_size);
+        info.modification_time = entry->s.st_mtime;
+        this->preexisting_file_indices.add_as(std::string(entry->path), info);
       }
     }
 
@@ -522,10 +531,16 @@ class AssetIndexFile : public AbstractFile {
    */
   const size_t MIN_FILE_SIZE_WITH_ENTRIES = 32;
   std::string filename;
+  /**
+   * Information about the index file when it already existed before reading started, null
+   * otherwise. Invalidated when the index file is deleted.
+   */
+  const AssetLibraryIndex::PreexistingFileIndexInfo *preexisting_info;
 
   AssetIndexFile(AssetLibraryIndex &library_index, StringRef index_file_path)
       : library_index(library_index), filename(index_file_path)
   {
+    this->preexisting_info = library_index.preexisting_file_indices.lookup_ptr(this->filename);
   }
 
   AssetIndexFile(AssetLibraryIndex &library_index, BlendFile &asset_filename)
@@ -543,12 +558,36 @@ class AssetIndexFile : public AbstractFile {
     return filename.c_str();
   }
 
+  bool exists() const
+  {
+    return this->preexisting_info != nullptr || AbstractFile::exists();
+  }
+
+  std::time_t get_modification_time() const
+  {
+    if (this->preexisting_info) {
+      return this->preexisting_info->modification_time;
+    }
+    BLI_stat_t stat = {};
+    if (BLI_stat(this->get_file_path(), &stat) == -1) {
+      return 0;
+    }
+    return stat.st_mtime;
+  }
+
   /**
    * Returns whether the index file is older than the given asset file.
    */
   bool is_older_than(const BlendFile &asset_file) const
   {
-    return BLI_file_older(this->get_file_path(), asset_file.get_file_path());
+    if (this->preexisting_info == nullptr) {
+      return BLI_file_older(this->get_file_path(), asset_file.get_file_path());
+    }
+    BLI_stat_t stat = {};
+    if (BLI_stat(asset_file.get_file_path(), &stat) == -1) {
+      return false;
+    }
+    return this->preexisting_info->modification_time < stat.st_mtime;
   }
 
   /**
@@ -556,7 +595,8 @@ class AssetIndexFile : public AbstractFile {
    */
   bool constains_entries() const
   {
-    const size_t file_size = get_file_size();
+    const size_t file_size = this->preexisting_info ? this->preexisting_info->file_size :
+                                                      get_file_size();
     return file_size >= MIN_FILE_SIZE_WITH_ENTRIES;
   }
 
@@ -624,11 +664,7 @@ int AssetLibraryIndex::remove_broken_index_files()
     tm_from.tm_mday = 3;           /* Day after fix. */
     std::time_t timestamp_from = std::mktime(&tm_from);
     std::time_t timestamp_to = std::mktime(&tm_to);
-    BLI_stat_t stat = {};
-    if (BLI_stat(index_file.get_file_path(), &stat) == -1) {
-      continue;
-    }
-    if (IN_RANGE(stat.st_mtime, timestamp_from, timestamp_to)) {
+    if (IN_RANGE(index_file.get_modification_time(), timestamp_from, timestamp_to)) {
       CLOG_INFO(&LOG, 2, "Remove potentially broken index file [%s].", index_path.c_str());
       files_to_remove.add(index_path);
     }
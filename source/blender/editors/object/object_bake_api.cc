@@ -1817,6 +1817,8 @@ static wmOperatorStatus bake(const BakeAPIRender *bkr,
 
 cleanup:
 
+  RE_bake_engine_free(re);
+
   if (highpoly) {
     for (int i = 0; i < highpoly_num; i++) {
       if (highpoly[i].mesh != nullptr) {
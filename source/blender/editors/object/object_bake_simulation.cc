@@ -220,6 +220,11 @@ struct NodeBakeRequest {
   std::optional<bake::BakePath> path;
   int frame_start;
   int frame_end;
+  /**
+   * Only frames in the range above are (re)baked, previously baked frames outside of it are kept.
+   * This allows splitting a bake over multiple processes that write into the same directory.
+   */
+  bool keep_other_frames = false;
   std::unique_ptr<bake::BlobWriteSharing> blob_sharing;
 };
 
@@ -249,6 +254,28 @@ static void clear_requested_bakes_in_modifier_cache(BakeGeometryNodesJob &job)
   }
 }
 
+static int64_t dir_files_size(const StringRefNull dir)
+{
+  if (!BLI_is_dir(dir.c_str())) {
+    return 0;
+  }
+  int64_t size = 0;
+  direntry *dir_entries = nullptr;
+  const uint dir_entries_num = BLI_filelist_dir_contents(dir.c_str(), &dir_entries);
+  for (const uint i : IndexRange(dir_entries_num)) {
+    if (S_ISREG(dir_entries[i].s.st_mode)) {
+      size += int64_t(dir_entries[i].s.st_size);
+    }
+  }
+  BLI_filelist_free(dir_entries, dir_entries_num);
+  return size;
+}
+
+static int64_t bake_size_on_disk(const bake::BakePath &path)
+{
+  return dir_files_size(path.meta_dir) + dir_files_size(path.blobs_dir);
+}
+
 static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *worker_status)
 {
   BakeGeometryNodesJob &job = *static_cast<BakeGeometryNodesJob *>(customdata);
@@ -361,10 +388,17 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
     worker_status->do_update = true;
   }
 
-  /* Update bake sizes. */
+  /* Update bake sizes, also when canceled since data may have been written or deleted already. */
   for (NodeBakeRequest &request : job.bake_requests) {
     NodesModifierBake *bake = request.nmd->find_bake(request.bake_id);
-    bake->bake_size = size_by_bake.lookup_default(&request, 0);
+    if (request.keep_other_frames) {
+      /* Only part of the bake has been written, the other frames are in the same directory. */
+      bake->bake_size = bake_size_on_disk(*request.path);
+    }
+    else {
+      /* The previous bake has been deleted before baking, so only the written data remains. */
+      bake->bake_size = size_by_bake.lookup_default(&request, 0);
+    }
   }
 
   /* Store gathered data as packed data. */
@@ -413,6 +447,20 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
     bake->packed = packed_bake;
   }
 
+  /* The in-memory cache of partial bakes only contains the frames baked just now, reload the
+   * complete bake from disk instead. */
+  for (NodeBakeRequest &request : job.bake_requests) {
+    if (!request.keep_other_frames) {
+      continue;
+    }
+    if (bake::BakeNodeCache *node_cache = request.nmd->runtime->cache->get_bake_node_cache(
+            request.bake_id))
+    {
+      node_cache->reset();
+    }
+    DEG_id_tag_update(&request.object->id, ID_RECALC_GEOMETRY);
+  }
+
   /* Tag simulations as being baked. */
   for (NodeBakeRequest &request : job.bake_requests) {
     if (request.node_type != GEO_NODE_SIMULATION_OUTPUT) {
@@ -553,6 +601,9 @@ static wmOperatorStatus start_bake_job(bContext *C,
 {
   for (NodeBakeRequest &request : requests) {
     reset_old_bake_cache(request);
+    if (request.keep_other_frames) {
+      continue;
+    }
     if (NodesModifierBake *bake = request.nmd->find_bake(request.bake_id)) {
       clear_data_block_references(*bake);
     }
@@ -989,6 +1040,31 @@ static Vector<NodeBakeRequest> bake_single_node_gather_bake_request(bContext *C,
     }
     request.frame_start = frame_range->first();
     request.frame_end = frame_range->last();
+
+    const bool use_frame_start = RNA_struct_property_is_set(op->ptr, "frame_start");
+    const bool use_frame_end = RNA_struct_property_is_set(op->ptr, "frame_end");
+    if (use_frame_start || use_frame_end) {
+      /* Simulations depend on the previous frame, so they can't be split into frame ranges. */
+      if (node->type_legacy != GEO_NODE_BAKE) {
+        BKE_report(op->reports, RPT_ERROR, "Only bake nodes can be baked for a part of the range");
+        return {};
+      }
+      if (!request.path) {
+        BKE_report(op->reports, RPT_ERROR, "Baking a part of the range requires a bake on disk");
+        return {};
+      }
+      if (use_frame_start) {
+        request.frame_start = RNA_int_get(op->ptr, "frame_start");
+      }
+      if (use_frame_end) {
+        request.frame_end = RNA_int_get(op->ptr, "frame_end");
+      }
+      if (request.frame_start > request.frame_end) {
+        BKE_report(op->reports, RPT_ERROR, "Start frame must not be after the end frame");
+        return {};
+      }
+      request.keep_other_frames = true;
+    }
   }
 
   Vector<NodeBakeRequest> requests;
@@ -1223,6 +1299,32 @@ void OBJECT_OT_geometry_node_bake_single(wmOperatorType *ot)
   ot->modal = bake_single_node_modal;
 
   single_bake_operator_props(ot);
+
+  PropertyRNA *prop;
+  prop = RNA_def_int(ot->srna,
+                     "frame_start",
+                     1,
+                     MINAFRAME,
+                     MAXFRAME,
+                     "Start Frame",
+                     "First frame to bake. When set, frames already baked outside of the "
+                     "range are kept, so that parts of the range can be baked by separate "
+                     "processes",
+                     MINAFRAME,
+                     MAXFRAME);
+  RNA_def_property_flag(prop, PROP_SKIP_SAVE);
+  prop = RNA_def_int(ot->srna,
+                     "frame_end",
+                     1,
+                     MINAFRAME,
+                     MAXFRAME,
+                     "End Frame",
+                     "Last frame to bake. When set, frames already baked outside of the "
+                     "range are kept, so that parts of the range can be baked by separate "
+                     "processes",
+                     MINAFRAME,
+                     MAXFRAME);
+  RNA_def_property_flag(prop, PROP_SKIP_SAVE);
 }
 
 void OBJECT_OT_geometry_node_bake_delete_single(wmOperatorType *ot)
@@ -121,6 +121,7 @@ static void step_decode(
     pointcloud.runtime->bounds_with_radius_cache = object.bounds_with_radius_cache;
     if (positions_changed) {
       pointcloud.runtime->bvh_cache.tag_dirty();
+      pointcloud.runtime->kdtree_cache.tag_dirty();
     }
     DEG_id_tag_update(&pointcloud.id, ID_RECALC_GEOMETRY);
   }
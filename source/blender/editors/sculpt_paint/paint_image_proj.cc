@@ -293,6 +293,8 @@ struct ProjPaintState {
   /* end similarities with ImagePaintState */
 
   Image *stencil_ima;
+  /** Acquired once per stroke, to avoid looking up the stencil buffer for every pixel. */
+  ImBuf *stencil_ibuf;
   Image *canvas_ima;
   Image *clone_ima;
   float stencil_value;
@@ -1658,16 +1660,12 @@ static float project_paint_uvpixel_mask(const ProjPaintState *ps,
   /* Image Mask */
   if (ps->do_layer_stencil) {
     /* another UV maps image is masking this one's */
-    ImBuf *ibuf_other;
-    Image *other_tpage = ps->stencil_ima;
-
-    if (other_tpage && (ibuf_other = BKE_image_acquire_ibuf(other_tpage, nullptr, nullptr))) {
+    if (ImBuf *ibuf_other = ps->stencil_ibuf) {
       const int3 &tri_other = ps->corner_tris_eval[tri_index];
       const float *other_tri_uv[3] = {ps->mloopuv_stencil_eval[tri_other[0]],
                                       ps->mloopuv_stencil_eval[tri_other[1]],
                                       ps->mloopuv_stencil_eval[tri_other[2]]};
 
-      /* #BKE_image_acquire_ibuf - TODO: this may be slow. */
       uchar rgba_ub[4];
       float rgba_f[4];
 
@@ -1681,8 +1679,6 @@ static float project_paint_uvpixel_mask(const ProjPaintState *ps,
                (rgba_ub[3] * (1.0f / 255.0f));
       }
 
-      BKE_image_release_ibuf(other_tpage, ibuf_other, nullptr);
-
       if (!ps->do_layer_stencil_inv) {
         /* matching the gimps layer mask black/white rules, white==full opacity */
         mask = (1.0f - mask);
@@ -4547,6 +4543,10 @@ static void project_paint_begin(const bContext *C,
     }
   }
 
+  if (ps->do_layer_stencil && ps->stencil_ima) {
+    ps->stencil_ibuf = BKE_image_acquire_ibuf(ps->stencil_ima, nullptr, nullptr);
+  }
+
   /* when using sub-surface or multi-resolution,
    * mesh-data arrays are thrown away, we need to keep a copy. */
   if (ps->is_shared_user == false) {
@@ -4636,6 +4636,11 @@ static void project_paint_end(ProjPaintState *ps)
   }
   BKE_image_release_ibuf(ps->reproject_image, ps->reproject_ibuf, nullptr);
 
+  if (ps->stencil_ibuf) {
+    BKE_image_release_ibuf(ps->stencil_ima, ps->stencil_ibuf, nullptr);
+    ps->stencil_ibuf = nullptr;
+  }
+
   MEM_freeN(ps->screenCoords);
   MEM_freeN(ps->bucketRect);
   MEM_freeN(ps->bucketFaces);
@@ -847,6 +847,11 @@ static int paint_space_stroke(bContext *C,
   float pressure = stroke->last_pressure;
   float pressure_delta = final_pressure - stroke->last_pressure;
   const float no_pressure_spacing = paint_space_stroke_spacing(C, stroke, 1.0f, 1.0f);
+  /* Integrating the overlap evaluates the brush curve many times for small spacing, but the
+   * spacing factor is usually the same for all steps of one event, so only recompute it when it
+   * changes. */
+  std::optional<float> last_spacing_factor;
+  float overlap_factor = 1.0f;
   int count = 0;
   while (length > 0.0f) {
     const float spacing = paint_space_stroke_spacing_variable(
@@ -869,8 +874,12 @@ static int paint_space_stroke(bContext *C,
       }
       pressure = stroke->last_pressure + (spacing / length) * pressure_delta;
 
-      ups->overlap_factor = paint_stroke_integrate_overlap(*stroke->brush,
-                                                           spacing / no_pressure_spacing);
+      const float spacing_factor = spacing / no_pressure_spacing;
+      if (spacing_factor != last_spacing_factor) {
+        overlap_factor = paint_stroke_integrate_overlap(*stroke->brush, spacing_factor);
+        last_spacing_factor = spacing_factor;
+      }
+      ups->overlap_factor = overlap_factor;
 
       stroke->stroke_distance += spacing / stroke->zoom_2d;
       paint_brush_stroke_add_step(C, op, stroke, mouse, pressure);
@@ -1004,11 +1004,13 @@ static bool wpaint_stroke_test_start(bContext *C, wmOperator *op, const float mo
   }
 
   if (!ob.sculpt->mode.wpaint.dvert_prev.is_empty()) {
-    MDeformVert *dv = ob.sculpt->mode.wpaint.dvert_prev.data();
-    for (int i = 0; i < mesh.verts_num; i++, dv++) {
-      /* Use to show this isn't initialized, never apply to the mesh data. */
-      dv->flag = 1;
-    }
+    MutableSpan<MDeformVert> dvert_prev = ob.sculpt->mode.wpaint.dvert_prev;
+    threading::parallel_for(dvert_prev.index_range(), 4096, [&](const IndexRange range) {
+      for (MDeformVert &dv : dvert_prev.slice(range)) {
+        /* Use to show this isn't initialized, never apply to the mesh data. */
+        dv.flag = 1;
+      }
+    });
   }
 
   paint_stroke_set_mode_data(&stroke, std::move(wpd));
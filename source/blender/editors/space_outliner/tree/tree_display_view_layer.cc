@@ -305,12 +305,16 @@ void ObjectsChildrenBuilder::make_object_parent_hierarchy_collections()
 
 void ObjectsChildrenBuilder::add_object_and_parents_in_order(Object *ob)
 {
+  /* If the object was already added, so were all of its parents. Returning early avoids walking
+   * up the whole parent chain again for every object of deep hierarchies. */
+  if (objects_in_ordered_objects_.contains(ob)) {
+    return;
+  }
   if (Object *parent = ob->parent) {
     add_object_and_parents_in_order(parent);
   }
-  if (objects_in_ordered_objects_.add(ob)) {
-    ordered_objects_.append(ob);
-  }
+  objects_in_ordered_objects_.add_new(ob);
+  ordered_objects_.append(ob);
 }
 
 /** \} */
@@ -15,6 +15,7 @@
 #include "../geometry/normal_cycle.h"
 
 #include "BLI_sys_types.h"
+#include "BLI_task.hh"
 
 #include "BKE_global.hh"
 
@@ -121,11 +122,13 @@ void FEdgeXDetector::preProcessShape(WXShape *iWShape)
 #endif
 
   vector<WFace *> &wfaces = iWShape->GetFaceList();
-  vector<WFace *>::iterator f, fend;
-  // view dependent stuff
-  for (f = wfaces.begin(), fend = wfaces.end(); f != fend; ++f) {
-    preProcessFace((WXFace *)(*f));
-  }
+  // view dependent stuff, faces are independent of each other
+  blender::threading::parallel_for(
+      blender::IndexRange(wfaces.size()), 1024, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          preProcessFace((WXFace *)wfaces[i]);
+        }
+      });
 
   if (_computeRidgesAndValleys || _computeSuggestiveContours) {
     vector<WVertex *> &wvertices = iWShape->getVertexList();
@@ -256,18 +259,24 @@ void FEdgeXDetector::computeCurvatures(WXVertex *vertex)
 void FEdgeXDetector::processSilhouetteShape(WXShape *iWShape)
 {
   // Make a first pass on every polygons in order to compute all their silhouette relative values:
+  // Each face only modifies its own layers, so they can be processed in parallel.
   vector<WFace *> &wfaces = iWShape->GetFaceList();
-  vector<WFace *>::iterator f, fend;
-  for (f = wfaces.begin(), fend = wfaces.end(); f != fend; ++f) {
-    ProcessSilhouetteFace((WXFace *)(*f));
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(wfaces.size()), 512, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          ProcessSilhouetteFace((WXFace *)wfaces[i]);
+        }
+      });
 
   // Make a pass on the edges to detect the silhouette edges that are not smooth
-  vector<WEdge *>::iterator we, weend;
+  // Each edge only reads its adjacent faces and modifies itself.
   vector<WEdge *> &wedges = iWShape->getEdgeList();
-  for (we = wedges.begin(), weend = wedges.end(); we != weend; ++we) {
-    ProcessSilhouetteEdge((WXEdge *)(*we));
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(wedges.size()), 1024, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          ProcessSilhouetteEdge((WXEdge *)wedges[i]);
+        }
+      });
 }
 
 void FEdgeXDetector::ProcessSilhouetteFace(WXFace *iFace)
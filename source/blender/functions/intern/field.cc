@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
 #include "BLI_array_utils.hh"
+#include "BLI_linear_allocator.hh"
 #include "BLI_map.hh"
 #include "BLI_multi_value_map.hh"
 #include "BLI_set.hh"
@@ -373,13 +374,12 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
         procedure, scope, field_tree_info, varying_fields_to_evaluate);
     mf::ProcedureExecutor procedure_executor{procedure};
 
-    mf::ParamsBuilder mf_params{procedure_executor, &mask};
-    mf::ContextBuilder mf_context;
-
-    /* Provide inputs to the procedure executor. */
-    for (const GVArray &varray : field_context_inputs) {
-      mf_params.add_readonly_single_input(varray);
-    }
+    /* Outputs that are written to a destination which is not a span. Computing those into a
+     * temporary array of the full size and copying it afterwards can use a lot of memory, so the
+     * procedure is evaluated in chunks with small temporary buffers instead. */
+    Vector<int> chunked_outputs;
+    Vector<GVMutableArray> chunked_dst_varrays;
+    Vector<void *> output_buffers(varying_fields_to_evaluate.size(), nullptr);
 
     for (const int i : varying_fields_to_evaluate.index_range()) {
       const GFieldRef &field = varying_fields_to_evaluate[i];
@@ -388,8 +388,15 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
 
       /* Try to get an existing virtual array that the result should be written into. */
       GVMutableArray dst_varray = get_dst_varray(out_index);
+      if (dst_varray && !dst_varray.is_span()) {
+        chunked_outputs.append(i);
+        chunked_dst_varrays.append(dst_varray);
+        r_varrays[out_index] = dst_varray;
+        is_output_written_to_dst[out_index] = true;
+        continue;
+      }
       void *buffer;
-      if (!dst_varray || !dst_varray.is_span()) {
+      if (!dst_varray) {
         /* Allocate a new buffer for the computed result. */
         buffer = scope.allocator().allocate_array(type, array_size);
 
@@ -408,13 +415,69 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
         r_varrays[out_index] = dst_varray;
         is_output_written_to_dst[out_index] = true;
       }
+      output_buffers[i] = buffer;
+    }
 
-      /* Pass output buffer to the procedure executor. */
-      const GMutableSpan span{type, buffer, array_size};
-      mf_params.add_uninitialized_single_output(span);
+    if (chunked_outputs.is_empty()) {
+      mf::ParamsBuilder mf_params{procedure_executor, &mask};
+      mf::ContextBuilder mf_context;
+
+      /* Provide inputs to the procedure executor. */
+      for (const GVArray &varray : field_context_inputs) {
+        mf_params.add_readonly_single_input(varray);
+      }
+      /* Pass output buffers to the procedure executor. */
+      for (const int i : varying_fields_to_evaluate.index_range()) {
+        const CPPType &type = varying_fields_to_evaluate[i].cpp_type();
+        mf_params.add_uninitialized_single_output({type, output_buffers[i], array_size});
+      }
+
+      procedure_executor.call_auto(mask, mf_params, mf_context);
     }
+    else {
+      threading::parallel_for(mask.index_range(), 4096, [&](const IndexRange range) {
+        /* Shift the indices of the chunk to start at zero, so that the temporary buffers only
+         * have to be as large as the chunk. */
+        const IndexMask sliced_mask = mask.slice(range);
+        const int64_t chunk_start = sliced_mask.first();
+        const IndexRange chunk_range(chunk_start, sliced_mask.last() - chunk_start + 1);
+        IndexMaskMemory memory;
+        const IndexMask chunk_mask = mask.slice_and_shift(range, -chunk_start, memory);
+
+        LinearAllocator<> allocator;
+        mf::ParamsBuilder mf_params{procedure_executor, &chunk_mask};
+        mf::ContextBuilder mf_context;
+        for (const GVArray &varray : field_context_inputs) {
+          mf_params.add_readonly_single_input(varray.slice(chunk_range));
+        }
+        Vector<void *> chunk_buffers(varying_fields_to_evaluate.size(), nullptr);
+        for (const int i : varying_fields_to_evaluate.index_range()) {
+          const CPPType &type = varying_fields_to_evaluate[i].cpp_type();
+          void *buffer;
+          if (output_buffers[i]) {
+            buffer = POINTER_OFFSET(output_buffers[i], type.size * chunk_start);
+          }
+          else {
+            buffer = allocator.allocate(type.size * chunk_range.size(), type.alignment);
+            chunk_buffers[i] = buffer;
+          }
+          mf_params.add_uninitialized_single_output({type, buffer, chunk_range.size()});
+        }
+
+        procedure_executor.call(chunk_mask, mf_params, mf_context);
 
-    procedure_executor.call_auto(mask, mf_params, mf_context);
+        for (const int chunked_i : chunked_outputs.index_range()) {
+          const int i = chunked_outputs[chunked_i];
+          const CPPType &type = varying_fields_to_evaluate[i].cpp_type();
+          GVMutableArray &dst_varray = chunked_dst_varrays[chunked_i];
+          void *buffer = chunk_buffers[i];
+          chunk_mask.foreach_index([&](const int64_t index) {
+            dst_varray.set_by_relocate(chunk_start + index,
+                                       POINTER_OFFSET(buffer, type.size * index));
+          });
+        }
+      });
+    }
   }
 
   /* Evaluate constant fields if necessary. */
@@ -132,31 +132,45 @@ void MultiFunction::call_auto(const IndexMask &mask, Params params, Context cont
     return;
   }
 
+  auto call_for_range = [&](const IndexRange sub_range) {
+    const IndexMask sliced_mask = mask.slice(sub_range);
+    if (!hints.allocates_array) {
+      /* There is no benefit to changing indices in this case. */
+      this->call(sliced_mask, params, context);
+      return;
+    }
+    if (sliced_mask[0] < grain_size) {
+      /* The indices are low, no need to offset them. */
+      this->call(sliced_mask, params, context);
+      return;
+    }
+    const int64_t input_slice_start = sliced_mask[0];
+    const int64_t input_slice_size = sliced_mask.last() - input_slice_start + 1;
+    const IndexRange input_slice_range{input_slice_start, input_slice_size};
+
+    IndexMaskMemory memory;
+    const int64_t offset = -input_slice_start;
+    const IndexMask shifted_mask = mask.slice_and_shift(sub_range, offset, memory);
+
+    ParamsBuilder sliced_params{*this, &shifted_mask};
+    add_sliced_parameters(*signature_ref_, params, input_slice_range, sliced_params);
+    this->call(shifted_mask, sliced_params, context);
+  };
+
   const int64_t alignment = compute_alignment(grain_size);
   threading::parallel_for_aligned(
       mask.index_range(), grain_size, alignment, [&](const IndexRange sub_range) {
-        const IndexMask sliced_mask = mask.slice(sub_range);
         if (!hints.allocates_array) {
-          /* There is no benefit to changing indices in this case. */
-          this->call(sliced_mask, params, context);
+          call_for_range(sub_range);
           return;
         }
-        if (sliced_mask[0] < grain_size) {
-          /* The indices are low, no need to offset them. */
-          this->call(sliced_mask, params, context);
-          return;
+        /* The task scheduler may pass ranges much larger than the grain size. Split them up
+         * again, so that intermediate arrays stay small enough to remain in the CPU cache and
+         * are reused between the chunks. */
+        const int64_t chunk_size = std::max(alignment, grain_size / alignment * alignment);
+        for (int64_t start = 0; start < sub_range.size(); start += chunk_size) {
+          call_for_range(sub_range.slice(start, std::min(chunk_size, sub_range.size() - start)));
         }
-        const int64_t input_slice_start = sliced_mask[0];
-        const int64_t input_slice_size = sliced_mask.last() - input_slice_start + 1;
-        const IndexRange input_slice_range{input_slice_start, input_slice_size};
-
-        IndexMaskMemory memory;
-        const int64_t offset = -input_slice_start;
-        const IndexMask shifted_mask = mask.slice_and_shift(sub_range, offset, memory);
-
-        ParamsBuilder sliced_params{*this, &shifted_mask};
-        add_sliced_parameters(*signature_ref_, params, input_slice_range, sliced_params);
-        this->call(shifted_mask, sliced_params, context);
       });
 }
 
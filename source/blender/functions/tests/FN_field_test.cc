@@ -123,6 +123,49 @@ TEST(field, InputAndFunction)
   EXPECT_EQ(result[8], 16);
 }
 
+struct DerivedIntItem {
+  int value;
+  int padding;
+};
+
+static int get_derived_int(const DerivedIntItem &item)
+{
+  return item.value;
+}
+
+static void set_derived_int(DerivedIntItem &item, int value)
+{
+  item.value = value;
+}
+
+TEST(field, NonSpanDestination)
+{
+  GField index_field{std::make_shared<IndexFieldInput>()};
+
+  auto add_fn = mf::build::SI2_SO<int, int, int>("add", [](int a, int b) { return a + b; });
+  GField output_field{FieldOperation::Create(add_fn, {index_field, index_field}), 0};
+
+  /* Use enough elements so that the evaluation is split into multiple chunks. */
+  const int size = 10000;
+  Array<DerivedIntItem> items(size, {-1, -1});
+  GVMutableArray dst = VMutableArray<int>::ForDerivedSpan<DerivedIntItem,
+                                                         get_derived_int,
+                                                         set_derived_int>(items);
+
+  const IndexMask mask{IndexRange(1, size - 2)};
+
+  FieldContext context;
+  FieldEvaluator evaluator{context, &mask};
+  evaluator.add_with_destination(output_field, dst);
+  evaluator.evaluate();
+  EXPECT_EQ(items[0].value, -1);
+  EXPECT_EQ(items[1].value, 2);
+  EXPECT_EQ(items[5000].value, 10000);
+  EXPECT_EQ(items[size - 2].value, (size - 2) * 2);
+  EXPECT_EQ(items[size - 1].value, -1);
+  EXPECT_EQ(items[size - 2].padding, -1);
+}
+
 TEST(field, TwoFunctions)
 {
   GField index_field{std::make_shared<IndexFieldInput>()};
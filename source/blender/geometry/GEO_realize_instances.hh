@@ -24,6 +24,11 @@ struct RealizeInstancesOptions {
    * instances. Otherwise, instance attributes are ignored.
    */
   bool realize_instance_attributes = true;
+  /**
+   * When positive, nothing is realized if the output geometry is estimated to use more bytes than
+   * this. The input geometry is returned unchanged in that case, see #RealizeInstancesReport.
+   */
+  int64_t memory_limit = 0;
 
   std::reference_wrapper<const bke::AttributeFilter> attribute_filter =
       bke::AttributeFilter::default_filter();
@@ -49,6 +54,19 @@ struct VariedDepthOptions {
   static constexpr int MAX_DEPTH = -1;
 };
 
+/**
+ * Information about the realized geometry that is known before the output data is allocated.
+ */
+struct RealizeInstancesReport {
+  /**
+   * Rough estimate of the memory used by the realized geometry data. This only accounts for the
+   * arrays that are allocated for the output elements, not for shared data like instances.
+   */
+  int64_t estimated_bytes = 0;
+  /** True when #RealizeInstancesOptions::memory_limit was exceeded and nothing was realized. */
+  bool memory_limit_exceeded = false;
+};
+
 /**
  * Join all instances into a single geometry component for each geometry type. For example, all
  * mesh instances (including the already realized mesh) are joined into a single mesh. The output
@@ -68,6 +86,7 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
  */
 bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
                                    const RealizeInstancesOptions &options,
-                                   const VariedDepthOptions &varied_depth_option);
+                                   const VariedDepthOptions &varied_depth_option,
+                                   RealizeInstancesReport *r_report = nullptr);
 
 }  // namespace blender::geometry
@@ -437,6 +437,67 @@ static int64_t get_final_points_num(const GatherTasks &tasks)
   return points_num;
 }
 
+static int64_t get_attributes_bytes_per_element(const OrderedAttributes &attributes,
+                                               const bke::AttrDomain domain)
+{
+  int64_t bytes = 0;
+  for (const AttributeDomainAndType &kind : attributes.kinds) {
+    if (kind.domain == domain) {
+      bytes += bke::custom_data_type_to_cpp_type(kind.data_type)->size;
+    }
+  }
+  return bytes;
+}
+
+/**
+ * Estimate the size of the arrays that are allocated for the realized geometry. The last task of
+ * each type knows the final element counts, so this is cheap and can be done before any of the
+ * output is allocated. Grease Pencil drawings and volumes are not taken into account because
+ * their data is mostly shared with the input.
+ */
+static int64_t estimate_realized_bytes(const GatherTasks &tasks,
+                                       const AllPointCloudsInfo &pointclouds,
+                                       const AllMeshesInfo &meshes,
+                                       const AllCurvesInfo &curves)
+{
+  using bke::AttrDomain;
+  int64_t bytes = 0;
+  if (!tasks.pointcloud_tasks.is_empty()) {
+    const RealizePointCloudTask &task = tasks.pointcloud_tasks.last();
+    const int64_t points_num = task.start_index + task.pointcloud_info->pointcloud->totpoint;
+    bytes += points_num * (sizeof(float3) + get_attributes_bytes_per_element(
+                                                pointclouds.attributes, AttrDomain::Point));
+  }
+  if (!tasks.mesh_tasks.is_empty()) {
+    const RealizeMeshTask &task = tasks.mesh_tasks.last();
+    const Mesh &mesh = *task.mesh_info->mesh;
+    const int64_t verts_num = task.start_indices.vertex + mesh.verts_num;
+    const int64_t edges_num = task.start_indices.edge + mesh.edges_num;
+    const int64_t faces_num = task.start_indices.face + mesh.faces_num;
+    const int64_t corners_num = task.start_indices.loop + mesh.corners_num;
+    const OrderedAttributes &attributes = meshes.attributes;
+    bytes += verts_num * (sizeof(float3) +
+                          get_attributes_bytes_per_element(attributes, AttrDomain::Point));
+    bytes += edges_num *
+             (sizeof(int2) + get_attributes_bytes_per_element(attributes, AttrDomain::Edge));
+    bytes += faces_num *
+             (sizeof(int) + get_attributes_bytes_per_element(attributes, AttrDomain::Face));
+    bytes += corners_num * (2 * sizeof(int) + get_attributes_bytes_per_element(
+                                                  attributes, AttrDomain::Corner));
+  }
+  if (!tasks.curve_tasks.is_empty()) {
+    const RealizeCurveTask &task = tasks.curve_tasks.last();
+    const ::CurvesGeometry &src_curves = task.curve_info->curves->geometry;
+    const int64_t points_num = task.start_indices.point + src_curves.point_num;
+    const int64_t curves_num = task.start_indices.curve + src_curves.curve_num;
+    bytes += points_num * (sizeof(float3) + get_attributes_bytes_per_element(
+                                                curves.attributes, AttrDomain::Point));
+    bytes += curves_num * (sizeof(int) + get_attributes_bytes_per_element(curves.attributes,
+                                                                          AttrDomain::Curve));
+  }
+  return bytes;
+}
+
 static bool skip_transform(const float4x4 &transform)
 {
   return math::is_equal(transform, float4x4::identity(), 1e-6f);
@@ -2484,7 +2545,8 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
 
 bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
                                    const RealizeInstancesOptions &options,
-                                   const VariedDepthOptions &varied_depth_option)
+                                   const VariedDepthOptions &varied_depth_option,
+                                   RealizeInstancesReport *r_report)
 {
   /* The algorithm works in three steps:
    * 1. Preprocess each unique geometry that is instanced (e.g. each `Mesh`).
@@ -2497,6 +2559,13 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
     return geometry_set;
   }
 
+  /* Preparing the tasks modifies the geometry, so keep the input to return it unchanged when the
+   * memory limit is exceeded. This is cheap because the data is shared. */
+  bke::GeometrySet input_geometry_set;
+  if (options.memory_limit > 0) {
+    input_geometry_set = geometry_set;
+  }
+
   bke::GeometrySet not_to_realize_set;
   propagate_instances_to_keep(
       geometry_set, varied_depth_option.selection, not_to_realize_set, options.attribute_filter);
@@ -2543,6 +2612,18 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
   gather_realize_tasks_recursive(
       gather_info, 0, VariedDepthOptions::MAX_DEPTH, geometry_set, transform, attribute_fallbacks);
 
+  const int64_t estimated_bytes = estimate_realized_bytes(
+      gather_info.r_tasks, all_pointclouds_info, all_meshes_info, all_curves_info);
+  if (r_report) {
+    r_report->estimated_bytes = estimated_bytes;
+  }
+  if (options.memory_limit > 0 && estimated_bytes > options.memory_limit) {
+    if (r_report) {
+      r_report->memory_limit_exceeded = true;
+    }
+    return input_geometry_set;
+  }
+
   bke::GeometrySet new_geometry_set;
   execute_instances_tasks(gather_info.instances.instances_components_to_merge,
                           gather_info.instances.instances_components_transforms,
@@ -2553,7 +2634,7 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
   const int64_t total_points_num = get_final_points_num(gather_info.r_tasks);
   /* This doesn't have to be exact at all, it's just a rough estimate to make decisions about
    * multi-threading (overhead). */
-  const int64_t approximate_used_bytes_num = total_points_num * 32;
+  const int64_t approximate_used_bytes_num = std::max(total_points_num * 32, estimated_bytes);
   threading::memory_bandwidth_bound_task(approximate_used_bytes_num, [&]() {
     execute_realize_pointcloud_tasks(options,
                                      all_pointclouds_info,
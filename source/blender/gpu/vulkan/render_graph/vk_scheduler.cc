@@ -11,6 +11,7 @@
 #include "vk_render_graph.hh"
 #include "vk_scheduler.hh"
 
+#include "BLI_array_utils.hh"
 #include "BLI_index_range.hh"
 #include "BLI_set.hh"
 
@@ -18,10 +19,8 @@ namespace blender::gpu::render_graph {
 
 Span<NodeHandle> VKScheduler::select_nodes(const VKRenderGraph &render_graph)
 {
-  result_.clear();
-  for (NodeHandle node_handle : render_graph.nodes_.index_range()) {
-    result_.append(node_handle);
-  }
+  result_.resize(render_graph.nodes_.size());
+  array_utils::fill_index_range<NodeHandle>(result_);
   reorder_nodes(render_graph);
   return result_;
 }
@@ -95,6 +94,11 @@ void VKScheduler::move_initial_transfer_to_start(const VKRenderGraph &render_gra
     other_nodes.append(index);
   }
 
+  /* Nothing to reorder; the order of the other nodes is kept as is. */
+  if (data_transfers.is_empty()) {
+    return;
+  }
+
   MutableSpan<NodeHandle> store_data_transfers = result_.as_mutable_span().slice(
       0, data_transfers.size());
   MutableSpan<NodeHandle> store_other = result_.as_mutable_span().slice(data_transfers.size(),
@@ -328,7 +328,7 @@ class VKPipelinePool : public NonCopyable {
   void free_data();
 
   /**
-   * Read the static pipeline cache from cache file.
+   * Read the static and non-static pipeline caches from cache files.
    *
    * Pipeline caches requires blender to be build with `WITH_BUILDINFO` enabled . Between commits
    * shader modules can change and shader module identifiers cannot be used. We use the build info
@@ -344,7 +344,8 @@ class VKPipelinePool : public NonCopyable {
   void read_from_disk();
 
   /**
-   * Store the static pipeline cache to disk.
+   * Store the static and non-static pipeline caches to disk. The non-static cache contains the
+   * pipelines of material shaders, it isn't stored when it grows too large.
    *
    * Pipeline caches requires blender to be build with `WITH_BUILDINFO` enabled . Between commits
    * shader modules can change and shader module identifiers cannot be used. We use the build info
@@ -28,6 +28,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_color.h"
 #include "BLI_math_color.hh"
@@ -3491,13 +3492,18 @@ void IMB_colormanagement_processor_apply_byte(
    * but for now it's not so important.
    */
   BLI_assert(channels == 4);
-  float pixel[4];
+  /* Convert one row at a time so the OCIO processor is applied to a whole packed row instead of
+   * pixel by pixel, which is much faster. */
+  blender::Array<blender::float4> row(width);
   for (int y = 0; y < height; y++) {
+    uchar *row_buffer = buffer + channels * size_t(y) * width;
     for (int x = 0; x < width; x++) {
-      size_t offset = channels * (size_t(y) * width + x);
-      rgba_uchar_to_float(pixel, buffer + offset);
-      IMB_colormanagement_processor_apply_v4(cm_processor, pixel);
-      rgba_float_to_uchar(buffer + offset, pixel);
+      rgba_uchar_to_float(row[x], row_buffer + channels * x);
+    }
+    IMB_colormanagement_processor_apply(
+        cm_processor, reinterpret_cast<float *>(row.data()), width, 1, channels, false);
+    for (int x = 0; x < width; x++) {
+      rgba_float_to_uchar(row_buffer + channels * x, row[x]);
     }
   }
 }
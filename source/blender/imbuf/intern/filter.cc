@@ -6,11 +6,13 @@
  * \ingroup imbuf
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include "MEM_guardedalloc.h"
 
 #include "BLI_math_base.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "IMB_filter.hh"
@@ -332,50 +334,54 @@ void IMB_filter_extend(ImBuf *ibuf, char *mask, int filter)
   }
 }
 
-void IMB_premultiply_rect(uint8_t *rect, char planes, int w, int h)
+/* Run the given function for ranges of rows of an image with the given width, in parallel for
+ * large images. */
+template<typename Fn> static void parallel_for_rows(const int w, const int h, const Fn &fn)
 {
-  uint8_t *cp;
-  int x, y, val;
+  using namespace blender;
+  const int64_t grain_size = std::max<int64_t>(1, 64 * 1024 / std::max(w, 1));
+  threading::parallel_for(IndexRange(h), grain_size, fn);
+}
 
-  if (planes == 24) { /* put alpha at 255 */
-    cp = rect;
+void IMB_premultiply_rect(uint8_t *rect, char planes, int w, int h)
+{
+  parallel_for_rows(w, h, [&](const blender::IndexRange y_range) {
+    uint8_t *cp = rect + y_range.first() * size_t(w) * 4;
+    const int64_t pixels_num = y_range.size() * w;
 
-    for (y = 0; y < h; y++) {
-      for (x = 0; x < w; x++, cp += 4) {
+    if (planes == 24) { /* put alpha at 255 */
+      for (int64_t i = 0; i < pixels_num; i++, cp += 4) {
         cp[3] = 255;
       }
     }
-  }
-  else {
-    cp = rect;
-
-    for (y = 0; y < h; y++) {
-      for (x = 0; x < w; x++, cp += 4) {
-        val = cp[3];
+    else {
+      for (int64_t i = 0; i < pixels_num; i++, cp += 4) {
+        const int val = cp[3];
         cp[0] = (cp[0] * val) >> 8;
         cp[1] = (cp[1] * val) >> 8;
         cp[2] = (cp[2] * val) >> 8;
       }
     }
-  }
+  });
 }
 
 void IMB_premultiply_rect_float(float *rect_float, int channels, int w, int h)
 {
-  float val, *cp;
-  int x, y;
+  if (channels != 4) {
+    return;
+  }
 
-  if (channels == 4) {
-    cp = rect_float;
-    for (y = 0; y < h; y++) {
-      for (x = 0; x < w; x++, cp += 4) {
-        val = cp[3];
-        cp[0] = cp[0] * val;
-        cp[1] = cp[1] * val;
-        cp[2] = cp[2] * val;
-      }
+  parallel_for_rows(w, h, [&](const blender::IndexRange y_range) {
+    float *cp = rect_float + y_range.first() * size_t(w) * 4;
+    const int64_t pixels_num = y_range.size() * w;
+
+    for (int64_t i = 0; i < pixels_num; i++, cp += 4) {
+      const float val = cp[3];
+      cp[0] = cp[0] * val;
+      cp[1] = cp[1] * val;
+      cp[2] = cp[2] * val;
     }
-  }
+  });
 }
 
 void IMB_premultiply_alpha(ImBuf *ibuf)
@@ -395,49 +401,43 @@ void IMB_premultiply_alpha(ImBuf *ibuf)
 
 void IMB_unpremultiply_rect(uint8_t *rect, char planes, int w, int h)
 {
-  uchar *cp;
-  int x, y;
-  float val;
+  parallel_for_rows(w, h, [&](const blender::IndexRange y_range) {
+    uchar *cp = rect + y_range.first() * size_t(w) * 4;
+    const int64_t pixels_num = y_range.size() * w;
 
-  if (planes == 24) { /* put alpha at 255 */
-    cp = rect;
-
-    for (y = 0; y < h; y++) {
-      for (x = 0; x < w; x++, cp += 4) {
+    if (planes == 24) { /* put alpha at 255 */
+      for (int64_t i = 0; i < pixels_num; i++, cp += 4) {
         cp[3] = 255;
       }
     }
-  }
-  else {
-    cp = rect;
-
-    for (y = 0; y < h; y++) {
-      for (x = 0; x < w; x++, cp += 4) {
-        val = cp[3] != 0 ? 1.0f / float(cp[3]) : 1.0f;
+    else {
+      for (int64_t i = 0; i < pixels_num; i++, cp += 4) {
+        const float val = cp[3] != 0 ? 1.0f / float(cp[3]) : 1.0f;
         cp[0] = unit_float_to_uchar_clamp(cp[0] * val);
         cp[1] = unit_float_to_uchar_clamp(cp[1] * val);
         cp[2] = unit_float_to_uchar_clamp(cp[2] * val);
       }
     }
-  }
+  });
 }
 
 void IMB_unpremultiply_rect_float(float *rect_float, int channels, int w, int h)
 {
-  float val, *fp;
-  int x, y;
+  if (channels != 4) {
+    return;
+  }
 
-  if (channels == 4) {
-    fp = rect_float;
-    for (y = 0; y < h; y++) {
-      for (x = 0; x < w; x++, fp += 4) {
-        val = fp[3] != 0.0f ? 1.0f / fp[3] : 1.0f;
-        fp[0] = fp[0] * val;
-        fp[1] = fp[1] * val;
-        fp[2] = fp[2] * val;
-      }
+  parallel_for_rows(w, h, [&](const blender::IndexRange y_range) {
+    float *fp = rect_float + y_range.first() * size_t(w) * 4;
+    const int64_t pixels_num = y_range.size() * w;
+
+    for (int64_t i = 0; i < pixels_num; i++, fp += 4) {
+      const float val = fp[3] != 0.0f ? 1.0f / fp[3] : 1.0f;
+      fp[0] = fp[0] * val;
+      fp[1] = fp[1] * val;
+      fp[2] = fp[2] * val;
     }
-  }
+  });
 }
 
 void IMB_unpremultiply_alpha(ImBuf *ibuf)
@@ -10,6 +10,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "BKE_idprop.hh"
 
@@ -74,26 +75,32 @@ class ImBufMemWriter : public Filesystem::IOProxy {
 template<typename T>
 static void fill_all_channels(T *pixels, int width, int height, int components, T alpha)
 {
+  if (components == 4) {
+    return;
+  }
   const int64_t pixel_count = int64_t(width) * height;
-  if (components == 3) {
-    for (int64_t i = 0; i < pixel_count; i++) {
-      pixels[i * 4 + 3] = alpha;
+  /* Every pixel is expanded independently, huge images benefit from doing it in parallel. */
+  threading::parallel_for(IndexRange(pixel_count), 64 * 1024, [&](const IndexRange range) {
+    if (components == 3) {
+      for (const int64_t i : range) {
+        pixels[i * 4 + 3] = alpha;
+      }
     }
-  }
-  else if (components == 1) {
-    for (int64_t i = 0; i < pixel_count; i++) {
-      pixels[i * 4 + 3] = alpha;
-      pixels[i * 4 + 2] = pixels[i * 4 + 0];
-      pixels[i * 4 + 1] = pixels[i * 4 + 0];
+    else if (components == 1) {
+      for (const int64_t i : range) {
+        pixels[i * 4 + 3] = alpha;
+        pixels[i * 4 + 2] = pixels[i * 4 + 0];
+        pixels[i * 4 + 1] = pixels[i * 4 + 0];
+      }
     }
-  }
-  else if (components == 2) {
-    for (int64_t i = 0; i < pixel_count; i++) {
-      pixels[i * 4 + 3] = pixels[i * 4 + 1];
-      pixels[i * 4 + 2] = pixels[i * 4 + 0];
-      pixels[i * 4 + 1] = pixels[i * 4 + 0];
+    else if (components == 2) {
+      for (const int64_t i : range) {
+        pixels[i * 4 + 3] = pixels[i * 4 + 1];
+        pixels[i * 4 + 2] = pixels[i * 4 + 0];
+        pixels[i * 4 + 1] = pixels[i * 4 + 0];
+      }
     }
-  }
+  });
 }
 
 template<typename T>
@@ -85,6 +85,7 @@
 #include "BLI_mmap.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 
 #include "BKE_idprop.hh"
@@ -1138,9 +1139,13 @@ void IMB_exr_write_channels(void *handle)
       if (echan->use_half_float) {
         const float *rect = echan->rect;
         half *cur = current_rect_half;
-        for (size_t i = 0; i < num_pixels; i++, cur++) {
-          *cur = float_to_half_safe(rect[i * echan->xstride]);
-        }
+        const int xstride = echan->xstride;
+        blender::threading::parallel_for(
+            blender::IndexRange(int64_t(num_pixels)), 65536, [&](const blender::IndexRange range) {
+              for (const int64_t i : range) {
+                cur[i] = float_to_half_safe(rect[i * xstride]);
+              }
+            });
         half *rect_to_write = current_rect_half + (data->height - 1L) * data->width;
         frameBuffer.insert(
             echan->name,
@@ -1239,6 +1244,11 @@ void IMB_exr_read_channels(void *handle)
       }
     }
 
+    /* Don't decode parts none of the requested channels are stored in. */
+    if (frameBuffer.begin() == frameBuffer.end()) {
+      continue;
+    }
+
     /* Read pixels. */
     try {
       in.setFrameBuffer(frameBuffer);
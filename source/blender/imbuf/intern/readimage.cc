@@ -12,6 +12,8 @@
 #  include <io.h>
 #  include <stddef.h>
 #  include <sys/types.h>
+#else
+#  include <fcntl.h>
 #endif
 
 #include "BLI_fileops.h"
@@ -158,6 +160,16 @@ ImBuf *IMB_load_image_from_file_descriptor(const int file,
     return nullptr;
   }
 
+#ifdef POSIX_FADV_WILLNEED
+  /* The decoders usually read the whole file, have the OS read it ahead asynchronously instead of
+   * faulting in the mapped pages one at a time as decoding progresses. This is a hint only, a
+   * failure is harmless. Testing the format and loading thumbnails often only read the header or
+   * a small part of the file, so reading ahead would waste I/O there. */
+  if ((flags & (IB_test | IB_thumbnail)) == 0) {
+    posix_fadvise(file, 0, 0, POSIX_FADV_WILLNEED);
+  }
+#endif
+
   imb_mmap_lock();
   BLI_mmap_file *mmap_file = BLI_mmap_open(file);
   imb_mmap_unlock();
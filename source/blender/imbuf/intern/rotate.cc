@@ -7,6 +7,8 @@
  * \ingroup imbuf
  */
 
+#include <algorithm>
+
 #include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
@@ -89,97 +91,61 @@ bool IMB_rotate_orthogonal(ImBuf *ibuf, int degrees)
   return true;
 }
 
-void IMB_flipy(ImBuf *ibuf)
+template<typename T>
+static void flip_pixels_y(T *pixels, const int size_x, const int size_y, const int channels)
 {
-  size_t x_size, y_size;
+  using namespace blender;
+  const int64_t row_size = int64_t(size_x) * channels;
+  threading::parallel_for(IndexRange(size_y / 2), 128, [&](const IndexRange y_range) {
+    for (const int64_t y : y_range) {
+      T *top = pixels + y * row_size;
+      T *bottom = pixels + (size_y - 1 - y) * row_size;
+      std::swap_ranges(top, top + row_size, bottom);
+    }
+  });
+}
 
+template<typename T>
+static void flip_pixels_x(T *pixels, const int size_x, const int size_y, const int channels)
+{
+  using namespace blender;
+  const int64_t row_size = int64_t(size_x) * channels;
+  threading::parallel_for(IndexRange(size_y), 64, [&](const IndexRange y_range) {
+    for (const int64_t y : y_range) {
+      T *row = pixels + y * row_size;
+      for (int xl = 0, xr = size_x - 1; xl < xr; xl++, xr--) {
+        std::swap_ranges(row + xl * channels, row + (xl + 1) * channels, row + xr * channels);
+      }
+    }
+  });
+}
+
+void IMB_flipy(ImBuf *ibuf)
+{
   if (ibuf == nullptr) {
     return;
   }
 
   if (ibuf->byte_buffer.data) {
-    uint *top, *bottom, *line;
-
-    x_size = ibuf->x;
-    y_size = ibuf->y;
-
-    const size_t stride = x_size * sizeof(int);
-
-    top = (uint *)ibuf->byte_buffer.data;
-    bottom = top + ((y_size - 1) * x_size);
-    line = MEM_malloc_arrayN<uint>(x_size, "linebuf");
-
-    y_size >>= 1;
-
-    for (; y_size > 0; y_size--) {
-      memcpy(line, top, stride);
-      memcpy(top, bottom, stride);
-      memcpy(bottom, line, stride);
-      bottom -= x_size;
-      top += x_size;
-    }
-
-    MEM_freeN(line);
+    flip_pixels_y((uint *)ibuf->byte_buffer.data, ibuf->x, ibuf->y, 1);
   }
 
   if (ibuf->float_buffer.data) {
-    float *topf = nullptr, *bottomf = nullptr, *linef = nullptr;
-
-    x_size = ibuf->x;
-    y_size = ibuf->y;
-
-    const size_t stride = x_size * 4 * sizeof(float);
-
-    topf = ibuf->float_buffer.data;
-    bottomf = topf + 4 * ((y_size - 1) * x_size);
-    linef = MEM_malloc_arrayN<float>(4 * x_size, "linebuf");
-
-    y_size >>= 1;
-
-    for (; y_size > 0; y_size--) {
-      memcpy(linef, topf, stride);
-      memcpy(topf, bottomf, stride);
-      memcpy(bottomf, linef, stride);
-      bottomf -= 4 * x_size;
-      topf += 4 * x_size;
-    }
-
-    MEM_freeN(linef);
+    flip_pixels_y(ibuf->float_buffer.data, ibuf->x, ibuf->y, 4);
   }
 }
 
 void IMB_flipx(ImBuf *ibuf)
 {
-  int x, y, xr, xl, yi;
-  float px_f[4];
-
   if (ibuf == nullptr) {
     return;
   }
 
-  x = ibuf->x;
-  y = ibuf->y;
-
   if (ibuf->byte_buffer.data) {
-    uint *rect = (uint *)ibuf->byte_buffer.data;
-    for (yi = y - 1; yi >= 0; yi--) {
-      const size_t x_offset = size_t(x) * yi;
-      for (xr = x - 1, xl = 0; xr >= xl; xr--, xl++) {
-        std::swap(rect[x_offset + xr], rect[x_offset + xl]);
-      }
-    }
+    flip_pixels_x((uint *)ibuf->byte_buffer.data, ibuf->x, ibuf->y, 1);
   }
 
   if (ibuf->float_buffer.data) {
-    float *rect_float = ibuf->float_buffer.data;
-    for (yi = y - 1; yi >= 0; yi--) {
-      const size_t x_offset = size_t(x) * yi;
-      for (xr = x - 1, xl = 0; xr >= xl; xr--, xl++) {
-        memcpy(&px_f, &rect_float[(x_offset + xr) * 4], sizeof(float[4]));
-        memcpy(
-            &rect_float[(x_offset + xr) * 4], &rect_float[(x_offset + xl) * 4], sizeof(float[4]));
-        memcpy(&rect_float[(x_offset + xl) * 4], &px_f, sizeof(float[4]));
-      }
-    }
+    flip_pixels_x(ibuf->float_buffer.data, ibuf->x, ibuf->y, 4);
   }
 }
@@ -6,6 +6,7 @@
  * \ingroup imbuf
  */
 
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
 
@@ -411,10 +412,14 @@ void IMB_gpu_clamp_half_float(ImBuf *image_buffer)
 
   float *rect_float = image_buffer->float_buffer.data;
 
-  int rect_float_len = image_buffer->x * image_buffer->y *
-                       (image_buffer->channels == 0 ? 4 : image_buffer->channels);
+  const int64_t rect_float_len = int64_t(image_buffer->x) * int64_t(image_buffer->y) *
+                                 (image_buffer->channels == 0 ? 4 : image_buffer->channels);
 
-  for (int i = 0; i < rect_float_len; i++) {
-    rect_float[i] = clamp_f(rect_float[i], half_min, half_max);
-  }
+  /* This runs on every display update of float images and render results, so split the work. */
+  blender::threading::parallel_for(
+      blender::IndexRange(rect_float_len), 256 * 1024, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          rect_float[i] = clamp_f(rect_float[i], half_min, half_max);
+        }
+      });
 }
@@ -19,6 +19,7 @@
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
@@ -858,9 +859,14 @@ static void index_rebuild_ffmpeg_proc_decoded_frame(MovieProxyBuilder *context,
   uint64_t s_dts = context->seek_pos_dts;
   uint64_t pts = av_get_pts_from_frame(in_frame);
 
-  for (i = 0; i < context->num_proxy_sizes; i++) {
-    add_to_proxy_output_ffmpeg(context->proxy_ctx[i], in_frame);
-  }
+  /* Each proxy size has its own scaler, encoder and output file, so they can be encoded
+   * concurrently from the same decoded frame. */
+  blender::threading::parallel_for(
+      blender::IndexRange(context->num_proxy_sizes), 1, [&](const blender::IndexRange range) {
+        for (const int64_t proxy_i : range) {
+          add_to_proxy_output_ffmpeg(context->proxy_ctx[proxy_i], in_frame);
+        }
+      });
 
   if (!context->start_pts_set) {
     context->start_pts = pts;
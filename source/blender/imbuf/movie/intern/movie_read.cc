@@ -349,7 +349,17 @@ static int startffmpeg(MovieReader *anim)
     pCodecCtx->thread_count = BLI_system_thread_count();
   }
 
-  if (pCodec->capabilities & AV_CODEC_CAP_FRAME_THREADS) {
+  /* Frame threading adds a delay of one frame per thread before the first decoded frame, which
+   * has to be paid again after every seek. Intra-only codecs (ProRes, DNxHD, MJPEG...) are mostly
+   * used for editing where every frame is a seek target, so prefer slice threading for them. */
+  const AVCodecDescriptor *codec_descriptor = avcodec_descriptor_get(pCodec->id);
+  const bool is_intra_only = codec_descriptor != nullptr &&
+                             (codec_descriptor->props & AV_CODEC_PROP_INTRA_ONLY) != 0;
+
+  if (is_intra_only && (pCodec->capabilities & AV_CODEC_CAP_SLICE_THREADS)) {
+    pCodecCtx->thread_type = FF_THREAD_SLICE;
+  }
+  else if (pCodec->capabilities & AV_CODEC_CAP_FRAME_THREADS) {
     pCodecCtx->thread_type = FF_THREAD_FRAME;
   }
   else if (pCodec->capabilities & AV_CODEC_CAP_SLICE_THREADS) {
@@ -22,6 +22,7 @@
 #include "BLI_map.hh"
 #include "BLI_math_vector.h"
 #include "BLI_ordered_edge.hh"
+#include "BLI_task.hh"
 
 #include "BLT_translation.hh"
 
@@ -130,14 +131,16 @@ static void read_mverts_interp(float3 *vert_positions,
                                const P3fArraySamplePtr &ceil_positions,
                                const double weight)
 {
-  float tmp[3];
-  for (int i = 0; i < positions->size(); i++) {
-    const Imath::V3f &floor_pos = (*positions)[i];
-    const Imath::V3f &ceil_pos = (*ceil_positions)[i];
-
-    interp_v3_v3v3(tmp, floor_pos.getValue(), ceil_pos.getValue(), float(weight));
-    copy_zup_from_yup(vert_positions[i], tmp);
-  }
+  threading::parallel_for(IndexRange(positions->size()), 4096, [&](const IndexRange range) {
+    float tmp[3];
+    for (const int64_t i : range) {
+      const Imath::V3f &floor_pos = (*positions)[i];
+      const Imath::V3f &ceil_pos = (*ceil_positions)[i];
+
+      interp_v3_v3v3(tmp, floor_pos.getValue(), ceil_pos.getValue(), float(weight));
+      copy_zup_from_yup(vert_positions[i], tmp);
+    }
+  });
 }
 
 static void read_mverts(CDStreamConfig &config, const AbcMeshData &mesh_data)
@@ -162,19 +165,23 @@ static void read_mverts(CDStreamConfig &config, const AbcMeshData &mesh_data)
 void read_mverts(Mesh &mesh, const P3fArraySamplePtr positions, const N3fArraySamplePtr normals)
 {
   MutableSpan<float3> vert_positions = mesh.vert_positions_for_write();
-  for (int i = 0; i < positions->size(); i++) {
-    Imath::V3f pos_in = (*positions)[i];
+  threading::parallel_for(IndexRange(positions->size()), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      Imath::V3f pos_in = (*positions)[i];
 
-    copy_zup_from_yup(vert_positions[i], pos_in.getValue());
-  }
+      copy_zup_from_yup(vert_positions[i], pos_in.getValue());
+    }
+  });
   mesh.tag_positions_changed();
 
   if (normals) {
     Vector<float3> vert_normals(mesh.verts_num);
-    for (const int64_t i : IndexRange(normals->size())) {
-      Imath::V3f nor_in = (*normals)[i];
-      copy_zup_from_yup(vert_normals[i], nor_in.getValue());
-    }
+    threading::parallel_for(IndexRange(normals->size()), 4096, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        Imath::V3f nor_in = (*normals)[i];
+        copy_zup_from_yup(vert_normals[i], nor_in.getValue());
+      }
+    });
     bke::mesh_vert_normals_assign(mesh, std::move(vert_normals));
   }
 }
@@ -6,6 +6,7 @@
  * \ingroup csv
  */
 
+#include <algorithm>
 #include <atomic>
 #include <charconv>
 #include <optional>
@@ -282,6 +283,10 @@ PointCloud *import_csv_as_pointcloud(const CSVImportParams &import_params)
   Array<ColumnInfo> columns_info;
   csv_parse::CsvParseOptions parse_options;
   parse_options.delimiter = import_params.delimiter;
+  /* Use bigger chunks for big files. There is still enough parallelism, and there is less
+   * per-chunk overhead when parsing the records and flattening the columns afterwards. */
+  parse_options.chunk_size_bytes = std::clamp<int64_t>(
+      int64_t(buffer_len) / 1024, parse_options.chunk_size_bytes, 4 * 1024 * 1024);
 
   const auto parse_header = [&](const csv_parse::CsvRecord &record) {
     columns_info.reinitialize(record.size());
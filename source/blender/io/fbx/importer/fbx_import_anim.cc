@@ -22,6 +22,7 @@
 #include "BLI_math_quaternion.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
 
@@ -251,6 +252,47 @@ static void create_transform_curve_desc(const FbxElementMapping &mapping,
   }
 }
 
+static void get_transform_input_curves(const ElementAnimations &anim,
+                                       const ufbx_anim_curve *r_input_curves[9])
+{
+  for (int i = 0; i < 9; i++) {
+    r_input_curves[i] = nullptr;
+  }
+  if (anim.prop_position) {
+    r_input_curves[0] = anim.prop_position->anim_value->curves[0];
+    r_input_curves[1] = anim.prop_position->anim_value->curves[1];
+    r_input_curves[2] = anim.prop_position->anim_value->curves[2];
+  }
+  if (anim.prop_rotation) {
+    r_input_curves[3] = anim.prop_rotation->anim_value->curves[0];
+    r_input_curves[4] = anim.prop_rotation->anim_value->curves[1];
+    r_input_curves[5] = anim.prop_rotation->anim_value->curves[2];
+  }
+  if (anim.prop_scale) {
+    r_input_curves[6] = anim.prop_scale->anim_value->curves[0];
+    r_input_curves[7] = anim.prop_scale->anim_value->curves[1];
+    r_input_curves[8] = anim.prop_scale->anim_value->curves[2];
+  }
+}
+
+/* Hack: force cubic keyframes to be linear, to match Python importer behavior. This modifies the
+ * keyframes of the imported FBX data, which is also read when evaluating the transforms, so it is
+ * done in a serial pass before the transform curves are evaluated in parallel. */
+static void force_linear_transform_keyframes(const ElementAnimations &anim)
+{
+  const ufbx_anim_curve *input_curves[9];
+  get_transform_input_curves(anim, input_curves);
+  for (int i = 0; i < 9; i++) {
+    if (input_curves[i] != nullptr) {
+      for (const ufbx_keyframe &key : input_curves[i]->keyframes) {
+        if (key.interpolation == UFBX_INTERPOLATION_CUBIC) {
+          const_cast<ufbx_keyframe &>(key).interpolation = UFBX_INTERPOLATION_LINEAR;
+        }
+      }
+    }
+  }
+}
+
 static void create_transform_curve_data(const FbxElementMapping &mapping,
                                         const ufbx_anim *fbx_anim,
                                         const ElementAnimations &anim,
@@ -302,32 +344,14 @@ static void create_transform_curve_data(const FbxElementMapping &mapping,
    * Also, we create a full transform keyframe at any point where input pos/rot/scale curves have
    * a keyframe. It should not be needed if we fully imported curves with all their proper
    * handles, but again currently this is to match Python importer behavior. */
-  const ufbx_anim_curve *input_curves[9] = {};
-  if (anim.prop_position) {
-    input_curves[0] = anim.prop_position->anim_value->curves[0];
-    input_curves[1] = anim.prop_position->anim_value->curves[1];
-    input_curves[2] = anim.prop_position->anim_value->curves[2];
-  }
-  if (anim.prop_rotation) {
-    input_curves[3] = anim.prop_rotation->anim_value->curves[0];
-    input_curves[4] = anim.prop_rotation->anim_value->curves[1];
-    input_curves[5] = anim.prop_rotation->anim_value->curves[2];
-  }
-  if (anim.prop_scale) {
-    input_curves[6] = anim.prop_scale->anim_value->curves[0];
-    input_curves[7] = anim.prop_scale->anim_value->curves[1];
-    input_curves[8] = anim.prop_scale->anim_value->curves[2];
-  }
+  const ufbx_anim_curve *input_curves[9];
+  get_transform_input_curves(anim, input_curves);
 
   /* Figure out timestamps of where any of input curves have a keyframe. */
   Set<double> unique_key_times;
   for (int i = 0; i < 9; i++) {
     if (input_curves[i] != nullptr) {
       for (const ufbx_keyframe &key : input_curves[i]->keyframes) {
-        if (key.interpolation == UFBX_INTERPOLATION_CUBIC) {
-          /* Hack: force cubic keyframes to be linear, to match Python importer behavior. */
-          const_cast<ufbx_keyframe &>(key).interpolation = UFBX_INTERPOLATION_LINEAR;
-        }
         unique_key_times.add(key.time);
       }
     }
@@ -571,17 +595,30 @@ void import_animations(Main &bmain,
           transform_curves = channelbag.fcurve_create_many(nullptr, curve_desc.as_span());
         }
 
-        for (const int64_t index : id_anims.index_range()) {
-          const ElementAnimations *anim = id_anims[index];
+        for (const ElementAnimations *anim : id_anims) {
           if (anim->prop_position || anim->prop_rotation || anim->prop_scale) {
-            create_transform_curve_data(mapping,
-                                        flayer->anim,
-                                        *anim,
-                                        fps,
-                                        anim_offset,
-                                        transform_curves.data() +
-                                            anim_transform_curve_index[index]);
+            force_linear_transform_keyframes(*anim);
+          }
+        }
+
+        /* Transform curves already exist, so their keys can be evaluated in parallel. */
+        threading::parallel_for(id_anims.index_range(), 1, [&](const IndexRange range) {
+          for (const int64_t index : range) {
+            const ElementAnimations *anim = id_anims[index];
+            if (anim->prop_position || anim->prop_rotation || anim->prop_scale) {
+              create_transform_curve_data(mapping,
+                                          flayer->anim,
+                                          *anim,
+                                          fps,
+                                          anim_offset,
+                                          transform_curves.data() +
+                                              anim_transform_curve_index[index]);
+            }
           }
+        });
+
+        for (const int64_t index : id_anims.index_range()) {
+          const ElementAnimations *anim = id_anims[index];
           if (anim->prop_focal_length || anim->prop_focus_dist) {
             create_camera_curves(fbx.metadata, *anim, channelbag, fps, anim_offset);
           }
@@ -593,9 +630,11 @@ void import_animations(Main &bmain,
           }
         }
 
-        for (FCurve *curve : transform_curves) {
-          finalize_curve(curve);
-        }
+        threading::parallel_for(transform_curves.index_range(), 64, [&](const IndexRange range) {
+          for (FCurve *curve : transform_curves.as_span().slice(range)) {
+            finalize_curve(curve);
+          }
+        });
       }
     }
   }
@@ -10,36 +10,67 @@
 #include "ply_data.hh"
 #include "ply_file_buffer.hh"
 
+#include "BLI_array.hh"
+#include "BLI_math_base.h"
 #include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 
 namespace blender::io::ply {
 
-void write_vertices(FileBuffer &buffer, const PlyData &ply_data)
+static void write_vertex(FileBuffer &buffer, const PlyData &ply_data, const int i)
 {
-  for (int i = 0; i < ply_data.vertices.size(); i++) {
-    buffer.write_vertex(ply_data.vertices[i].x, ply_data.vertices[i].y, ply_data.vertices[i].z);
+  buffer.write_vertex(ply_data.vertices[i].x, ply_data.vertices[i].y, ply_data.vertices[i].z);
 
-    if (!ply_data.vertex_normals.is_empty()) {
-      buffer.write_vertex_normal(ply_data.vertex_normals[i].x,
-                                 ply_data.vertex_normals[i].y,
-                                 ply_data.vertex_normals[i].z);
-    }
+  if (!ply_data.vertex_normals.is_empty()) {
+    buffer.write_vertex_normal(ply_data.vertex_normals[i].x,
+                               ply_data.vertex_normals[i].y,
+                               ply_data.vertex_normals[i].z);
+  }
 
-    if (!ply_data.vertex_colors.is_empty()) {
-      /* PLY colors currently are exported as bytes, make sure inputs are clamped. */
-      float4 color = math::clamp(ply_data.vertex_colors[i], 0.0f, 1.0f) * 255.0f;
-      buffer.write_vertex_color(uchar(color.x), uchar(color.y), uchar(color.z), uchar(color.w));
-    }
+  if (!ply_data.vertex_colors.is_empty()) {
+    /* PLY colors currently are exported as bytes, make sure inputs are clamped. */
+    float4 color = math::clamp(ply_data.vertex_colors[i], 0.0f, 1.0f) * 255.0f;
+    buffer.write_vertex_color(uchar(color.x), uchar(color.y), uchar(color.z), uchar(color.w));
+  }
 
-    if (!ply_data.uv_coordinates.is_empty()) {
-      buffer.write_UV(ply_data.uv_coordinates[i].x, ply_data.uv_coordinates[i].y);
-    }
+  if (!ply_data.uv_coordinates.is_empty()) {
+    buffer.write_UV(ply_data.uv_coordinates[i].x, ply_data.uv_coordinates[i].y);
+  }
 
-    for (const PlyCustomAttribute &attr : ply_data.vertex_custom_attr) {
-      buffer.write_data(attr.data[i]);
-    }
+  for (const PlyCustomAttribute &attr : ply_data.vertex_custom_attr) {
+    buffer.write_data(attr.data[i]);
+  }
+
+  buffer.write_vertex_end();
+}
 
-    buffer.write_vertex_end();
+void write_vertices(FileBuffer &buffer, const PlyData &ply_data)
+{
+  /* Format chunks of vertices into separate buffers in parallel, then write them out in order.
+   * Only a limited number of chunks is kept in memory at once. */
+  const int chunk_size = 32 * 1024;
+  const int chunks_per_batch = 64;
+  const IndexRange all_vertices = ply_data.vertices.index_range();
+  for (int64_t batch_start = 0; batch_start < all_vertices.size();
+       batch_start += chunk_size * chunks_per_batch)
+  {
+    const IndexRange batch = all_vertices.drop_front(batch_start).take_front(chunk_size *
+                                                                             chunks_per_batch);
+    const int chunks_num = divide_ceil_u(batch.size(), chunk_size);
+    Array<std::unique_ptr<FileBuffer>> chunk_buffers(chunks_num);
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange chunks) {
+      for (const int chunk : chunks) {
+        const IndexRange range = batch.drop_front(chunk * chunk_size).take_front(chunk_size);
+        chunk_buffers[chunk] = buffer.create_memory_buffer();
+        for (const int i : range) {
+          write_vertex(*chunk_buffers[chunk], ply_data, i);
+        }
+      }
+    });
+    for (std::unique_ptr<FileBuffer> &chunk_buffer : chunk_buffers) {
+      buffer.append_buffer(*chunk_buffer);
+    }
+    buffer.write_to_file();
   }
   buffer.write_to_file();
 }
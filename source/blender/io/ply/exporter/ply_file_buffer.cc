@@ -27,6 +27,18 @@ FileBuffer::FileBuffer(const char *filepath, size_t buffer_chunk_size)
   }
 }
 
+FileBuffer::FileBuffer() : buffer_chunk_size_(64 * 1024), filepath_(nullptr), outfile_(nullptr)
+{
+}
+
+void FileBuffer::append_buffer(FileBuffer &other)
+{
+  for (VectorChar &b : other.blocks_) {
+    blocks_.append(std::move(b));
+  }
+  other.blocks_.clear();
+}
+
 void FileBuffer::write_to_file()
 {
   for (const VectorChar &b : blocks_) {
@@ -12,6 +12,8 @@
 #include "BLI_utility_mixins.hh"
 #include "BLI_vector.hh"
 
+#include <memory>
+
 /* SEP macro from BLI path utils clashes with SEP symbol in fmt headers. */
 #undef SEP
 #include <fmt/format.h>
@@ -35,6 +37,9 @@ class FileBuffer : private NonMovable {
  public:
   FileBuffer(const char *filepath, size_t buffer_chunk_size = 64 * 1024);
 
+  /* Buffer that is only kept in memory, to be appended to a file buffer later. */
+  FileBuffer();
+
   virtual ~FileBuffer() = default;
 
   /* Write contents to the buffer(s) into a file, and clear the buffers. */
@@ -42,6 +47,12 @@ class FileBuffer : private NonMovable {
 
   void close_file();
 
+  /* Create an empty in-memory buffer of the same format, used to format data in parallel. */
+  virtual std::unique_ptr<FileBuffer> create_memory_buffer() const = 0;
+
+  /* Move the contents of an in-memory buffer to the end of this one. */
+  void append_buffer(FileBuffer &other);
+
   virtual void write_vertex(float x, float y, float z) = 0;
 
   virtual void write_UV(float u, float v) = 0;
@@ -55,4 +55,9 @@ void FileBufferAscii::write_edge(int first, int second)
   write_fstring("{} {}", first, second);
   write_newline();
 }
+
+std::unique_ptr<FileBuffer> FileBufferAscii::create_memory_buffer() const
+{
+  return std::make_unique<FileBufferAscii>();
+}
 }  // namespace blender::io::ply
@@ -12,9 +12,11 @@
 
 #include "GEO_mesh_merge_by_distance.hh"
 
+#include "BLI_array_utils.hh"
 #include "BLI_color.hh"
 #include "BLI_math_vector.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "ply_import_mesh.hh"
 
@@ -56,18 +58,22 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
     /* Fill in face data. */
     uint32_t offset = 0;
     for (const int i : data.face_sizes.index_range()) {
-      uint32_t size = data.face_sizes[i];
       face_offsets[i] = offset;
-      for (int j = 0; j < size; j++) {
-        uint32_t v = data.face_vertices[offset + j];
-        if (v >= mesh->verts_num) {
-          CLOG_WARN(&LOG, "Invalid PLY vertex index in face %i loop %i: %u", i, j, v);
-          v = 0;
+      offset += data.face_sizes[i];
+    }
+    threading::parallel_for(data.face_sizes.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        const int face_start = face_offsets[i];
+        for (int j = 0; j < data.face_sizes[i]; j++) {
+          uint32_t v = data.face_vertices[face_start + j];
+          if (v >= mesh->verts_num) {
+            CLOG_WARN(&LOG, "Invalid PLY vertex index in face %i loop %i: %u", i, j, v);
+            v = 0;
+          }
+          corner_verts[face_start + j] = data.face_vertices[face_start + j];
         }
-        corner_verts[offset + j] = data.face_vertices[offset + j];
       }
-      offset += size;
-    }
+    });
   }
 
   /* Vertex colors */
@@ -77,14 +83,14 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
         "Col", bke::AttrDomain::Point);
 
     if (params.vertex_colors == ePLYVertexColorMode::sRGB) {
-      for (const int i : data.vertex_colors.index_range()) {
-        srgb_to_linearrgb_v4(colors.span[i], data.vertex_colors[i]);
-      }
+      threading::parallel_for(data.vertex_colors.index_range(), 4096, [&](const IndexRange range) {
+        for (const int i : range) {
+          srgb_to_linearrgb_v4(colors.span[i], data.vertex_colors[i]);
+        }
+      });
     }
     else {
-      for (const int i : data.vertex_colors.index_range()) {
-        copy_v4_v4(colors.span[i], data.vertex_colors[i]);
-      }
+      colors.span.cast<float4>().copy_from(data.vertex_colors);
     }
     colors.finish();
     BKE_id_attributes_active_color_set(&mesh->id, "Col");
@@ -95,9 +101,9 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
   if (!data.uv_coordinates.is_empty()) {
     bke::SpanAttributeWriter<float2> uv_map = attributes.lookup_or_add_for_write_only_span<float2>(
         "UVMap", bke::AttrDomain::Corner);
-    for (const int i : data.face_vertices.index_range()) {
-      uv_map.span[i] = data.uv_coordinates[data.face_vertices[i]];
-    }
+    array_utils::gather(data.uv_coordinates.as_span(),
+                        data.face_vertices.as_span().cast<int>(),
+                        uv_map.span);
     uv_map.finish();
   }
 
@@ -8,6 +8,7 @@
 #include "BLI_math_quaternion_types.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_virtual_array.hh"
 
 #include "BKE_attribute.hh"
@@ -178,9 +179,12 @@ void copy_blender_buffer_to_primvar(const VArray<BlenderT> &buffer,
     }
     else {
       usd_data.resize(data.size());
-      for (const int i : data.index_range()) {
-        usd_data[i] = detail::convert_value<BlenderT, USDT>(data[i]);
-      }
+      USDT *usd_values = usd_data.data();
+      threading::parallel_for(data.index_range(), 4096, [&](const IndexRange range) {
+        for (const int i : range) {
+          usd_values[i] = detail::convert_value<BlenderT, USDT>(data[i]);
+        }
+      });
     }
   }
 
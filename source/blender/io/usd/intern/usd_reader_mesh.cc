@@ -267,28 +267,28 @@ bool USDMeshReader::read_faces(Mesh *mesh) const
   int loop_index = 0;
 
   for (int i = 0; i < face_counts_.size(); i++) {
-    const int face_size = face_counts_[i];
-
     face_offsets[i] = loop_index;
+    loop_index += face_counts_[i];
+  }
 
-    /* Polygons are always assumed to be smooth-shaded. If the mesh should be flat-shaded,
-     * this is encoded in custom loop normals. */
-
-    if (is_left_handed_) {
-      int loop_end_index = loop_index + (face_size - 1);
-      for (int f = 0; f < face_size; ++f, ++loop_index) {
-        corner_verts[loop_index] = face_indices_[loop_end_index - f];
-      }
-    }
-    else {
-      for (int f = 0; f < face_size; ++f, ++loop_index) {
-        corner_verts[loop_index] = face_indices_[loop_index];
+  /* Polygons are always assumed to be smooth-shaded. If the mesh should be flat-shaded,
+   * this is encoded in custom loop normals. */
+  const OffsetIndices<int> faces = mesh->faces();
+  if (is_left_handed_) {
+    threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+      for (const int i : range) {
+        const IndexRange face = faces[i];
+        for (const int j : face.index_range()) {
+          corner_verts[face[j]] = face_indices_[face.last(j)];
+        }
       }
-    }
+    });
+  }
+  else {
+    corner_verts.copy_from(Span(face_indices_.cdata(), face_indices_.size()));
   }
 
   /* Check for faces with duplicate vertex indices. These will require a mesh validate to fix. */
-  const OffsetIndices<int> faces = mesh->faces();
   const bool all_faces_ok = threading::parallel_reduce(
       faces.index_range(),
       1024,
@@ -378,29 +378,36 @@ void USDMeshReader::read_uv_data_primvar(Mesh *mesh,
     if (is_left_handed_) {
       /* Reverse the index order. */
       const OffsetIndices faces = mesh->faces();
-      for (const int i : faces.index_range()) {
-        const IndexRange face = faces[i];
-        for (int j : face.index_range()) {
-          const int rev_index = face.last(j);
-          uv_data.span[face.start() + j] = float2(usd_uvs[rev_index][0], usd_uvs[rev_index][1]);
+      threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+        for (const int i : range) {
+          const IndexRange face = faces[i];
+          for (int j : face.index_range()) {
+            const int rev_index = face.last(j);
+            uv_data.span[face.start() + j] = float2(usd_uvs[rev_index][0],
+                                                    usd_uvs[rev_index][1]);
+          }
         }
-      }
+      });
     }
     else {
-      for (int i = 0; i < uv_data.span.size(); ++i) {
-        uv_data.span[i] = float2(usd_uvs[i][0], usd_uvs[i][1]);
-      }
+      threading::parallel_for(uv_data.span.index_range(), 4096, [&](const IndexRange range) {
+        for (const int i : range) {
+          uv_data.span[i] = float2(usd_uvs[i][0], usd_uvs[i][1]);
+        }
+      });
     }
   }
   else {
     /* Handle vertex interpolation. */
     const Span<int> corner_verts = mesh->corner_verts();
     BLI_assert(mesh->verts_num == usd_uvs.size());
-    for (int i = 0; i < uv_data.span.size(); ++i) {
-      /* Get the vertex index for this corner. */
-      int vi = corner_verts[i];
-      uv_data.span[i] = float2(usd_uvs[vi][0], usd_uvs[vi][1]);
-    }
+    threading::parallel_for(uv_data.span.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        /* Get the vertex index for this corner. */
+        int vi = corner_verts[i];
+        uv_data.span[i] = float2(usd_uvs[vi][0], usd_uvs[vi][1]);
+      }
+    });
   }
 
   uv_data.finish();
@@ -631,22 +638,25 @@ void USDMeshReader::process_normals_face_varying(Mesh *mesh) const
   Array<float3> corner_normals(mesh->corners_num);
 
   const OffsetIndices faces = mesh->faces();
-  for (const int i : faces.index_range()) {
-    const IndexRange face = faces[i];
-    for (int j : face.index_range()) {
-      const int corner = face.start() + j;
-
-      int usd_index = face.start();
-      if (is_left_handed_) {
-        usd_index += face.size() - 1 - j;
-      }
-      else {
-        usd_index += j;
-      }
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const IndexRange face = faces[i];
+      for (int j : face.index_range()) {
+        const int corner = face.start() + j;
+
+        int usd_index = face.start();
+        if (is_left_handed_) {
+          usd_index += face.size() - 1 - j;
+        }
+        else {
+          usd_index += j;
+        }
 
-      corner_normals[corner] = detail::convert_value<pxr::GfVec3f, float3>(normals_[usd_index]);
+        corner_normals[corner] = detail::convert_value<pxr::GfVec3f, float3>(
+            normals_[usd_index]);
+      }
     }
-  }
+  });
 
   bke::mesh_set_custom_normals(*mesh, corner_normals);
 }
@@ -668,11 +678,13 @@ void USDMeshReader::process_normals_uniform(Mesh *mesh) const
   Array<float3> corner_normals(mesh->corners_num);
 
   const OffsetIndices faces = mesh->faces();
-  for (const int i : faces.index_range()) {
-    for (const int corner : faces[i]) {
-      corner_normals[corner] = detail::convert_value<pxr::GfVec3f, float3>(normals_[i]);
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      corner_normals.as_mutable_span()
+          .slice(faces[i])
+          .fill(detail::convert_value<pxr::GfVec3f, float3>(normals_[i]));
     }
-  }
+  });
 
   bke::mesh_set_custom_normals(*mesh, corner_normals);
 }
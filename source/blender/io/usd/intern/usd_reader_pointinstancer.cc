@@ -16,6 +16,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_quaternion_types.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "DNA_collection_types.h"
 #include "DNA_node_types.h"
@@ -81,10 +82,9 @@ void USDPointInstancerReader::read_geometry(bke::GeometrySet &geometry_set,
     scales_attribute.span.fill(float3(1.0f));
   }
 
-  Span<pxr::GfVec3f> scales = Span(usd_scales.cdata(), usd_scales.size());
-  for (const int i : IndexRange(std::min(usd_scales.size(), usd_positions.size()))) {
-    scales_attribute.span[i] = float3(scales[i][0], scales[i][1], scales[i][2]);
-  }
+  const int64_t scales_num = std::min(usd_scales.size(), usd_positions.size());
+  scales_attribute.span.take_front(scales_num)
+      .copy_from(Span(usd_scales.cdata(), scales_num).cast<float3>());
 
   scales_attribute.finish();
 
@@ -97,12 +97,15 @@ void USDPointInstancerReader::read_geometry(bke::GeometrySet &geometry_set,
   }
 
   Span<pxr::GfQuath> orientations = Span(usd_orientations.cdata(), usd_orientations.size());
-  for (const int i : IndexRange(std::min(usd_orientations.size(), usd_positions.size()))) {
-    orientations_attribute.span[i] = math::Quaternion(orientations[i].GetReal(),
-                                                      orientations[i].GetImaginary()[0],
-                                                      orientations[i].GetImaginary()[1],
-                                                      orientations[i].GetImaginary()[2]);
-  }
+  const IndexRange orientations_range(std::min(usd_orientations.size(), usd_positions.size()));
+  threading::parallel_for(orientations_range, 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      orientations_attribute.span[i] = math::Quaternion(orientations[i].GetReal(),
+                                                        orientations[i].GetImaginary()[0],
+                                                        orientations[i].GetImaginary()[1],
+                                                        orientations[i].GetImaginary()[2]);
+    }
+  });
 
   orientations_attribute.finish();
 
@@ -113,10 +116,9 @@ void USDPointInstancerReader::read_geometry(bke::GeometrySet &geometry_set,
     proto_indices_attribute.span.fill(0);
   }
 
-  Span<int> proto_indices = Span(usd_proto_indices.cdata(), usd_proto_indices.size());
-  for (const int i : IndexRange(std::min(usd_proto_indices.size(), usd_positions.size()))) {
-    proto_indices_attribute.span[i] = proto_indices[i];
-  }
+  const int64_t proto_indices_num = std::min(usd_proto_indices.size(), usd_positions.size());
+  proto_indices_attribute.span.take_front(proto_indices_num)
+      .copy_from(Span(usd_proto_indices.cdata(), proto_indices_num));
 
   proto_indices_attribute.finish();
 
@@ -14,6 +14,7 @@
 #include "BLI_math_vector_types.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "IO_string_utils.hh"
@@ -70,29 +71,111 @@ static Geometry *create_geometry(Geometry *const prev_geometry,
   return new_geometry();
 }
 
-static void geom_add_vertex(const char *p, const char *end, GlobalVertices &r_global_vertices)
+/* If line starts with keyword followed by whitespace, returns true and drops it from the line. */
+static bool parse_keyword(const char *&p, const char *end, StringRef keyword)
 {
-  r_global_vertices.flush_mrgb_block();
-  float3 vert;
-  p = parse_floats(p, end, 0.0f, vert, 3);
-  r_global_vertices.vertices.append(vert);
+  const size_t keyword_len = keyword.size();
+  if (end - p < keyword_len + 1) {
+    return false;
+  }
+  if (memcmp(p, keyword.data(), keyword_len) != 0) {
+    return false;
+  }
+  /* Treat any ASCII control character as white-space;
+   * don't use `isspace()` for performance reasons. */
+  if (p[keyword_len] > ' ') {
+    return false;
+  }
+  p += keyword_len + 1;
+  return true;
+}
+
+/**
+ * Parse the position of a "v" line, and the optional `xyzrgb` color components following it.
+ * The color is left at -1 when the line has no extra components.
+ */
+static void parse_vertex_line(const char *p, const char *end, float3 &r_vert, float3 &r_srgb)
+{
+  p = parse_floats(p, end, 0.0f, r_vert, 3);
+  r_srgb = float3(-1.0f);
   /* OBJ extension: `xyzrgb` vertex colors, when the vertex position
    * is followed by 3 more RGB color components. See
    * http://paulbourke.net/dataformats/obj/colour.html */
   if (p < end) {
-    float3 srgb;
-    p = parse_floats(p, end, -1.0f, srgb, 3);
-    if (srgb.x >= 0 && srgb.y >= 0 && srgb.z >= 0) {
-      float3 linear;
-      srgb_to_linearrgb_v3_v3(linear, srgb);
-      r_global_vertices.set_vertex_color(r_global_vertices.vertices.size() - 1, linear);
+    parse_floats(p, end, -1.0f, r_srgb, 3);
+  }
+}
+
+static void geom_set_vertex_extra(const size_t index,
+                                  const float3 &srgb,
+                                  GlobalVertices &r_global_vertices)
+{
+  if (srgb.x >= 0 && srgb.y >= 0 && srgb.z >= 0) {
+    float3 linear;
+    srgb_to_linearrgb_v3_v3(linear, srgb);
+    r_global_vertices.set_vertex_color(index, linear);
+  }
+  else if (srgb.x > 0) {
+    /* Treats value in srgb.x as weight. */
+    r_global_vertices.set_vertex_weight(index, srgb.x);
+  }
+}
+
+static void geom_add_vertex(const char *p, const char *end, GlobalVertices &r_global_vertices)
+{
+  r_global_vertices.flush_mrgb_block();
+  float3 vert, srgb;
+  parse_vertex_line(p, end, vert, srgb);
+  r_global_vertices.vertices.append(vert);
+  geom_set_vertex_extra(r_global_vertices.vertices.size() - 1, srgb, r_global_vertices);
+}
+
+/**
+ * Add the "v" line that was just read, along with all the "v" lines directly following it in
+ * the buffer. Scanned meshes are mostly long runs of vertex positions, so these are parsed in
+ * parallel. Returns the number of extra lines consumed from the buffer.
+ */
+static size_t geom_add_vertex_run(const char *p,
+                                  const char *end,
+                                  StringRef &buffer_str,
+                                  GlobalVertices &r_global_vertices)
+{
+  Vector<StringRef> lines;
+  lines.append(StringRef(p, end));
+  while (!buffer_str.is_empty()) {
+    StringRef rest = buffer_str;
+    const StringRef line = read_next_line(rest);
+    const char *line_p = drop_whitespace(line.begin(), line.end());
+    if (!parse_keyword(line_p, line.end(), "v")) {
+      break;
     }
-    else if (srgb.x > 0) {
-      /* Treats value in srgb.x as weight. */
-      r_global_vertices.set_vertex_weight(r_global_vertices.vertices.size() - 1, srgb.x);
+    lines.append(StringRef(line_p, line.end()));
+    buffer_str = rest;
+  }
+
+  constexpr int64_t parallel_threshold = 1024;
+  if (lines.size() < parallel_threshold) {
+    for (const StringRef line : lines) {
+      geom_add_vertex(line.begin(), line.end(), r_global_vertices);
+    }
+    return lines.size() - 1;
+  }
+
+  r_global_vertices.flush_mrgb_block();
+  const int64_t start = r_global_vertices.vertices.size();
+  r_global_vertices.vertices.resize(start + lines.size());
+  MutableSpan<float3> verts = r_global_vertices.vertices.as_mutable_span().drop_front(start);
+  Array<float3> srgb(lines.size());
+  threading::parallel_for(lines.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      parse_vertex_line(lines[i].begin(), lines[i].end(), verts[i], srgb[i]);
     }
+  });
+  /* Colors and weights are rare and grow their arrays lazily, so set them serially. */
+  for (const int64_t i : lines.index_range()) {
+    geom_set_vertex_extra(start + i, srgb[i], r_global_vertices);
   }
-  UNUSED_VARS(p);
+  return lines.size() - 1;
 }
 
 static void geom_add_mrgb_colors(const char *p, const char *end, GlobalVertices &r_global_vertices)
@@ -445,25 +528,6 @@ OBJParser::~OBJParser()
   }
 }
 
-/* If line starts with keyword followed by whitespace, returns true and drops it from the line. */
-static bool parse_keyword(const char *&p, const char *end, StringRef keyword)
-{
-  const size_t keyword_len = keyword.size();
-  if (end - p < keyword_len + 1) {
-    return false;
-  }
-  if (memcmp(p, keyword.data(), keyword_len) != 0) {
-    return false;
-  }
-  /* Treat any ASCII control character as white-space;
-   * don't use `isspace()` for performance reasons. */
-  if (p[keyword_len] > ' ') {
-    return false;
-  }
-  p += keyword_len + 1;
-  return true;
-}
-
 /* Special case: if there were no faces/edges in any geometries,
  * treat all the vertices as a point cloud. */
 static void use_all_vertices_if_no_faces(Geometry *geom,
@@ -502,7 +566,7 @@ size_t OBJParser::parse_string_buffer(StringRef &buffer_str,
     /* Most common things that start with 'v': vertices, normals, UVs. */
     if (*p == 'v') {
       if (parse_keyword(p, end, "v")) {
-        geom_add_vertex(p, end, r_global_vertices);
+        read_lines_num += geom_add_vertex_run(p, end, buffer_str, r_global_vertices);
       }
       else if (parse_keyword(p, end, "vn")) {
         geom_add_vertex_normal(p, end, r_global_vertices);
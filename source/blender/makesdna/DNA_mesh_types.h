@@ -23,6 +23,8 @@
 #  include "BLI_memory_counter_fwd.hh"
 #  include "BLI_vector_set.hh"
 
+struct KDTree_3d;
+
 namespace blender {
 template<typename T> struct Bounds;
 namespace offset_indices {
@@ -442,6 +444,12 @@ typedef struct Mesh {
   blender::bke::BVHTreeFromMesh bvh_loose_no_hidden_verts() const;
   blender::bke::BVHTreeFromMesh bvh_loose_no_hidden_edges() const;
 
+  /**
+   * A balanced KD-tree of all vertex positions, using vertex indices as tree indices. It is cached
+   * and shared with other meshes that have the same positions.
+   */
+  const KDTree_3d &kdtree_verts() const;
+
   void count_memory(blender::MemoryCounter &memory) const;
 
   /** Call after changing vertex positions to tag lazily calculated caches for recomputation. */
@@ -23,6 +23,7 @@
 #endif
 
 #ifdef __cplusplus
+struct KDTree_3d;
 namespace blender {
 template<typename T> class Span;
 namespace bke {
@@ -84,6 +85,11 @@ typedef struct PointCloud {
   std::optional<int> material_index_max() const;
 
   blender::bke::BVHTreeFromPointCloud bvh_tree() const;
+  /**
+   * A balanced KD-tree of all point positions, using point indices as tree indices. It is cached
+   * and shared with other point clouds that have the same positions.
+   */
+  const KDTree_3d &kdtree() const;
 
   void count_memory(blender::MemoryCounter &memory) const;
 #endif
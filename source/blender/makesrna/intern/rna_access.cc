@@ -5086,8 +5086,35 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      /* Non-matching types when reading: convert directly from the raw array, using the same
+       * intermediate type as the RNA getters in the loop below so the result is identical.
+       * Booleans (which may be negated) and floats stored quantized as bytes are left to the
+       * getters, setting goes through the RNA setters which clamp to the property range. */
+      const bool use_raw_convert = !set &&
+                                   ((itemtype == PROP_INT) ||
+                                    (itemtype == PROP_FLOAT &&
+                                     ELEM(out.type, PROP_RAW_FLOAT, PROP_RAW_DOUBLE)));
+      if (use_raw_convert) {
+        char *outp = static_cast<char *>(out.array);
+        int a = 0;
+        for (int i = 0; i < out.len; i++, outp += out.stride) {
+          RawArray out_item = out;
+          out_item.array = outp;
+          for (int j = 0; j < item_len; j++, a++) {
+            if (itemtype == PROP_INT) {
+              int value;
+              RAW_GET(int, value, out_item, j);
+              RAW_SET(int, in, a, value);
+            }
+            else {
+              float value;
+              RAW_GET(float, value, out_item, j);
+              RAW_SET(float, in, a, value);
+            }
+          }
+        }
+        return 1;
+      }
     }
     BLI_assert_msg(array_len == 0 || itemtype != PROP_ENUM,
                    "Enum array properties should not exist");
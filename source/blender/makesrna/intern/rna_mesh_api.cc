@@ -36,6 +36,10 @@
 
 #  include "WM_api.hh"
 
+#  ifdef WITH_PYTHON
+#    include "BPY_extern.hh"
+#  endif
+
 static const char *rna_Mesh_unit_test_compare(Mesh *mesh, Mesh *mesh2, float threshold)
 {
   using namespace blender::bke::compare_geometry;
@@ -71,7 +75,15 @@ static void rna_Mesh_calc_tangents(Mesh *mesh, ReportList *reports, const char *
     CustomData_set_layer_flag(&mesh->corner_data, CD_MLOOPTANGENT, CD_FLAG_TEMPORARY);
   }
 
+#  ifdef WITH_PYTHON
+  BPy_BEGIN_ALLOW_THREADS;
+#  endif
+
   BKE_mesh_calc_loop_tangent_single(mesh, uvmap, r_looptangents, reports);
+
+#  ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#  endif
 }
 
 static void rna_Mesh_free_tangents(Mesh *mesh)
@@ -81,7 +93,15 @@ static void rna_Mesh_free_tangents(Mesh *mesh)
 
 static void rna_Mesh_calc_corner_tri(Mesh *mesh)
 {
+#  ifdef WITH_PYTHON
+  BPy_BEGIN_ALLOW_THREADS;
+#  endif
+
   mesh->corner_tris();
+
+#  ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#  endif
 }
 
 static void rna_Mesh_calc_smooth_groups(Mesh *mesh,
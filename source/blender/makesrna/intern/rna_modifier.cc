@@ -856,6 +856,7 @@ static const EnumPropertyItem grease_pencil_build_time_mode_items[] = {
 #  include "BKE_ocean.h"
 #  include "BKE_particle.h"
 
+#  include "BLI_fileops.h"
 #  include "BLI_sort_utils.h"
 #  include "BLI_string_utils.hh"
 
@@ -2016,6 +2017,24 @@ static int rna_NodesModifierWarning_type_get(PointerRNA *ptr)
   return int(warning->type);
 }
 
+static void rna_NodesModifier_debug_execution_chrome_trace(NodesModifierData *nmd,
+                                                           Main *bmain,
+                                                           ReportList *reports,
+                                                           const char *filepath)
+{
+  if (!nmd->runtime->eval_log) {
+    BKE_report(reports, RPT_ERROR, "No logged evaluation, the node editor has to show the tree");
+    return;
+  }
+  FILE *f = BLI_fopen(filepath, "w");
+  if (f == nullptr) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot open file '%s' for writing", filepath);
+    return;
+  }
+  nmd->runtime->eval_log->write_chrome_trace(*bmain, f);
+  fclose(f);
+}
+
 static IDProperty **rna_NodesModifier_properties(PointerRNA *ptr)
 {
   NodesModifierData *nmd = static_cast<NodesModifierData *>(ptr->data);
@@ -8067,6 +8086,8 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
 {
   StructRNA *srna;
   PropertyRNA *prop;
+  FunctionRNA *func;
+  PropertyRNA *parm;
 
   rna_def_modifier_nodes_data_block(brna);
 
@@ -8136,6 +8157,18 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
                                     nullptr);
   RNA_def_property_struct_type(prop, "NodesModifierWarning");
 
+  func = RNA_def_function(srna,
+                          "debug_execution_chrome_trace",
+                          "rna_NodesModifier_debug_execution_chrome_trace");
+  RNA_def_function_ui_description(
+      func,
+      "Write the node execution times of the last evaluation as a timeline in the Chrome trace "
+      "format (only available when the node editor logged the evaluation)");
+  RNA_def_function_flag(func, FUNC_USE_MAIN | FUNC_USE_REPORTS);
+  parm = RNA_def_string_file_path(
+      func, "filepath", nullptr, FILE_MAX, "File Name", "Output path for the trace file");
+  RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
+
   rna_def_modifier_panel_open_prop(
       srna, "open_output_attributes_panel", NODES_MODIFIER_PANEL_OUTPUT_ATTRIBUTES);
   rna_def_modifier_panel_open_prop(srna, "open_manage_panel", NODES_MODIFIER_PANEL_MANAGE);
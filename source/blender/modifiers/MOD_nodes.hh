@@ -28,6 +28,8 @@ void MOD_nodes_update_interface(Object *object, NodesModifierData *nmd);
 
 namespace blender {
 
+struct NodesModifierResultCache;
+
 struct NodesModifierRuntime {
   /**
    * Contains logged information from the last evaluation.
@@ -42,6 +44,11 @@ struct NodesModifierRuntime {
    * used by the evaluated modifier.
    */
   std::shared_ptr<bke::bake::ModifierCache> cache;
+  /**
+   * The result of the last evaluation, used to skip evaluating the node tree again when nothing
+   * it depends on has changed. Shared between the original and evaluated modifier like #cache.
+   */
+  std::shared_ptr<NodesModifierResultCache> result_cache;
 };
 
 void nodes_modifier_data_block_destruct(NodesModifierDataBlock *data_block, bool do_id_user);
@@ -6,6 +6,7 @@
  * \ingroup modifiers
  */
 
+#include <algorithm>
 #include <cstring>
 #include <fmt/format.h>
 #include <sstream>
@@ -98,6 +99,33 @@ namespace bake = blender::bke::bake;
 
 namespace blender {
 
+/**
+ * Stores the result of the last evaluation together with everything it was computed from. This
+ * allows skipping the evaluation when only something else changed, e.g. a modifier further down
+ * the stack.
+ */
+struct NodesModifierResultCache {
+  Mutex mutex;
+  /** Identifies the state of the node tree that was evaluated. */
+  uint64_t tree_build_id = 0;
+  std::unique_ptr<IDProperty, bke::idprop::IDPropertyDeleter> properties;
+  Set<ComputeContextHash> socket_log_contexts;
+  std::shared_ptr<geo_log::GeoNodesLog> eval_log;
+  /**
+   * The input geometry is kept to make sure that its implicitly shared data is not freed or
+   * modified while it is compared with the input of the next evaluation.
+   */
+  bke::GeometrySet input;
+  /**
+   * Shares its data with the geometry that is passed on to the rest of the modifier stack.
+   * Because of implicit sharing, changing that geometry later on (e.g. in a following modifier)
+   * only copies the arrays that are modified. So the cache only costs extra memory for modified
+   * data, which would have to be copied anyway when the cached result is reused.
+   */
+  bke::GeometrySet output;
+  bool is_valid = false;
+};
+
 static void init_data(ModifierData *md)
 {
   NodesModifierData *nmd = (NodesModifierData *)md;
@@ -108,6 +136,7 @@ static void init_data(ModifierData *md)
   MEMCPY_STRUCT_AFTER(nmd, DNA_struct_default_get(NodesModifierData), modifier);
   nmd->runtime = MEM_new<NodesModifierRuntime>(__func__);
   nmd->runtime->cache = std::make_shared<bake::ModifierCache>();
+  nmd->runtime->result_cache = std::make_shared<NodesModifierResultCache>();
 }
 
 static void find_dependencies_from_settings(const NodesModifierSettings &settings,
@@ -1808,6 +1837,200 @@ static void add_data_block_items_writeback(const ModifierEvalContext &ctx,
       });
 }
 
+/**
+ * Checks that the evaluation result only depends on data that is part of the cache key. Anything
+ * that references other data-blocks, the scene or the previous frame can't be cached this way.
+ */
+static bool result_cache_is_supported(const NodesModifierData &nmd,
+                                      const ModifierEvalContext &ctx,
+                                      const bNodeTree &tree,
+                                      const nodes::GeoNodesSideEffectNodes &side_effect_nodes)
+{
+  if (!DEG_is_active(ctx.depsgraph)) {
+    return false;
+  }
+  if (ctx.flag & (MOD_APPLY_TO_ORIGINAL | MOD_APPLY_ORCO)) {
+    return false;
+  }
+  /* Simulation and bake nodes have their own caches and depend on the previous frame. */
+  if (nmd.bakes_num > 0) {
+    return false;
+  }
+  /* Viewer and gizmo nodes have to be evaluated to update the editors. */
+  if (!side_effect_nodes.nodes_by_context.is_empty()) {
+    return false;
+  }
+  if (nmd.settings.properties) {
+    LISTBASE_FOREACH (const IDProperty *, property, &nmd.settings.properties->data.group) {
+      if (property->type == IDP_ID) {
+        return false;
+      }
+    }
+  }
+  const nodes::GeometryNodesEvalDependencies eval_deps =
+      nodes::gather_geometry_nodes_eval_dependencies_recursive(tree);
+  if (!eval_deps.ids.is_empty() || eval_deps.time_dependent || eval_deps.needs_own_transform ||
+      eval_deps.needs_active_camera || eval_deps.needs_scene_render_params)
+  {
+    return false;
+  }
+  return true;
+}
+
+static bool custom_data_is_shared(const CustomData &a, const CustomData &b)
+{
+  if (a.totlayer != b.totlayer) {
+    return false;
+  }
+  for (const int i : IndexRange(a.totlayer)) {
+    const CustomDataLayer &layer_a = a.layers[i];
+    const CustomDataLayer &layer_b = b.layers[i];
+    if (layer_a.type != layer_b.type || !STREQ(layer_a.name, layer_b.name)) {
+      return false;
+    }
+    if (layer_a.data != layer_b.data || layer_a.sharing_info != layer_b.sharing_info) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Returns true if all the data of the mesh is implicitly shared with other users already. Only
+ * then, keeping a reference to it in the cache does not force the node tree to copy data that it
+ * would otherwise modify in place.
+ */
+static bool custom_data_is_shared_elsewhere(const CustomData &data)
+{
+  for (const CustomDataLayer &layer : Span(data.layers, data.totlayer)) {
+    if (layer.data == nullptr) {
+      continue;
+    }
+    if (layer.sharing_info == nullptr || layer.sharing_info->is_mutable()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool mesh_is_shared_elsewhere(const Mesh &mesh)
+{
+  if (mesh.face_offset_indices) {
+    const ImplicitSharingInfo *sharing_info = mesh.runtime->face_offsets_sharing_info;
+    if (sharing_info == nullptr || sharing_info->is_mutable()) {
+      return false;
+    }
+  }
+  return custom_data_is_shared_elsewhere(mesh.vert_data) &&
+         custom_data_is_shared_elsewhere(mesh.edge_data) &&
+         custom_data_is_shared_elsewhere(mesh.face_data) &&
+         custom_data_is_shared_elsewhere(mesh.corner_data);
+}
+
+/**
+ * Compares the identity of the implicitly shared mesh data. Since the cache keeps a reference to
+ * the data, it can't be modified, so the same pointers also mean that the values are the same.
+ */
+static bool meshes_share_data(const Mesh &a, const Mesh &b)
+{
+  if (a.verts_num != b.verts_num || a.edges_num != b.edges_num || a.faces_num != b.faces_num ||
+      a.corners_num != b.corners_num)
+  {
+    return false;
+  }
+  if (a.face_offset_indices != b.face_offset_indices ||
+      a.runtime->face_offsets_sharing_info != b.runtime->face_offsets_sharing_info)
+  {
+    return false;
+  }
+  if (a.totcol != b.totcol || !std::equal(a.mat, a.mat + a.totcol, b.mat)) {
+    return false;
+  }
+  if (BLI_listbase_count(&a.vertex_group_names) != BLI_listbase_count(&b.vertex_group_names)) {
+    return false;
+  }
+  const bDeformGroup *group_b = static_cast<const bDeformGroup *>(b.vertex_group_names.first);
+  LISTBASE_FOREACH (const bDeformGroup *, group_a, &a.vertex_group_names) {
+    if (!STREQ(group_a->name, group_b->name)) {
+      return false;
+    }
+    group_b = group_b->next;
+  }
+  return custom_data_is_shared(a.vert_data, b.vert_data) &&
+         custom_data_is_shared(a.edge_data, b.edge_data) &&
+         custom_data_is_shared(a.face_data, b.face_data) &&
+         custom_data_is_shared(a.corner_data, b.corner_data);
+}
+
+/**
+ * Only empty geometries and geometries with just a mesh are supported currently, other geometry
+ * types are not compared.
+ */
+static bool geometry_is_cacheable(const bke::GeometrySet &geometry)
+{
+  const Vector<bke::GeometryComponent::Type> types = geometry.gather_component_types(true, true);
+  if (types.is_empty()) {
+    return true;
+  }
+  if (types.size() > 1 || types.first() != bke::GeometryComponent::Type::Mesh) {
+    return false;
+  }
+  return mesh_is_shared_elsewhere(*geometry.get_mesh());
+}
+
+static bool geometries_share_data(const bke::GeometrySet &a, const bke::GeometrySet &b)
+{
+  const Mesh *mesh_a = a.get_mesh();
+  const Mesh *mesh_b = b.get_mesh();
+  if (mesh_a == nullptr || mesh_b == nullptr) {
+    return mesh_a == mesh_b && a.is_empty() && b.is_empty();
+  }
+  return meshes_share_data(*mesh_a, *mesh_b);
+}
+
+static bool result_cache_matches(const NodesModifierResultCache &cache,
+                                 const NodesModifierData &nmd_orig,
+                                 const uint64_t tree_build_id,
+                                 const IDProperty *properties,
+                                 const Set<ComputeContextHash> &socket_log_contexts,
+                                 const bke::GeometrySet &input)
+{
+  if (!cache.is_valid || cache.tree_build_id != tree_build_id) {
+    return false;
+  }
+  if (cache.eval_log != nmd_orig.runtime->eval_log) {
+    return false;
+  }
+  if (cache.socket_log_contexts != socket_log_contexts) {
+    return false;
+  }
+  if (!IDP_EqualsProperties(cache.properties.get(), properties)) {
+    return false;
+  }
+  return geometries_share_data(cache.input, input);
+}
+
+static void store_result_cache(NodesModifierResultCache &cache,
+                               const uint64_t tree_build_id,
+                               const IDProperty *properties,
+                               Set<ComputeContextHash> socket_log_contexts,
+                               std::shared_ptr<geo_log::GeoNodesLog> eval_log,
+                               bke::GeometrySet input,
+                               const bke::GeometrySet &output)
+{
+  bke::GeometrySet cached_output = output;
+  cached_output.ensure_owns_direct_data();
+
+  std::lock_guard lock{cache.mutex};
+  cache.tree_build_id = tree_build_id;
+  cache.properties.reset(properties ? IDP_CopyProperty(properties) : nullptr);
+  cache.socket_log_contexts = std::move(socket_log_contexts);
+  cache.eval_log = std::move(eval_log);
+  cache.input = std::move(input);
+  cache.output = std::move(cached_output);
+  cache.is_valid = true;
+}
+
 static void modifyGeometry(ModifierData *md,
                            const ModifierEvalContext *ctx,
                            bke::GeometrySet &geometry_set)
@@ -1893,13 +2116,53 @@ static void modifyGeometry(ModifierData *md,
   find_side_effect_nodes(*nmd, *ctx, side_effect_nodes, socket_log_contexts);
   call_data.side_effect_nodes = &side_effect_nodes;
 
-  bke::ModifierComputeContext modifier_compute_context{nullptr, *nmd};
+  NodesModifierResultCache *result_cache = nullptr;
+  if (nmd->runtime->result_cache && geometry_is_cacheable(geometry_set) &&
+      result_cache_is_supported(*nmd, *ctx, tree, side_effect_nodes))
+  {
+    result_cache = nmd->runtime->result_cache.get();
+  }
+
+  bool is_cached = false;
+  if (result_cache) {
+    std::lock_guard lock{result_cache->mutex};
+    if (result_cache_matches(*result_cache,
+                             *nmd_orig,
+                             lf_graph_info->build_id,
+                             nmd->settings.properties,
+                             socket_log_contexts,
+                             geometry_set))
+    {
+      geometry_set = result_cache->output;
+      is_cached = true;
+    }
+  }
 
-  geometry_set = nodes::execute_geometry_nodes_on_geometry(
-      tree, properties, modifier_compute_context, call_data, std::move(geometry_set));
+  if (!is_cached) {
+    bke::GeometrySet cached_input;
+    if (result_cache) {
+      cached_input = geometry_set;
+      cached_input.ensure_owns_direct_data();
+    }
 
-  if (logging_enabled(ctx)) {
-    nmd_orig->runtime->eval_log = std::move(eval_log);
+    bke::ModifierComputeContext modifier_compute_context{nullptr, *nmd};
+
+    geometry_set = nodes::execute_geometry_nodes_on_geometry(
+        tree, properties, modifier_compute_context, call_data, std::move(geometry_set));
+
+    if (logging_enabled(ctx)) {
+      nmd_orig->runtime->eval_log = std::move(eval_log);
+    }
+
+    if (result_cache) {
+      store_result_cache(*result_cache,
+                         lf_graph_info->build_id,
+                         nmd->settings.properties,
+                         std::move(socket_log_contexts),
+                         nmd_orig->runtime->eval_log,
+                         std::move(cached_input),
+                         geometry_set);
+    }
   }
 
   if (DEG_is_active(ctx->depsgraph) && !(ctx->flag & MOD_APPLY_TO_ORIGINAL)) {
@@ -2105,6 +2368,7 @@ static void blend_read(BlendDataReader *reader, ModifierData *md)
 
   nmd->runtime = MEM_new<NodesModifierRuntime>(__func__);
   nmd->runtime->cache = std::make_shared<bake::ModifierCache>();
+  nmd->runtime->result_cache = std::make_shared<NodesModifierResultCache>();
 }
 
 static void copy_data(const ModifierData *md, ModifierData *target, const int flag)
@@ -2163,11 +2427,13 @@ static void copy_data(const ModifierData *md, ModifierData *target, const int fl
   if (flag & LIB_ID_COPY_SET_COPIED_ON_WRITE) {
     /* Share the simulation cache between the original and evaluated modifier. */
     tnmd->runtime->cache = nmd->runtime->cache;
+    tnmd->runtime->result_cache = nmd->runtime->result_cache;
     /* Keep bake path in the evaluated modifier. */
     tnmd->bake_directory = nmd->bake_directory ? BLI_strdup(nmd->bake_directory) : nullptr;
   }
   else {
     tnmd->runtime->cache = std::make_shared<bake::ModifierCache>();
+    tnmd->runtime->result_cache = std::make_shared<NodesModifierResultCache>();
     /* Clear the bake path when duplicating. */
     tnmd->bake_directory = nullptr;
   }
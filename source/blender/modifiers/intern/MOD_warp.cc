@@ -12,6 +12,7 @@
 
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -25,6 +26,7 @@
 #include "BKE_action.hh" /* BKE_pose_channel_find_name */
 #include "BKE_colortools.hh"
 #include "BKE_deform.hh"
+#include "BKE_image.hh"
 #include "BKE_lib_query.hh"
 #include "BKE_modifier.hh"
 #include "BKE_texture.h"
@@ -185,10 +187,8 @@ static void warpModifier_do(WarpModifierData *wmd,
 
   const float falloff_radius_sq = square_f(wmd->falloff_radius);
   float strength = wmd->strength;
-  float fac = 1.0f, weight;
-  int i;
   int defgrp_index;
-  const MDeformVert *dvert, *dv = nullptr;
+  const MDeformVert *dvert;
   const bool invert_vgroup = (wmd->flag & MOD_WARP_INVERT_VGROUP) != 0;
   float(*tex_co)[3] = nullptr;
 
@@ -231,7 +231,6 @@ static void warpModifier_do(WarpModifierData *wmd,
     invert_m4(mat_final);
     negate_v3_v3(mat_final[3], loc);
   }
-  weight = strength;
 
   Tex *tex_target = wmd->texture;
   if (mesh != nullptr && tex_target != nullptr) {
@@ -241,87 +240,103 @@ static void warpModifier_do(WarpModifierData *wmd,
     MOD_init_texture((MappingInfoModifierData *)wmd, ctx);
   }
 
-  for (i = 0; i < verts_num; i++) {
-    float *co = vertexCos[i];
+  ImagePool *pool = nullptr;
+  if (tex_co) {
+    pool = BKE_image_pool_new();
+    BKE_texture_fetch_images_for_pool(tex_target, pool);
+  }
 
-    if (wmd->falloff_type == eWarp_Falloff_None ||
-        ((fac = len_squared_v3v3(co, mat_from[3])) < falloff_radius_sq &&
-         (fac = (wmd->falloff_radius - sqrtf(fac)) / wmd->falloff_radius)))
-    {
-      /* skip if no vert group found */
-      if (defgrp_index != -1) {
-        dv = &dvert[i];
-        weight = (invert_vgroup ? (1.0f - BKE_defvert_find_weight(dv, defgrp_index)) :
-                                  BKE_defvert_find_weight(dv, defgrp_index)) *
-                 strength;
-        if (weight <= 0.0f) {
-          continue;
-        }
-      }
-
-      /* closely match PROP_SMOOTH and similar */
-      switch (wmd->falloff_type) {
-        case eWarp_Falloff_None:
-          fac = 1.0f;
-          break;
-        case eWarp_Falloff_Curve:
-          fac = BKE_curvemapping_evaluateF(wmd->curfalloff, 0, fac);
-          break;
-        case eWarp_Falloff_Sharp:
-          fac = fac * fac;
-          break;
-        case eWarp_Falloff_Smooth:
-          fac = 3.0f * fac * fac - 2.0f * fac * fac * fac;
-          break;
-        case eWarp_Falloff_Root:
-          fac = sqrtf(fac);
-          break;
-        case eWarp_Falloff_Linear:
-          /* pass */
-          break;
-        case eWarp_Falloff_Const:
-          fac = 1.0f;
-          break;
-        case eWarp_Falloff_Sphere:
-          fac = sqrtf(2 * fac - fac * fac);
-          break;
-        case eWarp_Falloff_InvSquare:
-          fac = fac * (2.0f - fac);
-          break;
-      }
-
-      fac *= weight;
-
-      if (tex_co) {
-        TexResult texres;
-        BKE_texture_get_value(tex_target, tex_co[i], &texres, false);
-        fac *= texres.tin;
-      }
-
-      if (fac != 0.0f) {
-        /* into the 'from' objects space */
-        mul_m4_v3(mat_from_inv, co);
-
-        if (fac == 1.0f) {
-          mul_m4_v3(mat_final, co);
-        }
-        else {
-          if (wmd->flag & MOD_WARP_VOLUME_PRESERVE) {
-            /* interpolate the matrix for nicer locations */
-            blend_m4_m4m4(tmat, mat_unit, mat_final, fac);
-            mul_m4_v3(tmat, co);
-          }
-          else {
-            float tvec[3];
-            mul_v3_m4v3(tvec, mat_final, co);
-            interp_v3_v3v3(co, co, tvec, fac);
+  blender::threading::parallel_for(
+      blender::IndexRange(verts_num), 512, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          float *co = vertexCos[i];
+          float fac = 1.0f;
+          float weight = strength;
+
+          if (wmd->falloff_type == eWarp_Falloff_None ||
+              ((fac = len_squared_v3v3(co, mat_from[3])) < falloff_radius_sq &&
+               (fac = (wmd->falloff_radius - sqrtf(fac)) / wmd->falloff_radius)))
+          {
+            /* skip if no vert group found */
+            if (defgrp_index != -1) {
+              const MDeformVert *dv = &dvert[i];
+              weight = (invert_vgroup ? (1.0f - BKE_defvert_find_weight(dv, defgrp_index)) :
+                                        BKE_defvert_find_weight(dv, defgrp_index)) *
+                       strength;
+              if (weight <= 0.0f) {
+                continue;
+              }
+            }
+
+            /* closely match PROP_SMOOTH and similar */
+            switch (wmd->falloff_type) {
+              case eWarp_Falloff_None:
+                fac = 1.0f;
+                break;
+              case eWarp_Falloff_Curve:
+                fac = BKE_curvemapping_evaluateF(wmd->curfalloff, 0, fac);
+                break;
+              case eWarp_Falloff_Sharp:
+                fac = fac * fac;
+                break;
+              case eWarp_Falloff_Smooth:
+                fac = 3.0f * fac * fac - 2.0f * fac * fac * fac;
+                break;
+              case eWarp_Falloff_Root:
+                fac = sqrtf(fac);
+                break;
+              case eWarp_Falloff_Linear:
+                /* pass */
+                break;
+              case eWarp_Falloff_Const:
+                fac = 1.0f;
+                break;
+              case eWarp_Falloff_Sphere:
+                fac = sqrtf(2 * fac - fac * fac);
+                break;
+              case eWarp_Falloff_InvSquare:
+                fac = fac * (2.0f - fac);
+                break;
+            }
+
+            fac *= weight;
+
+            if (tex_co) {
+              TexResult texres;
+              BKE_texture_get_value_ex(tex_target, tex_co[i], &texres, pool, false);
+              fac *= texres.tin;
+            }
+
+            if (fac != 0.0f) {
+              /* into the 'from' objects space */
+              mul_m4_v3(mat_from_inv, co);
+
+              if (fac == 1.0f) {
+                mul_m4_v3(mat_final, co);
+              }
+              else {
+                if (wmd->flag & MOD_WARP_VOLUME_PRESERVE) {
+                  /* interpolate the matrix for nicer locations */
+                  float blend_mat[4][4];
+                  blend_m4_m4m4(blend_mat, mat_unit, mat_final, fac);
+                  mul_m4_v3(blend_mat, co);
+                }
+                else {
+                  float tvec[3];
+                  mul_v3_m4v3(tvec, mat_final, co);
+                  interp_v3_v3v3(co, co, tvec, fac);
+                }
+              }
+
+              /* out of the 'from' objects space */
+              mul_m4_v3(mat_from, co);
+            }
           }
         }
+      });
 
-        /* out of the 'from' objects space */
-        mul_m4_v3(mat_from, co);
-      }
-    }
+  if (pool) {
+    BKE_image_pool_free(pool);
   }
 
   if (tex_co) {
@@ -7,6 +7,7 @@
  */
 
 #include "BLI_math_matrix.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -20,6 +21,7 @@
 
 #include "BKE_deform.hh"
 #include "BKE_editmesh.hh"
+#include "BKE_image.hh"
 #include "BKE_lib_query.hh"
 #include "BKE_texture.h"
 
@@ -129,7 +131,6 @@ static void waveModifier_do(WaveModifierData *wmd,
   float(*tex_co)[3] = nullptr;
   const int wmd_axis = wmd->flag & (MOD_WAVE_X | MOD_WAVE_Y);
   const float falloff = wmd->falloff;
-  float falloff_fac = 1.0f; /* when falloff == 0.0f this stays at 1.0f */
   const bool invert_group = (wmd->flag & MOD_WAVE_INVERT_VGROUP) != 0;
 
   blender::Span<blender::float3> vert_normals;
@@ -179,97 +180,111 @@ static void waveModifier_do(WaveModifierData *wmd,
 
   if (lifefac != 0.0f) {
     /* avoid divide by zero checks within the loop */
-    float falloff_inv = falloff != 0.0f ? 1.0f / falloff : 1.0f;
-    int i;
-
-    for (i = 0; i < verts_num; i++) {
-      float *co = vertexCos[i];
-      float x = co[0] - wmd->startx;
-      float y = co[1] - wmd->starty;
-      float amplit = 0.0f;
-      float def_weight = 1.0f;
-
-      /* get weights */
-      if (dvert) {
-        def_weight = invert_group ? 1.0f - BKE_defvert_find_weight(&dvert[i], defgrp_index) :
-                                    BKE_defvert_find_weight(&dvert[i], defgrp_index);
-
-        /* if this vert isn't in the vgroup, don't deform it */
-        if (def_weight == 0.0f) {
-          continue;
-        }
-      }
-
-      switch (wmd_axis) {
-        case MOD_WAVE_X | MOD_WAVE_Y:
-          amplit = sqrtf(x * x + y * y);
-          break;
-        case MOD_WAVE_X:
-          amplit = x;
-          break;
-        case MOD_WAVE_Y:
-          amplit = y;
-          break;
-      }
-
-      /* this way it makes nice circles */
-      amplit -= (ctime - wmd->timeoffs) * wmd->speed;
-
-      if (wmd->flag & MOD_WAVE_CYCL) {
-        amplit = fmodf(amplit - wmd->width, 2.0f * wmd->width) + wmd->width;
-      }
+    const float falloff_inv = falloff != 0.0f ? 1.0f / falloff : 1.0f;
 
-      if (falloff != 0.0f) {
-        float dist = 0.0f;
-
-        switch (wmd_axis) {
-          case MOD_WAVE_X | MOD_WAVE_Y:
-            dist = sqrtf(x * x + y * y);
-            break;
-          case MOD_WAVE_X:
-            dist = fabsf(x);
-            break;
-          case MOD_WAVE_Y:
-            dist = fabsf(y);
-            break;
-        }
-
-        falloff_fac = (1.0f - (dist * falloff_inv));
-        CLAMP(falloff_fac, 0.0f, 1.0f);
-      }
+    ImagePool *pool = nullptr;
+    if (tex_co) {
+      pool = BKE_image_pool_new();
+      BKE_texture_fetch_images_for_pool(tex_target, pool);
+    }
 
-      /* GAUSSIAN */
-      if ((falloff_fac != 0.0f) && (amplit > -wmd->width) && (amplit < wmd->width)) {
-        amplit = amplit * wmd->narrow;
-        amplit = (1.0f / expf(amplit * amplit) - minfac);
-
-        /* Apply texture. */
-        if (tex_co) {
-          TexResult texres;
-          BKE_texture_get_value(tex_target, tex_co[i], &texres, false);
-          amplit *= texres.tin;
-        }
-
-        /* Apply weight & falloff. */
-        amplit *= def_weight * falloff_fac;
-
-        if (!vert_normals.is_empty()) {
-          /* move along normals */
-          if (wmd->flag & MOD_WAVE_NORM_X) {
-            co[0] += (lifefac * amplit) * vert_normals[i][0];
-          }
-          if (wmd->flag & MOD_WAVE_NORM_Y) {
-            co[1] += (lifefac * amplit) * vert_normals[i][1];
+    blender::threading::parallel_for(
+        blender::IndexRange(verts_num), 512, [&](const blender::IndexRange range) {
+          for (const int i : range) {
+            float *co = vertexCos[i];
+            float x = co[0] - wmd->startx;
+            float y = co[1] - wmd->starty;
+            float amplit = 0.0f;
+            float def_weight = 1.0f;
+            float falloff_fac = 1.0f; /* when falloff == 0.0f this stays at 1.0f */
+
+            /* get weights */
+            if (dvert) {
+              def_weight = invert_group ?
+                               1.0f - BKE_defvert_find_weight(&dvert[i], defgrp_index) :
+                               BKE_defvert_find_weight(&dvert[i], defgrp_index);
+
+              /* if this vert isn't in the vgroup, don't deform it */
+              if (def_weight == 0.0f) {
+                continue;
+              }
+            }
+
+            switch (wmd_axis) {
+              case MOD_WAVE_X | MOD_WAVE_Y:
+                amplit = sqrtf(x * x + y * y);
+                break;
+              case MOD_WAVE_X:
+                amplit = x;
+                break;
+              case MOD_WAVE_Y:
+                amplit = y;
+                break;
+            }
+
+            /* this way it makes nice circles */
+            amplit -= (ctime - wmd->timeoffs) * wmd->speed;
+
+            if (wmd->flag & MOD_WAVE_CYCL) {
+              amplit = fmodf(amplit - wmd->width, 2.0f * wmd->width) + wmd->width;
+            }
+
+            if (falloff != 0.0f) {
+              float dist = 0.0f;
+
+              switch (wmd_axis) {
+                case MOD_WAVE_X | MOD_WAVE_Y:
+                  dist = sqrtf(x * x + y * y);
+                  break;
+                case MOD_WAVE_X:
+                  dist = fabsf(x);
+                  break;
+                case MOD_WAVE_Y:
+                  dist = fabsf(y);
+                  break;
+              }
+
+              falloff_fac = (1.0f - (dist * falloff_inv));
+              CLAMP(falloff_fac, 0.0f, 1.0f);
+            }
+
+            /* GAUSSIAN */
+            if ((falloff_fac != 0.0f) && (amplit > -wmd->width) && (amplit < wmd->width)) {
+              amplit = amplit * wmd->narrow;
+              amplit = (1.0f / expf(amplit * amplit) - minfac);
+
+              /* Apply texture. */
+              if (tex_co) {
+                TexResult texres;
+                BKE_texture_get_value_ex(tex_target, tex_co[i], &texres, pool, false);
+                amplit *= texres.tin;
+              }
+
+              /* Apply weight & falloff. */
+              amplit *= def_weight * falloff_fac;
+
+              if (!vert_normals.is_empty()) {
+                /* move along normals */
+                if (wmd->flag & MOD_WAVE_NORM_X) {
+                  co[0] += (lifefac * amplit) * vert_normals[i][0];
+                }
+                if (wmd->flag & MOD_WAVE_NORM_Y) {
+                  co[1] += (lifefac * amplit) * vert_normals[i][1];
+                }
+                if (wmd->flag & MOD_WAVE_NORM_Z) {
+                  co[2] += (lifefac * amplit) * vert_normals[i][2];
+                }
+              }
+              else {
+                /* move along local z axis */
+                co[2] += lifefac * amplit;
+              }
+            }
           }
-          if (wmd->flag & MOD_WAVE_NORM_Z) {
-            co[2] += (lifefac * amplit) * vert_normals[i][2];
-          }
-        }
-        else {
-          /* move along local z axis */
-          co[2] += lifefac * amplit;
-        }
-      }
+        });
+
+    if (pool) {
+      BKE_image_pool_free(pool);
     }
   }
 
@@ -428,6 +428,11 @@ struct GeometryNodesLazyFunctionGraphInfo {
    * This can be used as a simple heuristic for the complexity of the node group.
    */
   int num_inline_nodes_approximate = 0;
+  /**
+   * Unique for every graph that has been built. Since the graph is rebuilt whenever the node tree
+   * changes, this can be used to detect that the tree changed since it was last evaluated.
+   */
+  uint64_t build_id = 0;
 };
 
 std::unique_ptr<LazyFunction> get_simulation_output_lazy_function(
@@ -29,6 +29,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdio>
 
 #include "BLI_compute_context.hh"
 #include "BLI_enumerable_thread_specific.hh"
@@ -180,6 +181,8 @@ class GeometryInfoLog : public ValueLog {
   std::optional<EditDataInfo> edit_data_info;
   std::optional<VolumeInfo> volume_info;
   std::optional<GridInfo> grid_info;
+  /** Approximate memory used by the geometry. Data that is shared is only counted once. */
+  int64_t memory_bytes = 0;
 
   GeometryInfoLog(const bke::GeometrySet &geometry_set);
   GeometryInfoLog(const bke::GVolumeGrid &grid);
@@ -473,6 +476,13 @@ class GeoNodesLog {
 
   static ContextualGeoTreeLogs get_contextual_tree_logs(const SpaceNode &snode);
   static const ViewerNodeLog *find_viewer_node_log_for_path(const ViewerPath &viewer_path);
+
+  /**
+   * Write the logged node execution times as a timeline in the Chrome trace event format. Every
+   * thread that executed nodes gets its own track. Node groups are looked up in `bmain` to get
+   * node names.
+   */
+  void write_chrome_trace(const Main &bmain, FILE *fp);
 };
 
 }  // namespace blender::nodes::geo_eval_log
@@ -111,10 +111,10 @@ class MovieClipOperation : public NodeOperation {
       GPU_texture_update(result, GPU_DATA_FLOAT, movie_clip_buffer->float_buffer.data);
     }
     else {
-      parallel_for(size, [&](const int2 texel) {
-        int64_t pixel_index = (int64_t(texel.y) * size.x + texel.x) * 4;
-        result.store_pixel(texel, float4(movie_clip_buffer->float_buffer.data + pixel_index));
-      });
+      /* The movie clip buffer has the same layout as the result, so copy it directly. */
+      memcpy(result.cpu_data().data(),
+             movie_clip_buffer->float_buffer.data,
+             result.cpu_data().size_in_bytes());
     }
   }
 
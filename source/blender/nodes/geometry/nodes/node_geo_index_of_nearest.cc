@@ -7,6 +7,9 @@
 #include "BLI_map.hh"
 #include "BLI_task.hh"
 
+#include "DNA_mesh_types.h"
+#include "DNA_pointcloud_types.h"
+
 #include "node_geometry_util.hh"
 
 namespace blender::nodes::node_geo_index_of_nearest_cc {
@@ -30,6 +33,29 @@ static KDTree_3d *build_kdtree(const Span<float3> positions, const IndexMask &ma
   return tree;
 }
 
+/**
+ * Use the KD-tree cached on the geometry when the positions are the geometry's own positions. It
+ * is shared with other evaluations and with copies of the geometry in later frames.
+ */
+static const KDTree_3d *find_cached_kdtree(const bke::GeometryFieldContext &context,
+                                           const Span<float3> positions)
+{
+  if (context.domain() != bke::AttrDomain::Point) {
+    return nullptr;
+  }
+  if (const Mesh *mesh = context.mesh()) {
+    if (mesh->vert_positions().data() == positions.data()) {
+      return &mesh->kdtree_verts();
+    }
+  }
+  if (const PointCloud *pointcloud = context.pointcloud()) {
+    if (pointcloud->positions().data() == positions.data()) {
+      return &pointcloud->kdtree();
+    }
+  }
+  return nullptr;
+}
+
 static int find_nearest_non_self(const KDTree_3d &tree, const float3 &position, const int index)
 {
   return BLI_kdtree_3d_find_nearest_cb_cpp(
@@ -82,6 +108,10 @@ class IndexOfNearestFieldInput final : public bke::GeometryFieldInput {
 
     if (group_ids.is_single()) {
       result.reinitialize(mask.min_array_size());
+      if (const KDTree_3d *tree = find_cached_kdtree(context, positions)) {
+        find_neighbors(*tree, positions, mask, result);
+        return VArray<int>::ForContainer(std::move(result));
+      }
       KDTree_3d *tree = build_kdtree(positions, IndexRange(domain_size));
       find_neighbors(*tree, positions, mask, result);
       BLI_kdtree_3d_free(tree);
@@ -2,8 +2,13 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <fmt/format.h>
+
 #include "node_geometry_util.hh"
 
+#include "BLI_string.h"
+#include "BLI_system.h"
+
 #include "BKE_instances.hh"
 
 #include "GEO_realize_instances.hh"
@@ -80,8 +85,19 @@ static void node_geo_exec(GeoNodeExecParams params)
   options.realize_instance_attributes = true;
   const NodeAttributeFilter attribute_filter = params.get_attribute_filter("Geometry");
   options.attribute_filter = attribute_filter;
+  /* Refuse to realize geometry that can't fit into memory, instead of freezing the system. */
+  options.memory_limit = int64_t(BLI_system_memory_max_in_megabytes()) * 1024 * 1024;
+  geometry::RealizeInstancesReport report;
   GeometrySet new_geometry_set = geometry::realize_instances(
-      geometry_set, options, varied_depth_option);
+      geometry_set, options, varied_depth_option, &report);
+  if (report.memory_limit_exceeded) {
+    char size_str[BLI_STR_FORMAT_INT64_BYTE_UNIT_SIZE];
+    BLI_str_format_byte_unit(size_str, report.estimated_bytes, false);
+    const std::string message = fmt::format(
+        fmt::runtime(TIP_("Realized geometry would need about {} of memory, more than available")),
+        size_str);
+    params.error_message_add(NodeWarningType::Error, message);
+  }
   new_geometry_set.name = geometry_set.name;
   params.set_output("Geometry", std::move(new_geometry_set));
 }
@@ -55,6 +55,7 @@
 
 #include "volume_grid_function_eval.hh"
 
+#include <atomic>
 #include <fmt/format.h>
 #include <iostream>
 #include <sstream>
@@ -4279,7 +4280,10 @@ const GeometryNodesLazyFunctionGraphInfo *ensure_geometry_nodes_lazy_function_gr
     return lf_graph_info_ptr.get();
   }
 
+  static std::atomic<uint64_t> build_id_counter = 0;
+
   auto lf_graph_info = std::make_unique<GeometryNodesLazyFunctionGraphInfo>();
+  lf_graph_info->build_id = ++build_id_counter;
   GeometryNodesLazyFunctionBuilder builder{btree, *lf_graph_info};
   builder.build();
 
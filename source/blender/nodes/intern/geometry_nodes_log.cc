@@ -2,12 +2,16 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <sstream>
+
 #include "DNA_windowmanager_types.h"
 #include "NOD_geometry_nodes_bundle.hh"
 #include "NOD_geometry_nodes_closure.hh"
 #include "NOD_geometry_nodes_log.hh"
 
 #include "BLI_listbase.h"
+#include "BLI_memory_counter.hh"
+#include "BLI_serialize.hh"
 #include "BLI_stack.hh"
 #include "BLI_string_ref.hh"
 #include "BLI_string_utf8.h"
@@ -193,6 +197,11 @@ GeometryInfoLog::GeometryInfoLog(const bke::GeometrySet &geometry_set)
       }
     }
   }
+
+  memory_counter::MemoryCount memory_count;
+  memory_counter::MemoryCounter memory{memory_count};
+  geometry_set.count_memory(memory);
+  this->memory_bytes = memory_count.total_bytes;
 }
 
 #ifdef WITH_OPENVDB
@@ -846,6 +855,60 @@ GeoTreeLog &GeoNodesLog::get_tree_log(const ComputeContextHash &compute_context_
   return reduced_tree_log;
 }
 
+void GeoNodesLog::write_chrome_trace(const Main &bmain, FILE *fp)
+{
+  Map<uint32_t, const bNodeTree *> tree_by_session_uid;
+  FOREACH_NODETREE_BEGIN (const_cast<Main *>(&bmain), tree, id) {
+    tree_by_session_uid.add_new(tree->id.session_uid, tree);
+  }
+  FOREACH_NODETREE_END;
+
+  std::optional<TimePoint> start_time;
+  for (const LocalData &local_data : data_per_thread_) {
+    for (const destruct_ptr<GeoTreeLogger> &tree_logger :
+         local_data.tree_logger_by_context.values())
+    {
+      for (const GeoTreeLogger::NodeExecutionTime &timings : tree_logger->node_execution_times) {
+        start_time = start_time ? std::min(*start_time, timings.start) : timings.start;
+      }
+    }
+  }
+
+  io::serialize::DictionaryValue root;
+  io::serialize::ArrayValue &trace_events = *root.append_array("traceEvents");
+  int thread_index = 0;
+  for (const LocalData &local_data : data_per_thread_) {
+    for (const destruct_ptr<GeoTreeLogger> &tree_logger :
+         local_data.tree_logger_by_context.values())
+    {
+      const bNodeTree *tree = nullptr;
+      if (tree_logger->tree_orig_session_uid) {
+        tree = tree_by_session_uid.lookup_default(*tree_logger->tree_orig_session_uid, nullptr);
+      }
+      for (const GeoTreeLogger::NodeExecutionTime &timings : tree_logger->node_execution_times) {
+        const bNode *node = tree ? tree->node_by_id(timings.node_id) : nullptr;
+        const std::chrono::duration<double, std::micro> start = timings.start - *start_time;
+        const std::chrono::duration<double, std::micro> duration = timings.end - timings.start;
+        io::serialize::DictionaryValue &event = *trace_events.append_dict();
+        event.append_str("name", node ? std::string(node->name) : std::to_string(timings.node_id));
+        event.append_str("cat", tree ? std::string(tree->id.name + 2) : std::string());
+        event.append_str("ph", "X");
+        event.append_double("ts", start.count());
+        event.append_double("dur", duration.count());
+        event.append_int("pid", 0);
+        event.append_int("tid", thread_index);
+      }
+    }
+    thread_index++;
+  }
+
+  std::stringstream stream;
+  io::serialize::JsonFormatter formatter;
+  formatter.serialize(stream, root);
+  const std::string json = stream.str();
+  fwrite(json.data(), 1, json.size(), fp);
+}
+
 static void find_tree_zone_hash_recursive(
     const bNodeTreeZone &zone,
     bke::ComputeContextCache &compute_context_cache,
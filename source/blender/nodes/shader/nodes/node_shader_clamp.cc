@@ -51,15 +51,18 @@ static void sh_node_clamp_build_multi_function(NodeMultiFunctionBuilder &builder
 {
   static auto minmax_fn = mf::build::SI3_SO<float, float, float, float>(
       "Clamp (Min Max)",
-      [](float value, float min, float max) { return std::min(std::max(value, min), max); });
+      [](float value, float min, float max) { return std::min(std::max(value, min), max); },
+      mf::build::exec_presets::SomeSpanOrSingle<0>());
   static auto range_fn = mf::build::SI3_SO<float, float, float, float>(
-      "Clamp (Range)", [](float value, float a, float b) {
+      "Clamp (Range)",
+      [](float value, float a, float b) {
         if (a < b) {
           return clamp_f(value, a, b);
         }
 
         return clamp_f(value, b, a);
-      });
+      },
+      mf::build::exec_presets::SomeSpanOrSingle<0>());
 
   int clamp_type = builder.node().custom1;
   if (clamp_type == NODE_CLAMP_MINMAX) {
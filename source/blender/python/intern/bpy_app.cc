@@ -632,6 +632,34 @@ static PyObject *bpy_app_help_text(PyObject * /*self*/, PyObject *args, PyObject
   return result;
 }
 
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_app_memory_statistics_doc,
+    ".. staticmethod:: memory_statistics()\n"
+    "\n"
+    "   Return memory usage of Blender's guarded allocator.\n"
+    "\n"
+    "   :return: Dictionary with the bytes currently in use (``in_use``), the peak bytes in use "
+    "(``peak``) and the number of allocated blocks (``blocks``).\n"
+    "   :rtype: dict[str, int]\n");
+static PyObject *bpy_app_memory_statistics(PyObject * /*self*/, PyObject * /*args*/)
+{
+  const struct {
+    const char *id;
+    PyObject *value;
+  } items[] = {
+      {"in_use", PyLong_FromSize_t(MEM_get_memory_in_use())},
+      {"peak", PyLong_FromSize_t(MEM_get_peak_memory())},
+      {"blocks", PyLong_FromUnsignedLong(MEM_get_memory_blocks_in_use())},
+  };
+  PyObject *result = _PyDict_NewPresized(ARRAY_SIZE(items));
+  for (const auto &item : items) {
+    PyDict_SetItemString(result, item.id, item.value);
+    Py_DECREF(item.value);
+  }
+  return result;
+}
+
 #ifdef __GNUC__
 #  ifdef __clang__
 #    pragma clang diagnostic push
@@ -651,6 +679,10 @@ static PyMethodDef bpy_app_methods[] = {
      (PyCFunction)bpy_app_help_text,
      METH_VARARGS | METH_KEYWORDS | METH_STATIC,
      bpy_app_help_text_doc},
+    {"memory_statistics",
+     (PyCFunction)bpy_app_memory_statistics,
+     METH_NOARGS | METH_STATIC,
+     bpy_app_memory_statistics_doc},
     {nullptr, nullptr, 0, nullptr},
 };
 
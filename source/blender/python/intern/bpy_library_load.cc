@@ -559,6 +559,9 @@ static PyObject *bpy_lib_exit(BPy_Library *self, PyObject * /*args*/)
 
   BKE_blendfile_link_append_context_init_done(lapp_context);
 
+  /* Reading the library doesn't run any Python, let other Python threads run meanwhile. */
+  Py_BEGIN_ALLOW_THREADS;
+
   BKE_blendfile_link(lapp_context, nullptr);
   if (do_append) {
     BKE_blendfile_append(lapp_context, nullptr);
@@ -569,6 +572,8 @@ static PyObject *bpy_lib_exit(BPy_Library *self, PyObject * /*args*/)
 
   BKE_blendfile_link_append_context_finalize(lapp_context);
 
+  Py_END_ALLOW_THREADS;
+
 /* If enabled, replace named items in given lists by the final matching new ID pointer. */
 #ifdef USE_RNA_DATABLOCKS
   idcode_step = 0;
@@ -79,6 +79,12 @@ bool RE_bake_engine(struct Render *re,
                     int pass_filter,
                     float result[]);
 
+/**
+ * Free the engine used by #RE_bake_engine. Must be called once all objects baked with the same
+ * depsgraph are done, before the depsgraph is freed.
+ */
+void RE_bake_engine_free(struct Render *re);
+
 /* `bake.cc` */
 
 int RE_pass_depth(eScenePassType pass_type);
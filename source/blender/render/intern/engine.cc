@@ -747,7 +747,10 @@ void RE_engine_frame_set(RenderEngine *engine, int frame, float subframe)
 
   CLAMP(cfra, MINAFRAME, MAXFRAME);
   BKE_scene_frame_set(re->scene, cfra);
-  BKE_scene_graph_update_for_newframe_ex(engine->depsgraph, false);
+  /* Motion blur steps often include the current frame, and engines restore the original frame
+   * when done. Don't re-evaluate the whole scene when it is already evaluated at that time. */
+  const bool skip_evaluated_frame = true;
+  BKE_scene_graph_update_for_newframe_ex(engine->depsgraph, false, skip_evaluated_frame);
 
   BKE_scene_camera_switch_update(re->scene);
 }
@@ -835,10 +838,8 @@ bool RE_bake_engine(Render *re,
 
   engine->flag &= ~RE_ENGINE_RENDERING;
 
-  engine_depsgraph_free(engine);
-
-  RE_engine_free(engine);
-  re->engine = nullptr;
+  /* The engine is kept until #RE_bake_engine_free, so baking multiple objects from the same
+   * depsgraph does not have to export the scene to the render engine again for every object. */
 
   if (BKE_reports_contain(re->reports, RPT_ERROR)) {
     G.is_break = true;
@@ -847,6 +848,19 @@ bool RE_bake_engine(Render *re,
   return true;
 }
 
+void RE_bake_engine_free(Render *re)
+{
+  RenderEngine *engine = re->engine;
+  if (engine == nullptr) {
+    return;
+  }
+
+  engine_depsgraph_free(engine);
+
+  RE_engine_free(engine);
+  re->engine = nullptr;
+}
+
 /* Render */
 
 static bool possibly_using_gpu_compositor(const Render *re)
@@ -2481,12 +2481,20 @@ void RE_RenderAnim(Render *re,
   re->flag |= R_ANIMATION;
   DEG_graph_id_tag_update(re->main, re->pipeline_depsgraph, &re->scene->id, ID_RECALC_AUDIO_MUTE);
 
+  /* Reduce GPU memory usage so renderer has more space. Engines that render through the GPU
+   * context (EEVEE, Workbench) share it with the compositor, whose pooled textures and shaders
+   * are then reused between frames instead of being recreated for every frame, which dominates
+   * the cost of cheap frames. Other engines get the caches freed before every frame. */
+  const bool free_gpu_texture_caches_per_frame = !(re_type->flag & RE_USE_GPU_CONTEXT);
+  RE_FreeGPUTextureCaches();
+
   scene->r.subframe = 0.0f;
   for (nfra = sfra, scene->r.cfra = sfra; scene->r.cfra <= efra; scene->r.cfra++) {
     char filepath[FILE_MAX];
 
-    /* Reduce GPU memory usage so renderer has more space. */
-    RE_FreeGPUTextureCaches();
+    if (free_gpu_texture_caches_per_frame && scene->r.cfra != sfra) {
+      RE_FreeGPUTextureCaches();
+    }
 
     /* A feedback loop exists here -- render initialization requires updated
      * render layers settings which could be animated, but scene evaluation for
@@ -153,16 +153,8 @@ void source_image_cache_put(const RenderData *context,
   std::lock_guard lock(source_image_cache_mutex);
   SourceImageCache *cache = ensure_source_image_cache(scene);
 
-  SourceImageCache::StripEntry *val = cache->map_.lookup_ptr(strip);
-
-  if (val == nullptr) {
-    /* Nothing in cache for this strip yet. */
-    cache->map_.add_new(strip, {});
-    val = cache->map_.lookup_ptr(strip);
-  }
-  BLI_assert_msg(val != nullptr, "Source image cache value should never be null here");
-
-  SourceImageCache::FrameEntry &frame = val->frames.lookup_or_add_default({frame_index, view_id});
+  SourceImageCache::StripEntry &val = cache->map_.lookup_or_add_default(strip);
+  SourceImageCache::FrameEntry &frame = val.frames.lookup_or_add_default({frame_index, view_id});
   if (frame.image != nullptr) {
     IMB_freeImBuf(frame.image);
   }
@@ -333,6 +333,15 @@ void ThumbGenerationJob::run_fn(void *customdata, wmJobWorkerStatus *worker_stat
           break;
         }
 
+        /* Skip requests that were discarded since they were copied, e.g. because the strips
+         * got scrolled out of view. Decoding them would only delay the visible ones. */
+        {
+          std::scoped_lock lock(thumb_cache_mutex);
+          if (!job->cache_->requests_.contains(request)) {
+            continue;
+          }
+        }
+
 #ifdef DEBUG_PRINT_THUMB_JOB_TIMES
         ++total_thumbs;
 #endif
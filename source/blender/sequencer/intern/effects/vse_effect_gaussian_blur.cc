@@ -9,6 +9,7 @@
 #include "BLI_math_base.hh"
 #include "BLI_task.hh"
 
+#include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
 
 #include "IMB_imbuf.hh"
@@ -146,10 +147,16 @@ static ImBuf *do_gaussian_blur_effect(const RenderData *context,
 
   /* Create blur kernel weights. */
   const GaussianBlurVars *data = static_cast<const GaussianBlurVars *>(strip->effectdata);
-  const int half_size_x = int(data->size_x + 0.5f);
-  const int half_size_y = int(data->size_y + 0.5f);
-  Array<float> gaussian_x = make_gaussian_blur_kernel(data->size_x, half_size_x);
-  Array<float> gaussian_y = make_gaussian_blur_kernel(data->size_y, half_size_y);
+  /* Blur size is defined in pixels of the full scene resolution. Scale it to the resolution that
+   * is rendered (same as the Glow effect does), so that previews at reduced size look the same and
+   * don't pay for a kernel that is too large. */
+  const float render_scale = float(context->rectx) / float(context->scene->r.xsch);
+  const float size_x = data->size_x * render_scale;
+  const float size_y = data->size_y * render_scale;
+  const int half_size_x = int(size_x + 0.5f);
+  const int half_size_y = int(size_y + 0.5f);
+  Array<float> gaussian_x = make_gaussian_blur_kernel(size_x, half_size_x);
+  Array<float> gaussian_y = make_gaussian_blur_kernel(size_y, half_size_y);
 
   const int width = context->rectx;
   const int height = context->recty;
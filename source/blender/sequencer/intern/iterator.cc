@@ -19,8 +19,11 @@
 #include "SEQ_iterator.hh"
 #include "SEQ_relations.hh"
 #include "SEQ_render.hh"
+#include "SEQ_sequencer.hh"
 #include "SEQ_time.hh"
 
+#include "sequencer.hh"
+
 namespace blender::seq {
 
 static bool strip_for_each_recursive(ListBase *seqbase, ForEachFunc callback, void *user_data)
@@ -249,10 +252,16 @@ void query_strip_effect_chain(const Scene *scene,
     }
   }
 
-  /* Find all effect strips that have `reference_strip` as an input. */
-  LISTBASE_FOREACH (Strip *, strip_test, seqbase) {
-    if (strip_test->input1 == reference_strip || strip_test->input2 == reference_strip) {
-      query_strip_effect_chain(scene, strip_test, seqbase, r_strips);
+  /* Find all effect strips that have `reference_strip` as an input. Use the lookup instead of
+   * iterating over `seqbase`, which made expanding large selections quadratic. The effects are
+   * copied, because the recursion can add entries to the lookup. */
+  Editing *ed = editing_get(scene);
+  const Strip *reference_meta = lookup_meta_by_strip(ed, reference_strip);
+  const Vector<Strip *> effects = SEQ_lookup_effects_by_strip(ed, reference_strip);
+  for (Strip *effect : effects) {
+    /* Effects are expected to be in the same strip list as their inputs. */
+    if (lookup_meta_by_strip(ed, effect) == reference_meta) {
+      query_strip_effect_chain(scene, effect, seqbase, r_strips);
     }
   }
 }
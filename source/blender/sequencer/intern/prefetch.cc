@@ -269,6 +269,18 @@ static void seq_prefetch_update_area(PrefetchJob *pfjob)
     pfjob->num_frames_prefetched = std::max(pfjob->num_frames_prefetched, 1);
   }
 
+  Scene *scene = pfjob->scene; /* For the start/end frame macros. */
+
+  /* Playback looped back to the start frame: prefetching already wrapped around (see
+   * #seq_prefetch_cfra), so keep the frames after the new position instead of starting over. */
+  if (cfra < pfjob->cfra && cfra >= PSFRA) {
+    const int delta = (PEFRA - pfjob->cfra) + (cfra - PSFRA);
+    if (delta < pfjob->num_frames_prefetched) {
+      pfjob->cfra = cfra;
+      pfjob->num_frames_prefetched = std::max(pfjob->num_frames_prefetched - delta, 1);
+    }
+  }
+
   /* reset */
   if (cfra < pfjob->cfra) {
     pfjob->cfra = cfra;
@@ -276,7 +288,6 @@ static void seq_prefetch_update_area(PrefetchJob *pfjob)
   }
 
   /* timeline span changes */
-  Scene *scene = pfjob->scene; /* For the start/end frame macros. */
   if (pfjob->timeline_start != PSFRA || pfjob->timeline_end != PEFRA) {
     pfjob->timeline_start = PSFRA;
     pfjob->timeline_end = PEFRA;
@@ -517,6 +528,23 @@ static void *seq_prefetch_frames(void *job)
       /* Don't try to prefetch anything when we are outside of the timeline range. */
       break;
     }
+
+    /* Frames that are already in the final image cache (e.g. after scrubbing back over an already
+     * prefetched range) don't need the depsgraph and animation evaluation below. */
+    ImBuf *ibuf_cached = final_image_cache_get(
+        pfjob->context.scene, seq_prefetch_cfra(pfjob), pfjob->context.view_id);
+    if (ibuf_cached != nullptr) {
+      IMB_freeImBuf(ibuf_cached);
+      pfjob->num_frames_prefetched++;
+      seq_prefetch_do_suspend(pfjob);
+      if (!(pfjob->scene->ed->cache_flag & SEQ_CACHE_PREFETCH_ENABLE) ||
+          !(pfjob->scene->ed->cache_flag & SEQ_CACHE_ALL_TYPES) || pfjob->stop)
+      {
+        break;
+      }
+      continue;
+    }
+
     pfjob->scene_eval->ed->prefetch_job = nullptr;
 
     seq_prefetch_update_depsgraph(pfjob);
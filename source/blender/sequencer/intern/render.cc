@@ -731,6 +731,21 @@ static ImBuf *seq_render_preprocess_ibuf(const RenderData *context,
   return ibuf;
 }
 
+/* Views other than the requested one are decoded together with it. Only store them in the source
+ * image cache, so that rendering those views doesn't decode them again. Preprocessing them here
+ * would be wasted, it is done when the view itself is rendered. */
+static void seq_source_image_cache_put_view(
+    const RenderData *context, Strip *strip, float timeline_frame, int view_id, ImBuf *ibuf)
+{
+  Scene *orig_scene = prefetch_get_original_scene(context);
+  if ((orig_scene->ed->cache_flag & SEQ_CACHE_STORE_RAW) == 0) {
+    return;
+  }
+  RenderData localcontext = *context;
+  localcontext.view_id = view_id;
+  source_image_cache_put(&localcontext, strip, timeline_frame, ibuf);
+}
+
 static ImBuf *seq_render_effect_strip_impl(const RenderData *context,
                                            SeqRenderState *state,
                                            Strip *strip,
@@ -983,12 +998,9 @@ static ImBuf *seq_render_image_strip(const RenderData *context,
     }
 
     for (int view_id = 0; view_id < totviews; view_id++) {
-      RenderData localcontext = *context;
-      localcontext.view_id = view_id;
-
-      if (view_id != context->view_id) {
-        ibufs_arr[view_id] = seq_render_preprocess_ibuf(
-            &localcontext, strip, ibufs_arr[view_id], timeline_frame, true, false);
+      if (view_id != context->view_id && ibufs_arr[view_id]) {
+        seq_source_image_cache_put_view(
+            context, strip, timeline_frame, view_id, ibufs_arr[view_id]);
       }
     }
 
@@ -1145,12 +1157,9 @@ static ImBuf *seq_render_movie_strip(const RenderData *context,
     }
 
     for (int view_id = 0; view_id < totviews; view_id++) {
-      RenderData localcontext = *context;
-      localcontext.view_id = view_id;
-
       if (view_id != context->view_id && ibuf_arr[view_id]) {
-        ibuf_arr[view_id] = seq_render_preprocess_ibuf(
-            &localcontext, strip, ibuf_arr[view_id], timeline_frame, true, false);
+        seq_source_image_cache_put_view(
+            context, strip, timeline_frame, view_id, ibuf_arr[view_id]);
       }
     }
 
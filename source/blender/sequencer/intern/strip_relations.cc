@@ -67,9 +67,14 @@ void cache_settings_changed(Scene *scene)
 
 bool is_cache_full(const Scene *scene)
 {
-  size_t cache_limit = size_t(U.memcachelimit) * 1024 * 1024;
-  return source_image_cache_calc_memory_size(scene) + final_image_cache_calc_memory_size(scene) >
-         cache_limit;
+  const size_t cache_limit = size_t(U.memcachelimit) * 1024 * 1024;
+  /* Both sizes are computed by iterating over all cached images, skip the second one when the
+   * source images alone already fill the cache. */
+  const size_t source_size = source_image_cache_calc_memory_size(scene);
+  if (source_size > cache_limit) {
+    return true;
+  }
+  return source_size + final_image_cache_calc_memory_size(scene) > cache_limit;
 }
 
 bool evict_caches_if_full(Scene *scene)
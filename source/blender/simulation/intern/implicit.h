@@ -12,6 +12,11 @@
 
 #include <cstdio>
 
+/* The solver back-end is chosen at compile time. Each back-end defines its own #Implicit_Data
+ * and implements the `SIM_mass_spring_*` functions declared below, which is all that
+ * `SIM_mass_spring.cc` uses to build and solve the system. A different solver (for example one
+ * running on the GPU) has to provide the same functions, including the force and Jacobian
+ * accumulation, because the cloth step calls them per spring and per vertex. */
 // #define IMPLICIT_SOLVER_EIGEN
 #define IMPLICIT_SOLVER_BLENDER
 
@@ -194,21 +194,23 @@ DO_INLINE void add_lfvector_lfvector(float (*to)[3],
                                      float (*fLongVectorB)[3],
                                      uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    add_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_LIMIT, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          add_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
+        }
+      });
 }
 /* `A = B + C * float` -> for big vector. */
 DO_INLINE void add_lfvector_lfvectorS(
     float (*to)[3], float (*fLongVectorA)[3], float (*fLongVectorB)[3], float bS, uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_LIMIT, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
+        }
+      });
 }
 /* `A = B * float + C * float` -> for big vector */
 DO_INLINE void add_lfvectorS_lfvectorS(float (*to)[3],
@@ -218,20 +220,23 @@ DO_INLINE void add_lfvectorS_lfvectorS(float (*to)[3],
                                        float bS,
                                        uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    VECADDSS(to[i], fLongVectorA[i], aS, fLongVectorB[i], bS);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_LIMIT, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          VECADDSS(to[i], fLongVectorA[i], aS, fLongVectorB[i], bS);
+        }
+      });
 }
 /* `A = B - C * float` -> for big vector. */
 DO_INLINE void sub_lfvector_lfvectorS(
     float (*to)[3], float (*fLongVectorA)[3], float (*fLongVectorB)[3], float bS, uint verts)
 {
-  uint i = 0;
-  for (i = 0; i < verts; i++) {
-    VECSUBS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_LIMIT, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          VECSUBS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
+        }
+      });
 }
 /* `A = B - C` -> for big vector. */
 DO_INLINE void sub_lfvector_lfvector(float (*to)[3],
@@ -239,11 +244,12 @@ DO_INLINE void sub_lfvector_lfvector(float (*to)[3],
                                      float (*fLongVectorB)[3],
                                      uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    sub_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(verts), CLOTH_PARALLEL_LIMIT, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          sub_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
+        }
+      });
 }
 ///////////////////////////
 // 3x3 matrix
@@ -603,7 +609,17 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
         }
       },
       [&]() {
-        for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
+        /* The diagonal blocks each write a different vertex, the off-diagonal blocks are added
+         * afterwards in the same order as before. */
+        blender::threading::parallel_for(
+            blender::IndexRange(vcount),
+            CLOTH_PARALLEL_LIMIT,
+            [&](const blender::IndexRange range) {
+              for (const int64_t i : range) {
+                muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
+              }
+            });
+        for (uint i = vcount; i < vcount + from[0].scount; i++) {
           muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
         }
       });
@@ -619,12 +635,15 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
 DO_INLINE void subadd_bfmatrixS_bfmatrixS(
     fmatrix3x3 *to, fmatrix3x3 *from, float aS, fmatrix3x3 *matrix, float bS)
 {
-  uint i = 0;
-
   /* process diagonal elements */
-  for (i = 0; i < matrix[0].vcount + matrix[0].scount; i++) {
-    subadd_fmatrixS_fmatrixS(to[i].m, from[i].m, aS, matrix[i].m, bS);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(matrix[0].vcount + matrix[0].scount),
+      CLOTH_PARALLEL_LIMIT,
+      [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          subadd_fmatrixS_fmatrixS(to[i].m, from[i].m, aS, matrix[i].m, bS);
+        }
+      });
 }
 
 ///////////////////////////////////////////////////////////////////
@@ -742,11 +761,14 @@ BLI_INLINE void root_to_world_m3(Implicit_Data *data,
 
 DO_INLINE void filter(lfVector *V, fmatrix3x3 *S)
 {
-  uint i = 0;
-
-  for (i = 0; i < S[0].vcount; i++) {
-    mul_m3_v3(S[i].m, V[S[i].r]);
-  }
+  /* S only has diagonal blocks, so every block changes a different vertex. */
+  blender::threading::parallel_for(blender::IndexRange(S[0].vcount),
+                                   CLOTH_PARALLEL_LIMIT,
+                                   [&](const blender::IndexRange range) {
+                                     for (const int64_t i : range) {
+                                       mul_m3_v3(S[i].m, V[S[i].r]);
+                                     }
+                                   });
 }
 
 /* this version of the CG algorithm does not work very well with partial constraints
@@ -27,6 +27,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_math_vector_types.hh"
 #include "BLI_rect.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_context.hh"
@@ -1580,6 +1581,8 @@ void WM_paint_cursor_tag_redraw(wmWindow *win, ARegion * /*region*/)
 
 void wm_draw_update(bContext *C)
 {
+  TRACE_ZONE("Window Manager Draw");
+
   Main *bmain = CTX_data_main(C);
   wmWindowManager *wm = CTX_wm_manager(C);
 
@@ -1080,6 +1080,9 @@ bool WM_file_read(bContext *C,
      * risk, because the excluded path list is also loaded. Further it's just confusing
      * if a user loads a file and various preferences change. */
     params.skip_flags = BLO_READ_SKIP_USERDEF;
+    if (G.background && (G.fileflags & G_BACKGROUND_READ_ACTIVE_SCENE_ONLY)) {
+      params.skip_flags |= BLO_READ_SKIP_UNUSED_BY_SCENE;
+    }
 
     BlendFileReadReport bf_reports{};
     bf_reports.reports = reports;
@@ -2349,6 +2352,10 @@ void WM_autosave_write(wmWindowManager *wm, Main *bmain)
 
   /* Error reporting into console. */
   BlendFileWriteParams params{};
+  /* Successive auto-saves mostly write unchanged data, re-use its compressed frames. */
+  params.use_frame_cache = true;
+  /* Don't block on writing the file to disk, which can take long on slow storage. */
+  params.use_background_write = true;
   BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
 
   /* Restart auto-save timer. */
@@ -2415,6 +2422,9 @@ void wm_autosave_delete()
 {
   char filepath[FILE_MAX];
 
+  /* The auto-save file may still be written in the background. */
+  BLO_write_file_background_wait();
+
   wm_autosave_location(filepath);
 
   if (BLI_exists(filepath)) {
@@ -26,6 +26,7 @@
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
+#include "BLI_time.h"
 #include "BLI_timer.h"
 #include "BLI_utildefines.h"
 
@@ -126,6 +127,16 @@ CLG_LOGREF_DECLARE_GLOBAL(WM_LOG_MSGBUS_SUB, "wm.msgbus.sub");
 
 static void wm_init_scripts_extensions_once(bContext *C);
 
+/** Timing of the start-up steps, shown with `--log "wm.init"`. */
+static CLG_LogRef LOG_INIT = {"wm.init"};
+
+static void wm_init_log_step_time(const char *step, double &r_time_step_start)
+{
+  const double time_now = BLI_time_now_seconds();
+  CLOG_INFO(&LOG_INIT, 0, "%s: %.3fs", step, time_now - r_time_step_start);
+  r_time_step_start = time_now;
+}
+
 static bool wm_start_with_console = false;
 
 void WM_init_state_start_with_console_set(bool value)
@@ -194,6 +205,8 @@ static void sound_jack_sync_callback(Main *bmain, int mode, double time)
 
 void WM_init(bContext *C, int argc, const char **argv)
 {
+  const double time_start = BLI_time_now_seconds();
+  double time_step_start = time_start;
 
   if (!G.background) {
     wm_ghost_init(C); /* NOTE: it assigns C to ghost! */
@@ -244,6 +257,8 @@ void WM_init(bContext *C, int argc, const char **argv)
    * otherwise the versioning cannot find the default studio-light. */
   BKE_studiolight_init();
 
+  wm_init_log_step_time("register types", time_step_start);
+
   BLI_assert((G.fileflags & G_FILE_NO_UI) == 0);
 
   /**
@@ -286,6 +301,8 @@ void WM_init(bContext *C, int argc, const char **argv)
   /* For file-system. Called here so can include user preference paths if needed. */
   ED_file_init();
 
+  wm_init_log_step_time("read startup file & preferences", time_step_start);
+
   if (!G.background) {
     GPU_render_begin();
 
@@ -309,6 +326,8 @@ void WM_init(bContext *C, int argc, const char **argv)
 
   ED_spacemacros_init();
 
+  wm_init_log_step_time("init GPU & interface", time_step_start);
+
 #ifdef WITH_PYTHON
   BPY_python_start(C, argc, argv);
   BPY_python_reset(C);
@@ -316,6 +335,8 @@ void WM_init(bContext *C, int argc, const char **argv)
   UNUSED_VARS(argc, argv);
 #endif
 
+  wm_init_log_step_time("start Python", time_step_start);
+
   if (!G.background) {
     if (wm_start_with_console) {
       GHOST_setConsoleWindowState(GHOST_kConsoleWindowStateShow);
@@ -350,7 +371,12 @@ void WM_init(bContext *C, int argc, const char **argv)
   WM_keyconfig_update_postpone_end();
   WM_keyconfig_update(static_cast<wmWindowManager *>(G_MAIN->wm.first));
 
+  wm_init_log_step_time("register add-ons & key-maps", time_step_start);
+
   wm_homefile_read_post(C, params_file_read_post);
+
+  wm_init_log_step_time("startup file post-read", time_step_start);
+  CLOG_INFO(&LOG_INIT, 0, "total: %.3fs", BLI_time_now_seconds() - time_start);
 }
 
 static bool wm_init_splash_show_on_startup_check()
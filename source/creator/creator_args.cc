@@ -29,6 +29,7 @@
 #  include "BLI_string_utf8.h"
 #  include "BLI_system.h"
 #  include "BLI_threads.h"
+#  include "BLI_trace.hh"
 #  include "BLI_utildefines.h"
 #  ifndef NDEBUG
 #    include "BLI_mempool.h"
@@ -662,6 +663,7 @@ static void print_help(bArgs *ba, bool all)
   BLI_args_print_arg_doc(ba, "--render-output");
   BLI_args_print_arg_doc(ba, "--engine");
   BLI_args_print_arg_doc(ba, "--threads");
+  BLI_args_print_arg_doc(ba, "--read-active-scene-only");
 
   if (defs.with_cycles) {
     PRINT("Cycles Render Options:\n");
@@ -778,6 +780,7 @@ static void print_help(bArgs *ba, bool all)
   PRINT("\n");
   BLI_args_print_arg_doc(ba, "--debug-fpe");
   BLI_args_print_arg_doc(ba, "--debug-exit-on-error");
+  BLI_args_print_arg_doc(ba, "--debug-trace");
   if (defs.with_freestyle) {
     BLI_args_print_arg_doc(ba, "--debug-freestyle");
   }
@@ -1035,6 +1038,35 @@ static int arg_handle_debug_exit_on_error(int /*argc*/, const char ** /*argv*/,
   return 0;
 }
 
+static void debug_trace_write_atexit(void *user_data)
+{
+  const char *filepath = static_cast<const char *>(user_data);
+  blender::trace::stop();
+  if (!blender::trace::write_json_file(filepath)) {
+    fprintf(stderr, "Error: could not write the trace to \"%s\".\n", filepath);
+  }
+}
+
+static const char arg_handle_debug_trace_set_doc[] =
+    "<filepath>\n"
+    "\tRecord trace events of instrumented code and write them to a file on exit.\n"
+    "\tThe file uses the Chrome trace event format, which can be opened in Perfetto.";
+static int arg_handle_debug_trace_set(int argc, const char **argv, void * /*data*/)
+{
+  const char *arg_id = "--debug-trace";
+  if (argc > 1) {
+    static char filepath[FILE_MAX] = "";
+    if (filepath[0] == '\0') {
+      BKE_blender_atexit_register(debug_trace_write_atexit, filepath);
+    }
+    STRNCPY(filepath, argv[1]);
+    blender::trace::start();
+    return 1;
+  }
+  fprintf(stderr, "\nError: '%s' no args given.\n", arg_id);
+  return 0;
+}
+
 static const char arg_handle_quiet_set_doc[] =
     "\n\t"
     "Suppress status printing (warnings & errors are still printed).";
@@ -1141,6 +1173,20 @@ static int arg_handle_disable_depsgraph_on_file_load(int /*argc*/,
   return 0;
 }
 
+static const char arg_handle_read_active_scene_only_doc[] =
+    "\n"
+    "\tBackground mode: Only read the active scene of blend-files and the data it uses,\n"
+    "\tskipping other scenes and unused data (must be passed before the blend-file).\n"
+    "\n"
+    "\tOther scenes of the file are not available (e.g. to the '--scene' option).";
+static int arg_handle_read_active_scene_only(int /*argc*/,
+                                             const char ** /*argv*/,
+                                             void * /*data*/)
+{
+  G.fileflags |= G_BACKGROUND_READ_ACTIVE_SCENE_ONLY;
+  return 0;
+}
+
 static const char arg_handle_disable_liboverride_auto_resync_doc[] =
     "\n"
     "\tDo not perform library override automatic resync when loading a new blend-file.\n"
@@ -2748,6 +2794,12 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
                CB(arg_handle_disable_depsgraph_on_file_load),
                nullptr);
 
+  BLI_args_add(ba,
+               nullptr,
+               "--read-active-scene-only",
+               CB(arg_handle_read_active_scene_only),
+               nullptr);
+
   BLI_args_add(ba,
                nullptr,
                "--disable-liboverride-auto-resync",
@@ -2902,6 +2954,7 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
                (void *)G_DEBUG_GPU_FORCE_VULKAN_LOCAL_READ);
 #  endif
   BLI_args_add(ba, nullptr, "--debug-exit-on-error", CB(arg_handle_debug_exit_on_error), nullptr);
+  BLI_args_add(ba, nullptr, "--debug-trace", CB(arg_handle_debug_trace_set), nullptr);
 
   BLI_args_add(ba, nullptr, "--verbose", CB(arg_handle_verbosity_set), nullptr);
 
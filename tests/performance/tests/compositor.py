@@ -0,0 +1,61 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    scene = bpy.context.scene
+    scene.render.use_compositing = True
+    scene.render.use_sequencer = False
+
+    # The benchmark files only use image inputs, without Render Layers nodes the scene itself is
+    # not rendered and only the compositor is measured.
+    bpy.ops.render.render()
+
+    test_time_start = time.time()
+    measured_times = []
+
+    min_measurements = 3
+    max_measurements = 20
+    timeout = 10
+
+    while True:
+        start_time = time.time()
+        bpy.ops.render.render()
+        elapsed_time = time.time() - start_time
+        measured_times.append(elapsed_time)
+
+        if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+            break
+        if len(measured_times) >= max_measurements:
+            break
+
+    average_time = sum(measured_times) / len(measured_times)
+    result = {'time': average_time}
+    return result
+
+
+class CompositorTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "compositor"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('compositor/*')
+    return [CompositorTest(filepath) for filepath in filepaths]
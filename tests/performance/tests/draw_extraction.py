@@ -0,0 +1,70 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    # Draw once first, so that shaders are compiled and only the extraction is measured.
+    bpy.ops.wm.redraw_timer(type='DRAW_WIN_SWAP', iterations=1)
+
+    test_time_start = time.time()
+    measured_times = []
+
+    min_measurements = 5
+    max_measurements = 100
+    timeout = 5
+
+    while True:
+        # Tag all geometry for an update, so that the next redraw extracts all draw batches again.
+        # The depsgraph evaluation happens before the measured redraw.
+        for ob in bpy.context.view_layer.objects:
+            ob.update_tag(refresh={'DATA'})
+        bpy.context.view_layer.update()
+
+        start_time = time.time()
+        bpy.ops.wm.redraw_timer(type='DRAW_WIN_SWAP', iterations=1)
+        elapsed_time = time.time() - start_time
+        measured_times.append(elapsed_time)
+
+        if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+            break
+        if len(measured_times) >= max_measurements:
+            break
+
+    average_time = sum(measured_times) / len(measured_times)
+    result = {'time': average_time}
+
+    # Drawing needs a window, quit once the result is printed.
+    # The benchmark changed the file, quit without asking to save it.
+    bpy.context.preferences.view.use_save_prompt = False
+    bpy.ops.wm.quit_blender()
+    return result
+
+
+class DrawExtractionTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "draw_extraction"
+
+    def use_background(self):
+        return False
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath], foreground=True)
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('draw/*')
+    return [DrawExtractionTest(filepath) for filepath in filepaths]
@@ -0,0 +1,76 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    # Evaluate objects once first, so only the export itself is measured.
+    bpy.context.view_layer.update()
+
+    operator = getattr(bpy.ops.wm, args['operator'])
+
+    with tempfile.TemporaryDirectory() as tempdir:
+        filepath = os.path.join(tempdir, "export" + args['extension'])
+
+        test_time_start = time.time()
+        measured_times = []
+
+        min_measurements = 3
+        max_measurements = 20
+        timeout = 10
+
+        while True:
+            start_time = time.time()
+            operator(filepath=filepath)
+            elapsed_time = time.time() - start_time
+            measured_times.append(elapsed_time)
+
+            if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+                break
+            if len(measured_times) >= max_measurements:
+                break
+
+    average_time = sum(measured_times) / len(measured_times)
+    result = {'time': average_time}
+    return result
+
+
+class IOExportTest(api.Test):
+    def __init__(self, filepath, file_format, operator, extension):
+        self.filepath = filepath
+        self.file_format = file_format
+        self.operator = operator
+        self.extension = extension
+
+    def name(self):
+        return f"{self.filepath.stem}_{self.file_format}"
+
+    def category(self):
+        return "io_export"
+
+    def run(self, env, device_id):
+        args = {
+            'operator': self.operator,
+            'extension': self.extension,
+        }
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    formats = [
+        ('obj', "obj_export", ".obj"),
+        ('ply', "ply_export", ".ply"),
+        ('stl', "stl_export", ".stl"),
+    ]
+    filepaths = env.find_blend_files('io/*')
+    return [IOExportTest(filepath, file_format, operator, extension)
+            for filepath in filepaths
+            for file_format, operator, extension in formats]
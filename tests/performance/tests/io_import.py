@@ -0,0 +1,86 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    export_operator = getattr(bpy.ops.wm, args['export_operator'])
+    import_operator = getattr(bpy.ops.wm, args['import_operator'])
+
+    with tempfile.TemporaryDirectory() as tempdir:
+        # Use the same files as the export tests, exported once to get the file to import.
+        filepath = os.path.join(tempdir, "import" + args['extension'])
+        export_operator(filepath=filepath)
+
+        # Start from an empty scene, so that only the imported objects are removed again.
+        bpy.ops.wm.read_homefile(use_empty=True)
+
+        test_time_start = time.time()
+        measured_times = []
+
+        min_measurements = 3
+        max_measurements = 20
+        timeout = 10
+
+        while True:
+            start_time = time.time()
+            import_operator(filepath=filepath)
+            elapsed_time = time.time() - start_time
+            measured_times.append(elapsed_time)
+
+            # Remove the imported data, so that every import starts from the same state.
+            bpy.ops.object.select_all(action='SELECT')
+            bpy.ops.object.delete(use_global=False)
+            bpy.ops.outliner.orphans_purge(do_recursive=True)
+
+            if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+                break
+            if len(measured_times) >= max_measurements:
+                break
+
+    average_time = sum(measured_times) / len(measured_times)
+    result = {'time': average_time}
+    return result
+
+
+class IOImportTest(api.Test):
+    def __init__(self, filepath, file_format, export_operator, import_operator, extension):
+        self.filepath = filepath
+        self.file_format = file_format
+        self.export_operator = export_operator
+        self.import_operator = import_operator
+        self.extension = extension
+
+    def name(self):
+        return f"{self.filepath.stem}_{self.file_format}"
+
+    def category(self):
+        return "io_import"
+
+    def run(self, env, device_id):
+        args = {
+            'export_operator': self.export_operator,
+            'import_operator': self.import_operator,
+            'extension': self.extension,
+        }
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    formats = [
+        ('obj', "obj_export", "obj_import", ".obj"),
+        ('ply', "ply_export", "ply_import", ".ply"),
+        ('stl', "stl_export", "stl_import", ".stl"),
+    ]
+    filepaths = env.find_blend_files('io/*')
+    return [IOImportTest(filepath, file_format, export_operator, import_operator, extension)
+            for filepath in filepaths
+            for file_format, export_operator, import_operator, extension in formats]
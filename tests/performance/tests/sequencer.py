@@ -0,0 +1,57 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    scene = bpy.context.scene
+    scene.render.use_sequencer = True
+    scene.render.use_compositing = False
+
+    # Render the first frame once, so that files are opened and images are cached by the system.
+    scene.frame_set(scene.frame_start)
+    bpy.ops.render.render()
+
+    start_time = time.time()
+    elapsed_time = 0.0
+    num_frames = 0
+
+    while elapsed_time < 10.0:
+        # Render every frame like playback does, each frame has to composite all visible strips.
+        for i in range(scene.frame_start, scene.frame_end + 1):
+            scene.frame_set(i)
+            bpy.ops.render.render()
+
+        num_frames += scene.frame_end + 1 - scene.frame_start
+        elapsed_time = time.time() - start_time
+
+    time_per_frame = elapsed_time / num_frames
+
+    result = {'time': time_per_frame}
+    return result
+
+
+class SequencerTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "sequencer"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('sequencer/*')
+    return [SequencerTest(filepath) for filepath in filepaths]
@@ -0,0 +1,68 @@
+# SPDX-FileCopyrightText: 2025 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    # Push a first step, so that following steps can reuse unchanged chunks of the previous one.
+    bpy.ops.ed.undo_push(message="Benchmark")
+
+    test_time_start = time.time()
+    measured_times = []
+
+    min_measurements = 5
+    max_measurements = 100
+    timeout = 5
+
+    while True:
+        # Change a single object, like a typical edit between two undo steps.
+        ob = bpy.context.view_layer.objects.active or bpy.context.view_layer.objects[0]
+        ob.location.x += 0.01
+
+        start_time = time.time()
+        bpy.ops.ed.undo_push(message="Benchmark")
+        elapsed_time = time.time() - start_time
+        measured_times.append(elapsed_time)
+
+        if len(measured_times) >= min_measurements and test_time_start + timeout < time.time():
+            break
+        if len(measured_times) >= max_measurements:
+            break
+
+    average_time = sum(measured_times) / len(measured_times)
+    result = {'time': average_time}
+
+    # The undo stack is only available with a window, quit once the result is printed.
+    # The benchmark changed the file, quit without asking to save it.
+    bpy.context.preferences.view.use_save_prompt = False
+    bpy.ops.wm.quit_blender()
+    return result
+
+
+class UndoPushTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "undo_push"
+
+    def use_background(self):
+        return False
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath], foreground=True)
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('undo/*')
+    return [UndoPushTest(filepath) for filepath in filepaths]